@@ -0,0 +1,19 @@
+#include "arrival_schedule.hpp"
+
+namespace perma {
+
+ArrivalSchedule::ArrivalSchedule(const double ops_per_second, const ArrivalPattern arrival_pattern,
+                                 const uint64_t seed)
+    : arrival_pattern_{arrival_pattern},
+      interval_ns_{NANOSECONDS_IN_SECONDS / ops_per_second},
+      generator_{seed},
+      // The mean of the exponential distribution is 1 / lambda, so that the Poisson process has the same rate.
+      exponential_interval_{1.0 / interval_ns_} {}
+
+void ArrivalSchedule::start(const std::chrono::steady_clock::time_point begin_ts) {
+  begin_ts_ = begin_ts;
+  intended_start_ = begin_ts;
+  next_offset_ns_ = 0;
+}
+
+}  // namespace perma
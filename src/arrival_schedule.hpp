@@ -0,0 +1,53 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+#include "benchmark_config.hpp"
+
+namespace perma {
+
+/**
+ * Schedules the operations of a rate-limited thread at the intervals of the `arrival_pattern`. The schedule does not
+ * depend on how long the operations take, so a thread that falls behind starts the next operations right away. The
+ * latency of an operation is measured from its intended start, which includes the time that it waited behind earlier
+ * operations. Measuring from the actual start would omit this queueing delay (coordinated omission).
+ */
+class ArrivalSchedule {
+ public:
+  // Poisson arrivals are seeded with `seed`, so that the threads do not start their operations in lockstep.
+  ArrivalSchedule(double ops_per_second, ArrivalPattern arrival_pattern, uint64_t seed);
+
+  /** Sets the intended start of the first operation. */
+  void start(std::chrono::steady_clock::time_point begin_ts);
+
+  /** Waits until the intended start of the next operation. Returns right away if the thread is behind schedule. */
+  inline void wait_for_next_op() {
+    intended_start_ = begin_ts_ + std::chrono::nanoseconds{static_cast<int64_t>(next_offset_ns_)};
+    next_offset_ns_ += next_interval_ns();
+    // Sleeping is too coarse for sub-microsecond intervals, so we spin.
+    while (std::chrono::steady_clock::now() < intended_start_) {
+    }
+  }
+
+  /** Returns the nanoseconds since the intended start of the current operation. */
+  inline uint64_t latency_ns() const { return (std::chrono::steady_clock::now() - intended_start_).count(); }
+
+ private:
+  inline double next_interval_ns() {
+    return arrival_pattern_ == ArrivalPattern::Fixed ? interval_ns_ : exponential_interval_(generator_);
+  }
+
+  const ArrivalPattern arrival_pattern_;
+  const double interval_ns_;
+  std::mt19937_64 generator_;
+  std::exponential_distribution<double> exponential_interval_;
+
+  std::chrono::steady_clock::time_point begin_ts_{};
+  std::chrono::steady_clock::time_point intended_start_{};
+  // The offset is not rounded to full nanoseconds, so that the rounding errors do not add up over all operations.
+  double next_offset_ns_ = 0;
+};
+
+}  // namespace perma
@@ -2,15 +2,22 @@
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <cmath>
 #include <condition_variable>
+#include <csignal>
 #include <cstdint>
+#include <iterator>
 #include <memory>
 #include <thread>
 #include <utility>
 
 #include "benchmark_config.hpp"
+#include "compiled_chain.hpp"
+#include "dirty_line_counter.hpp"
 #include "fast_random.hpp"
 #include "numa.hpp"
+#include "single_benchmark.hpp"
 
 namespace {
 
@@ -41,6 +48,76 @@ nlohmann::json hdr_histogram_to_json(hdr_histogram* hdr) {
   return result;
 }
 
+// Averages the compute overlap of a chain over all threads.
+nlohmann::json compute_overlap_to_json(const std::vector<perma::ComputeOverlap>& compute_overlaps,
+                                       const size_t chain_idx, const size_t num_chains) {
+  perma::ComputeOverlap average{};
+  const size_t num_threads = compute_overlaps.size() / num_chains;
+  for (size_t entry = chain_idx; entry < compute_overlaps.size(); entry += num_chains) {
+    average.memory_only_ns += compute_overlaps[entry].memory_only_ns / num_threads;
+    average.compute_only_ns += compute_overlaps[entry].compute_only_ns / num_threads;
+    average.combined_ns += compute_overlaps[entry].combined_ns / num_threads;
+  }
+
+  // If the chain takes less time than its memory and compute ops on their own, the difference ran in parallel.
+  const double overlap_ns = std::max(0.0, average.memory_only_ns + average.compute_only_ns - average.combined_ns);
+  nlohmann::json result;
+  result["memory_only_ns"] = average.memory_only_ns;
+  result["compute_only_ns"] = average.compute_only_ns;
+  result["combined_ns"] = average.combined_ns;
+  result["overlap_ns"] = overlap_ns;
+  result["overlapped_memory_ratio"] =
+      average.memory_only_ns > 0 ? std::clamp(overlap_ns / average.memory_only_ns, 0.0, 1.0) : 0.0;
+  return result;
+}
+
+// Returns the thread's buffer of write data or null if the writes store the constant WRITE_DATA. The seeds do not
+// overlap with those of the data generator, so that random writes do not store the data that is already in memory.
+std::unique_ptr<perma::WriteDataBuffer> create_write_data(const perma::BenchmarkConfig& config,
+                                                          const uint64_t thread_num, const size_t max_access_size) {
+  // Read-modify-writes store the modified loaded data, so only benchmarks with plain writes need the buffer.
+  const bool has_plain_writes = config.contains_write_op() &&
+                                (config.exec_mode == perma::Mode::Custom || config.is_mixed_read_write() ||
+                                 config.operation == perma::Operation::Write);
+  if (config.data_pattern == perma::DataPattern::Constant || !has_plain_writes) {
+    return nullptr;
+  }
+  return std::make_unique<perma::WriteDataBuffer>(config, perma::utils::NUM_UTIL_THREADS + thread_num,
+                                                  max_access_size);
+}
+
+// Returns the average number of Bytes that an operation accesses, i.e., a single access in sequential and random
+// execution and a chain in custom execution. Fences, prefetches, and compute ops do not count as accesses.
+double average_operation_size(const perma::BenchmarkConfig& config, const perma::AccessSizeSampler* size_sampler) {
+  if (config.exec_mode != perma::Mode::Custom) {
+    return size_sampler != nullptr ? size_sampler->average_size() : static_cast<double>(config.access_size);
+  }
+
+  double total_weight = 0;
+  double weighted_size = 0;
+  for (const perma::WeightedCustomChain& chain : config.get_custom_chains()) {
+    double chain_size = 0;
+    for (const perma::CustomOp& op : chain.operations) {
+      if (op.type == perma::Operation::Fence || op.type == perma::Operation::Prefetch || op.is_compute()) {
+        continue;
+      }
+      chain_size += op.has_variable_size ? size_sampler->average_size() : static_cast<double>(op.size);
+    }
+    total_weight += chain.weight;
+    weighted_size += chain.weight * chain_size;
+  }
+  return weighted_size / total_weight;
+}
+
+// The threads prepare the cache in parallel and the measurement starts after the slowest one.
+double cache_state_time_s(const std::vector<std::chrono::steady_clock::duration>& cache_state_durations) {
+  return std::chrono::duration<double>(*std::max_element(cache_state_durations.begin(), cache_state_durations.end()))
+      .count();
+}
+
+volatile sig_atomic_t step_thread_error;
+void step_thread_error_handler(int) { step_thread_error = 1; }
+
 inline double get_bandwidth(const uint64_t total_data_size, const std::chrono::steady_clock::duration total_duration) {
   const double duration_in_s = static_cast<double>(total_duration.count()) / perma::NANOSECONDS_IN_SECONDS;
   const double data_in_gib = static_cast<double>(total_data_size) / perma::BYTES_IN_GIGABYTE;
@@ -60,9 +137,19 @@ std::string Benchmark::benchmark_type_as_str() const {
 BenchmarkType Benchmark::get_benchmark_type() const { return benchmark_type_; }
 
 void Benchmark::single_set_up(const BenchmarkConfig& config, char* pmem_data, char* dram_data,
-                              BenchmarkExecution* execution, BenchmarkResult* result, std::vector<std::thread>* pool,
+                              const std::vector<char*>& custom_region_data, BenchmarkExecution* execution,
+                              BenchmarkResult* result, std::vector<std::thread>* pool,
                               std::vector<ThreadRunConfig>* thread_config) {
-  const size_t num_total_range_ops = config.memory_range / config.access_size;
+  // If number_partitions is 0, each thread gets its own partition.
+  const uint16_t num_partitions = config.number_partitions == 0 ? config.number_threads : config.number_partitions;
+
+  const uint16_t num_threads_per_partition = config.number_threads / num_partitions;
+  const uint64_t partition_size = config.memory_range / num_partitions;
+  const uint64_t dram_partition_size = config.dram_memory_range / num_partitions;
+
+  // All accesses are shifted by the alignment offset, so the last bytes of a partition may not fit a full access.
+  const uint64_t num_accesses_in_partition = (partition_size - config.alignment_offset) / config.access_size;
+  const size_t num_total_range_ops = num_accesses_in_partition * num_partitions;
   const bool is_custom_execution = config.exec_mode == Mode::Custom;
   const size_t num_operations =
       (config.exec_mode == Mode::Random || is_custom_execution) ? config.number_operations : num_total_range_ops;
@@ -72,26 +159,64 @@ void Benchmark::single_set_up(const BenchmarkConfig& config, char* pmem_data, ch
   thread_config->reserve(config.number_threads);
   result->total_operation_durations.resize(config.number_threads);
   result->total_operation_sizes.resize(config.number_threads, 0);
+  if (config.is_mixed_read_write()) {
+    result->read_operation_sizes.resize(config.number_threads, 0);
+  }
+  if (config.cache_state != CacheState::None) {
+    result->cache_state_durations.resize(config.number_threads);
+  }
+  const bool counts_dirty_line_hits =
+      execution->parallel_sync != nullptr && execution->parallel_sync->count_dirty_line_hits;
+  if (execution->parallel_sync != nullptr) {
+    result->overlap_operation_sizes.resize(config.number_threads, 0);
+  }
+  if (counts_dirty_line_hits) {
+    result->dirty_line_hits.resize(config.number_threads, 0);
+  }
 
   uint64_t estimate_num_latency_measurements = 0;
+  const size_t num_custom_chains = std::max(config.custom_chain_mixture.size(), 1ul);
   if (is_custom_execution) {
-    result->custom_operation_latencies.resize(config.number_threads);
+    result->custom_operation_latencies.resize(config.number_threads * num_custom_chains);
+    result->custom_chain_operations.resize(config.number_threads * num_custom_chains, 0);
+    if (config.has_compute_ops()) {
+      result->custom_compute_overlaps.resize(config.number_threads * num_custom_chains);
+    }
 
     if (config.latency_sample_frequency > 0) {
       estimate_num_latency_measurements = (num_ops_per_thread / config.latency_sample_frequency) * 2;
+    } else if (config.is_rate_limited()) {
+      estimate_num_latency_measurements = num_ops_per_thread;
     }
   }
 
-  // If number_partitions is 0, each thread gets its own partition.
-  const uint16_t num_partitions = config.number_partitions == 0 ? config.number_threads : config.number_partitions;
-
-  const uint16_t num_threads_per_partition = config.number_threads / num_partitions;
-  const uint64_t partition_size = config.memory_range / num_partitions;
-  const uint64_t dram_partition_size = config.dram_memory_range / num_partitions;
+  if (config.access_size_distribution != SizeDistribution::Fixed) {
+    execution->access_size_sampler = std::make_unique<AccessSizeSampler>(config);
+    result->size_bucket_counters.resize(config.number_threads);
+  }
+  const AccessSizeSampler* size_sampler = execution->access_size_sampler.get();
+
+  if (config.is_rate_limited()) {
+    result->target_ops_per_second =
+        config.target_bandwidth > 0
+            ? static_cast<double>(config.target_bandwidth) / average_operation_size(config, size_sampler)
+            : config.target_ops_per_second;
+    execution->thread_target_ops_per_second = result->target_ops_per_second / config.number_threads;
+    // Executions that run until they are stopped, i.e., the background load of a loaded-latency step, have no bound
+    // on their number of accesses, so they only report their bandwidth.
+    if (!is_custom_execution && !execution->run_until_stopped) {
+      result->operation_latencies.resize(config.number_threads);
+    }
+  }
 
-  // Set up thread synchronization and execution parameters
+  // Set up thread synchronization and execution parameters. With variable access sizes, a random chunk contains
+  // min_io_chunk_size Bytes on average.
+  const uint64_t chunk_access_size =
+      (size_sampler != nullptr && config.exec_mode == Mode::Random)
+          ? static_cast<uint64_t>(std::max(1.0, std::round(size_sampler->average_size())))
+          : config.access_size;
   const size_t ops_per_chunk =
-      config.access_size < config.min_io_chunk_size ? config.min_io_chunk_size / config.access_size : 1;
+      chunk_access_size < config.min_io_chunk_size ? config.min_io_chunk_size / chunk_access_size : 1;
 
   // Add one chunk for random execution and non-divisible numbers so that we perform at least number_operations ops and
   // not fewer. Adding a chunk in sequential access exceeds the memory range and segfaults.
@@ -105,60 +230,150 @@ void Benchmark::single_set_up(const BenchmarkConfig& config, char* pmem_data, ch
   execution->num_custom_chunks_remaining = static_cast<int64_t>(num_chunks);
 
   for (uint16_t partition_num = 0; partition_num < num_partitions; partition_num++) {
-    char* partition_start = (config.exec_mode == Mode::Sequential_Desc)
-                                ? pmem_data + ((num_partitions - partition_num) * partition_size) - config.access_size
-                                : pmem_data + (partition_num * partition_size);
+    // Descending access starts at the last full access of the partition and partitions are used in reverse order.
+    const uint64_t last_access_offset = (num_accesses_in_partition - 1) * config.access_size;
+    char* partition_start =
+        (config.exec_mode == Mode::Sequential_Desc)
+            ? pmem_data + ((num_partitions - partition_num - 1) * partition_size) + config.alignment_offset +
+                  last_access_offset
+            : pmem_data + (partition_num * partition_size) + config.alignment_offset;
 
     // Only possible in random or custom mode
-    char* dram_partition_start = dram_data + (partition_num * partition_size);
+    char* dram_partition_start = dram_data + (partition_num * dram_partition_size) + config.alignment_offset;
+
+    // Named regions are only possible in custom mode
+    std::vector<RegionPartition> custom_region_partitions;
+    custom_region_partitions.reserve(config.custom_regions.size());
+    for (size_t region_idx = 0; region_idx < config.custom_regions.size(); ++region_idx) {
+      const uint64_t region_partition_size = config.custom_regions[region_idx].size / num_partitions;
+      char* region_partition_start =
+          custom_region_data[region_idx] + (partition_num * region_partition_size) + config.alignment_offset;
+      custom_region_partitions.push_back(RegionPartition{region_partition_start, region_partition_size});
+    }
 
     for (uint16_t partition_thread_num = 0; partition_thread_num < num_threads_per_partition; partition_thread_num++) {
       const uint32_t thread_idx = (partition_num * num_threads_per_partition) + partition_thread_num;
 
       // Reserve space for custom operation latency measurements to avoid resizing during benchmark execution.
       if (is_custom_execution) {
-        result->custom_operation_latencies[thread_idx].reserve(estimate_num_latency_measurements);
+        for (size_t chain_idx = 0; chain_idx < num_custom_chains; ++chain_idx) {
+          result->custom_operation_latencies[(thread_idx * num_custom_chains) + chain_idx].reserve(
+              estimate_num_latency_measurements);
+        }
       }
 
       ExecutionDuration* total_op_duration = &result->total_operation_durations[thread_idx];
       uint64_t* total_op_size = &result->total_operation_sizes[thread_idx];
+      uint64_t* read_op_size = config.is_mixed_read_write() ? &result->read_operation_sizes[thread_idx] : nullptr;
       std::vector<uint64_t>* custom_op_latencies =
-          is_custom_execution ? &result->custom_operation_latencies[thread_idx] : nullptr;
+          is_custom_execution ? &result->custom_operation_latencies[thread_idx * num_custom_chains] : nullptr;
+      uint64_t* custom_chain_operations =
+          is_custom_execution ? &result->custom_chain_operations[thread_idx * num_custom_chains] : nullptr;
+
+      // Rate-limited threads measure each access, which is at most the duration times the rate or all chunks.
+      std::vector<uint64_t>* operation_latencies = nullptr;
+      if (!result->operation_latencies.empty()) {
+        operation_latencies = &result->operation_latencies[thread_idx];
+        const uint64_t max_num_thread_ops =
+            config.run_time > 0
+                ? static_cast<uint64_t>(execution->thread_target_ops_per_second * static_cast<double>(config.run_time))
+                : num_chunks * ops_per_chunk / config.number_threads + ops_per_chunk;
+        operation_latencies->reserve(max_num_thread_ops);
+      }
+      ComputeOverlap* compute_overlaps = result->custom_compute_overlaps.empty()
+                                             ? nullptr
+                                             : &result->custom_compute_overlaps[thread_idx * num_custom_chains];
+      SizeBucketCounters* size_bucket_counters =
+          size_sampler != nullptr ? &result->size_bucket_counters[thread_idx] : nullptr;
+
+      // The threads of a partition split it evenly, so that they evict or load all ranges in parallel.
+      std::vector<RegionPartition> cache_state_ranges;
+      std::chrono::steady_clock::duration* cache_state_duration = nullptr;
+      if (config.cache_state != CacheState::None) {
+        auto add_thread_share = [&](char* range_partition_start, const uint64_t range_partition_size) {
+          const uint64_t share_size = range_partition_size / num_threads_per_partition;
+          if (range_partition_start != nullptr && share_size > 0) {
+            cache_state_ranges.push_back(
+                RegionPartition{range_partition_start + (partition_thread_num * share_size), share_size});
+          }
+        };
+        add_thread_share(pmem_data + (partition_num * partition_size), partition_size);
+        if (dram_data != nullptr) {
+          add_thread_share(dram_data + (partition_num * dram_partition_size), dram_partition_size);
+        }
+        for (size_t region_idx = 0; region_idx < config.custom_regions.size(); ++region_idx) {
+          const uint64_t region_partition_size = config.custom_regions[region_idx].size / num_partitions;
+          add_thread_share(custom_region_data[region_idx] + (partition_num * region_partition_size),
+                           region_partition_size);
+        }
+        cache_state_duration = &result->cache_state_durations[thread_idx];
+      }
+      uint64_t* overlap_op_size =
+          execution->parallel_sync != nullptr ? &result->overlap_operation_sizes[thread_idx] : nullptr;
+      uint64_t* dirty_line_hits = counts_dirty_line_hits ? &result->dirty_line_hits[thread_idx] : nullptr;
 
       thread_config->emplace_back(partition_start, dram_partition_start, partition_size, dram_partition_size,
-                                  num_threads_per_partition, thread_idx, ops_per_chunk, num_chunks, config, execution,
-                                  total_op_duration, total_op_size, custom_op_latencies);
+                                  custom_region_partitions, std::move(cache_state_ranges), num_threads_per_partition,
+                                  thread_idx, ops_per_chunk, num_chunks, config, execution, total_op_duration,
+                                  total_op_size, read_op_size, custom_op_latencies, operation_latencies,
+                                  custom_chain_operations, compute_overlaps, size_bucket_counters,
+                                  cache_state_duration, overlap_op_size, dirty_line_hits);
     }
   }
 }
 
-char* Benchmark::create_pmem_data_file(const BenchmarkConfig& config, const MemoryRegion& memory_region) {
+char* Benchmark::create_pmem_data_file(const BenchmarkConfig& config, const MemoryRegion& memory_region,
+                                       const uint64_t memory_range) {
   if (!config.is_pmem) {
     // Replace PMem range with DRAM if user specifies a dram-only run.
-    return create_dram_data(config, config.memory_range);
+    return create_dram_data(config, memory_range);
   }
 
   if (std::filesystem::exists(memory_region.pmem_file)) {
     // Data was already generated. Only re-map it.
-    return utils::map_pmem(memory_region.pmem_file, config.memory_range);
+    return utils::map_pmem(memory_region.pmem_file, memory_range);
   }
 
-  char* file_data = utils::create_pmem_file(memory_region.pmem_file, config.memory_range);
-  prepare_data_file(file_data, config, config.memory_range, utils::PMEM_PAGE_SIZE);
+  char* file_data = utils::create_pmem_file(memory_region.pmem_file, memory_range);
+  prepare_data_file(file_data, config, memory_range, utils::PMEM_PAGE_SIZE);
   return file_data;
 }
 
-char* Benchmark::create_dram_data(const BenchmarkConfig& config, const size_t memory_range) {
+char* Benchmark::create_dram_data(const BenchmarkConfig& config, const size_t memory_range, const int32_t numa_node) {
   char* dram_data = utils::map_dram(memory_range, config.dram_huge_pages);
+  if (numa_node >= 0 && dram_data != nullptr) {
+    bind_to_numa_node(dram_data, memory_range, numa_node);
+  }
   prepare_data_file(dram_data, config, memory_range, utils::DRAM_PAGE_SIZE);
   return dram_data;
 }
 
+std::vector<char*> Benchmark::create_custom_region_data(const BenchmarkConfig& config,
+                                                        std::vector<MemoryRegion>* region_files) {
+  std::vector<char*> region_data;
+  region_data.reserve(config.custom_regions.size());
+  for (const CustomRegion& region : config.custom_regions) {
+    if (region.is_pmem) {
+      const MemoryRegion& region_file =
+          region_files->emplace_back(utils::generate_random_file_name(config.pmem_directory), true, false);
+      region_data.push_back(create_pmem_data_file(config, region_file, region.size));
+    } else {
+      region_files->emplace_back(std::filesystem::path{}, false, true);
+      region_data.push_back(create_dram_data(config, region.size, region.numa_node));
+    }
+  }
+  return region_data;
+}
+
 void Benchmark::prepare_data_file(char* file_data, const BenchmarkConfig& config, const uint64_t memory_range,
                                   const uint64_t page_size) {
   if (config.contains_read_op()) {
     // If we read data in this benchmark, we need to generate it first.
-    utils::generate_read_data(file_data, memory_range);
+    if (config.data_pattern == DataPattern::Constant) {
+      utils::generate_read_data(file_data, memory_range);
+    } else {
+      WriteDataBuffer::generate_read_data(file_data, memory_range, config);
+    }
   }
 
   if (config.contains_write_op() && config.prefault_file) {
@@ -167,77 +382,264 @@ void Benchmark::prepare_data_file(char* file_data, const BenchmarkConfig& config
 }
 
 void Benchmark::run_custom_ops_in_thread(ThreadRunConfig* thread_config, const BenchmarkConfig& config) {
-  const std::vector<CustomOp>& operations = config.custom_operations;
-  const size_t num_ops = operations.size();
-
-  std::vector<ChainedOperation> operation_chain;
-  operation_chain.reserve(num_ops);
+  const std::vector<WeightedCustomChain> chains = config.get_custom_chains();
+  const size_t num_chains = chains.size();
 
-  // Determine maximum access size to ensure that operations don't write beyond the end of the range.
+  // Determine maximum access size to ensure that operations don't write beyond the end of the range. All chains of a
+  // mixture access the same range. Named regions only need to fit the accesses of their own operations.
+  const AccessSizeSampler* size_sampler = thread_config->execution->access_size_sampler.get();
   size_t max_access_size = 0;
-  for (const CustomOp& op : operations) {
-    max_access_size = std::max(op.size, max_access_size);
+  std::vector<size_t> max_region_access_sizes(config.custom_regions.size(), 0);
+  for (const WeightedCustomChain& chain : chains) {
+    for (const CustomOp& op : chain.operations) {
+      if (op.is_compute()) {
+        continue;
+      }
+      const size_t op_max_size = op.has_variable_size ? size_sampler->max_size() : op.size;
+      if (op.region.empty()) {
+        max_access_size = std::max(op_max_size, max_access_size);
+      } else {
+        size_t& max_region_access_size = max_region_access_sizes[config.get_custom_region_index(op.region)];
+        max_region_access_size = std::max(op_max_size, max_region_access_size);
+      }
+    }
   }
 
-  const size_t aligned_range_size = thread_config->partition_size - max_access_size;
-  const size_t aligned_dram_range_size = thread_config->dram_partition_size - max_access_size;
-
-  for (size_t i = 0; i < num_ops; ++i) {
-    const CustomOp& op = operations[i];
-
-    if (op.is_pmem) {
-      operation_chain.emplace_back(op, thread_config->partition_start_addr, aligned_range_size);
-    } else {
-      operation_chain.emplace_back(op, thread_config->dram_partition_start_addr, aligned_dram_range_size);
-    }
+  // The partition start addresses are already shifted by the alignment offset.
+  const size_t aligned_range_size = thread_config->partition_size - config.alignment_offset - max_access_size;
+  const size_t aligned_dram_range_size = thread_config->dram_partition_size - config.alignment_offset - max_access_size;
+
+  // Random reads in a Zipf region each need a generator for the number of accesses that fit into the region.
+  std::vector<std::unique_ptr<utils::ZipfGenerator>> zipf_generators;
+
+  const size_t max_any_access_size =
+      std::accumulate(max_region_access_sizes.begin(), max_region_access_sizes.end(), max_access_size,
+                      [](const size_t max_size, const size_t region_size) { return std::max(max_size, region_size); });
+  const std::unique_ptr<WriteDataBuffer> write_data =
+      create_write_data(config, thread_config->thread_num, max_any_access_size);
+
+  auto has_explicit_fences = [](const std::vector<CustomOp>& operations) {
+    return std::any_of(operations.begin(), operations.end(),
+                       [](const CustomOp& op) { return op.type == Operation::Fence; });
+  };
+
+  auto build_chain = [&](const std::vector<CustomOp>& operations, std::vector<ChainedOperation>& operation_chain) {
+    const size_t num_ops = operations.size();
+    const bool chain_has_explicit_fences = has_explicit_fences(operations);
+    operation_chain.reserve(num_ops);
+
+    for (size_t i = 0; i < num_ops; ++i) {
+      const CustomOp& op = operations[i];
+
+      if (!op.region.empty()) {
+        const int32_t region_idx = config.get_custom_region_index(op.region);
+        const CustomRegion& region = config.custom_regions[region_idx];
+        const RegionPartition& partition = thread_config->custom_region_partitions[region_idx];
+        const size_t aligned_region_size =
+            partition.size - config.alignment_offset - max_region_access_sizes[region_idx];
+
+        const utils::ZipfGenerator* zipf_generator = nullptr;
+        if (region.distribution == RandomDistribution::Zipf && op.type == Operation::Read &&
+            op.read_pattern == ReadPattern::Random) {
+          const size_t access_slot_size = op.has_variable_size ? rw_ops::CACHE_LINE_SIZE : op.size;
+          zipf_generator = zipf_generators
+                               .emplace_back(std::make_unique<utils::ZipfGenerator>(
+                                   config.zipf_alpha, aligned_region_size / access_slot_size))
+                               .get();
+        }
+        operation_chain.emplace_back(op, partition.start_addr, aligned_region_size, size_sampler,
+                                     thread_config->size_bucket_counters, chain_has_explicit_fences, zipf_generator,
+                                     write_data.get());
+      } else if (op.is_pmem) {
+        operation_chain.emplace_back(op, thread_config->partition_start_addr, aligned_range_size, size_sampler,
+                                     thread_config->size_bucket_counters, chain_has_explicit_fences, nullptr,
+                                     write_data.get());
+      } else {
+        operation_chain.emplace_back(op, thread_config->dram_partition_start_addr, aligned_dram_range_size,
+                                     size_sampler, thread_config->size_bucket_counters, chain_has_explicit_fences,
+                                     nullptr, write_data.get());
+      }
 
-    if (i > 0) {
-      operation_chain[i - 1].set_next(&operation_chain[i]);
+      if (i > 0) {
+        operation_chain[i - 1].set_next(&operation_chain[i]);
+      }
     }
+  };
+
+  std::vector<std::vector<ChainedOperation>> operation_chains(num_chains);
+  std::vector<CompiledChain> compiled_chains;
+  compiled_chains.reserve(num_chains);
+  for (size_t chain_idx = 0; chain_idx < num_chains; ++chain_idx) {
+    const std::vector<CustomOp>& operations = chains[chain_idx].operations;
+    build_chain(operations, operation_chains[chain_idx]);
+    compiled_chains.emplace_back(operation_chains[chain_idx], operations, has_explicit_fences(operations));
   }
 
   const size_t seed = std::chrono::steady_clock::now().time_since_epoch().count() * (thread_config->thread_num + 1);
   lehmer64_seed(seed);
   char* start_addr = (char*)seed;
 
-  ChainedOperation& start_op = operation_chain[0];
+  // Chains with compute ops run a few chains with only their memory ops, with only their compute ops, and with all ops
+  // before the timed run. This shows how much of the memory time the compute ops hide.
+  if (thread_config->compute_overlaps != nullptr) {
+    auto time_chains = [&](std::vector<ChainedOperation>& operation_chain, const std::vector<CustomOp>& operations) {
+      const CompiledChain compiled_chain{operation_chain, operations, has_explicit_fences(operations)};
+      std::unique_ptr<InterleavedChains> interleaved_chains;
+      if (config.mlp_width > 1) {
+        interleaved_chains = std::make_unique<InterleavedChains>(operation_chain, config.mlp_width, start_addr);
+      }
+
+      const auto begin_ts = std::chrono::steady_clock::now();
+      if (interleaved_chains) {
+        interleaved_chains->run(NUM_OVERLAP_CALIBRATION_CHAINS);
+      } else {
+        compiled_chain.run(NUM_OVERLAP_CALIBRATION_CHAINS, start_addr);
+      }
+      const auto end_ts = std::chrono::steady_clock::now();
+      return static_cast<double>(utils::duration_to_nanoseconds(end_ts - begin_ts)) / NUM_OVERLAP_CALIBRATION_CHAINS;
+    };
+
+    for (size_t chain_idx = 0; chain_idx < num_chains; ++chain_idx) {
+      const std::vector<CustomOp>& operations = chains[chain_idx].operations;
+      std::vector<CustomOp> compute_ops;
+      std::vector<CustomOp> memory_ops;
+      std::partition_copy(operations.begin(), operations.end(), std::back_inserter(compute_ops),
+                          std::back_inserter(memory_ops), [](const CustomOp& op) { return op.is_compute(); });
+      if (compute_ops.empty()) {
+        continue;
+      }
+
+      std::vector<ChainedOperation> memory_chain;
+      std::vector<ChainedOperation> compute_chain;
+      build_chain(memory_ops, memory_chain);
+      build_chain(compute_ops, compute_chain);
+      ComputeOverlap& overlap = thread_config->compute_overlaps[chain_idx];
+      overlap.memory_only_ns = time_chains(memory_chain, memory_ops);
+      overlap.compute_only_ns = time_chains(compute_chain, compute_ops);
+      overlap.combined_ns = time_chains(operation_chains[chain_idx], operations);
+    }
+
+    if (thread_config->size_bucket_counters != nullptr) {
+      // Variable-sized accesses of the calibration must not count towards the results.
+      *thread_config->size_bucket_counters = SizeBucketCounters{};
+    }
+  }
+
+  // Custom operations have no address generation, so the threads only wait for each other if they prepare the cache.
+  // Otherwise, a thread could already run while another one still evicts the ranges.
+  if (config.cache_state != CacheState::None) {
+    prepare_cache_state(thread_config, config);
+    wait_for_all_threads(thread_config->execution);
+  }
+
+  std::unique_ptr<ArrivalSchedule> schedule;
+  if (config.is_rate_limited()) {
+    schedule = std::make_unique<ArrivalSchedule>(thread_config->execution->thread_target_ops_per_second,
+                                                 config.arrival_pattern, seed);
+  }
+
+  ParallelSync* parallel_sync = thread_config->execution->parallel_sync;
+  bool is_in_overlap = parallel_sync != nullptr;
+  std::unique_ptr<DirtyLineCounter> dirty_line_counter;
+  if (thread_config->dirty_line_hits != nullptr) {
+    dirty_line_counter = std::make_unique<DirtyLineCounter>();
+  }
+  if (parallel_sync != nullptr) {
+    wait_for_parallel_start(parallel_sync);
+  }
+  if (dirty_line_counter) {
+    dirty_line_counter->start();
+  }
+
   auto start_ts = std::chrono::steady_clock::now();
+  if (schedule) {
+    schedule->start(start_ts);
+  }
 
   const size_t num_ops_per_chunk = thread_config->num_ops_per_chunk;
   uint64_t total_num_ops = 0;
 
+  std::unique_ptr<InterleavedChains> interleaved_chains;
+  if (config.mlp_width > 1) {
+    interleaved_chains = std::make_unique<InterleavedChains>(operation_chains[0], config.mlp_width, start_addr);
+  }
+
+  // Mixtures pick the chain of each iteration, so we count the operations of each chain.
+  std::unique_ptr<ChainSampler> chain_sampler;
+  if (num_chains > 1) {
+    chain_sampler = std::make_unique<ChainSampler>(chains);
+  }
+  std::vector<uint64_t> chain_operations(num_chains, 0);
+
   while (true) {
     if (thread_config->execution->num_custom_chunks_remaining.fetch_sub(1) <= 0) {
       break;
     }
 
-    if (config.latency_sample_frequency == 0) {
-      // We don't want the sampling code overhead if we don't want to sample the latency.
+    if (interleaved_chains) {
+      // A chunk contains the same number of chains, independent of how many of them we interleave.
+      interleaved_chains->run(num_ops_per_chunk);
+      chain_operations[0] += num_ops_per_chunk;
+    } else if (schedule) {
+      // Rate-limited chains start at their intended start and their latency contains the time behind schedule.
       for (size_t iteration = 0; iteration < num_ops_per_chunk; ++iteration) {
-        start_op.run(start_addr, start_addr);
+        const size_t chain_idx = chain_sampler ? chain_sampler->sample() : 0;
+        schedule->wait_for_next_op();
+        compiled_chains[chain_idx].run(1, start_addr);
+        thread_config->custom_op_latencies[chain_idx].emplace_back(schedule->latency_ns());
+        chain_operations[chain_idx]++;
+      }
+    } else if (config.latency_sample_frequency == 0) {
+      // We don't want the sampling code overhead if we don't want to sample the latency.
+      if (chain_sampler) {
+        for (size_t iteration = 0; iteration < num_ops_per_chunk; ++iteration) {
+          const size_t chain_idx = chain_sampler->sample();
+          compiled_chains[chain_idx].run(1, start_addr);
+          chain_operations[chain_idx]++;
+        }
+      } else {
+        compiled_chains[0].run(num_ops_per_chunk, start_addr);
+        chain_operations[0] += num_ops_per_chunk;
       }
     } else {
       // Latency sampling requested, measure the latency every x iterations.
       const uint64_t freq = config.latency_sample_frequency;
       // Start at 1 to avoid measuring latency of first request.
       for (size_t iteration = 1; iteration <= num_ops_per_chunk; ++iteration) {
+        const size_t chain_idx = chain_sampler ? chain_sampler->sample() : 0;
+        const CompiledChain& compiled_chain = compiled_chains[chain_idx];
         if (iteration % freq == 0) {
           auto op_start = std::chrono::steady_clock::now();
-          start_op.run(start_addr, start_addr);
+          compiled_chain.run(1, start_addr);
           auto op_end = std::chrono::steady_clock::now();
-          thread_config->custom_op_latencies->emplace_back((op_end - op_start).count());
+          thread_config->custom_op_latencies[chain_idx].emplace_back((op_end - op_start).count());
         } else {
-          start_op.run(start_addr, start_addr);
+          compiled_chain.run(1, start_addr);
         }
+        chain_operations[chain_idx]++;
       }
     }
 
     total_num_ops += num_ops_per_chunk;
+    if (is_in_overlap && parallel_sync->overlap_ended.load(std::memory_order_relaxed)) {
+      *thread_config->overlap_operation_size = total_num_ops;
+      is_in_overlap = false;
+    }
   }
 
+  if (is_in_overlap) {
+    *thread_config->overlap_operation_size = total_num_ops;
+  }
+  if (parallel_sync != nullptr) {
+    end_overlap(parallel_sync);
+  }
+  if (dirty_line_counter) {
+    *thread_config->dirty_line_hits = dirty_line_counter->stop();
+  }
   auto end_ts = std::chrono::steady_clock::now();
   *(thread_config->total_operation_duration) = ExecutionDuration{start_ts, end_ts};
   *(thread_config->total_operation_size) = total_num_ops;
+  std::copy(chain_operations.begin(), chain_operations.end(), thread_config->custom_chain_operations);
 }
 
 void Benchmark::run_in_thread(ThreadRunConfig* thread_config, const BenchmarkConfig& config) {
@@ -249,13 +651,26 @@ void Benchmark::run_in_thread(ThreadRunConfig* thread_config, const BenchmarkCon
     return run_custom_ops_in_thread(thread_config, config);
   }
 
-  const uint32_t num_accesses_in_range = thread_config->partition_size / config.access_size;
-  const uint32_t num_dram_accesses_in_range = thread_config->dram_partition_size / config.access_size;
-  const bool is_read_op = config.operation == Operation::Read;
-
+  // Variable-sized accesses start at any cache line from which the largest possible access still fits into the range.
+  const AccessSizeSampler* size_sampler = thread_config->execution->access_size_sampler.get();
+  const bool has_variable_sizes = size_sampler != nullptr;
+  const uint64_t max_access_size = has_variable_sizes ? size_sampler->max_size() : config.access_size;
+  const uint64_t access_slot_size = has_variable_sizes ? rw_ops::CACHE_LINE_SIZE : config.access_size;
+
+  // The partition start addresses are already shifted by the alignment offset.
+  const uint32_t num_accesses_in_range =
+      (thread_config->partition_size - config.alignment_offset - max_access_size) / access_slot_size + 1;
+  const uint32_t num_dram_accesses_in_range =
+      config.is_hybrid
+          ? (thread_config->dram_partition_size - config.alignment_offset - max_access_size) / access_slot_size + 1
+          : 0;
+
+  // Chunks are laid out back-to-back. For access sizes that are not a power of two, a chunk may be slightly smaller
+  // than min_io_chunk_size, as it only contains full accesses.
+  const size_t chunk_span = thread_config->num_ops_per_chunk * config.access_size;
   const size_t thread_num_in_partition = thread_config->thread_num % thread_config->num_threads_per_partition;
-  const size_t per_iteration_thread_offset = thread_config->num_threads_per_partition * config.min_io_chunk_size;
-  const size_t thread_partition_offset = thread_num_in_partition * config.min_io_chunk_size;
+  const size_t per_iteration_thread_offset = thread_config->num_threads_per_partition * chunk_span;
+  const size_t thread_partition_offset = thread_num_in_partition * chunk_span;
 
   const auto dram_target_ratio = static_cast<uint64_t>(config.dram_operation_ratio * 100);
 
@@ -263,6 +678,18 @@ void Benchmark::run_in_thread(ThreadRunConfig* thread_config, const BenchmarkCon
   lehmer64_seed(seed);
 
   auto dram_target_distribution = [&]() { return (lehmer64() % 100) < dram_target_ratio; };
+
+  // The interleaved pattern issues a write whenever the number of expected writes grows, e.g., RRRW for 0.75 reads.
+  const double write_ratio = 1.0 - config.read_ratio;
+  const auto random_read_ratio = static_cast<uint64_t>(std::round(config.read_ratio * 10000));
+  uint64_t num_generated_mixed_ops = 0;
+  auto next_mixed_op_is_read = [&]() {
+    if (config.mix_pattern == MixPattern::Random) {
+      return (lehmer64() % 10000) < random_read_ratio;
+    }
+    const uint64_t op_num = num_generated_mixed_ops++;
+    return std::floor((op_num + 1) * write_ratio) == std::floor(op_num * write_ratio);
+  };
   auto access_distribution = [&]() { return lehmer64() % num_accesses_in_range; };
   auto dram_access_distribution = [&]() { return lehmer64() % num_dram_accesses_in_range; };
 
@@ -286,6 +713,8 @@ void Benchmark::run_in_thread(ThreadRunConfig* thread_config, const BenchmarkCon
                                  : thread_config->partition_start_addr + thread_chunk_offset;
 
     std::vector<char*> op_addresses(thread_config->num_ops_per_chunk);
+    std::vector<uint32_t> op_sizes(has_variable_sizes ? thread_config->num_ops_per_chunk : 0);
+    SizeBucketCounters size_bucket_counters{};
 
     for (size_t io_op = 0; io_op < thread_config->num_ops_per_chunk; ++io_op) {
       switch (config.exec_mode) {
@@ -312,7 +741,12 @@ void Benchmark::run_in_thread(ThreadRunConfig* thread_config, const BenchmarkCon
           } else {
             random_value = utils::zipf(config.zipf_alpha, num_target_accesses_in_range);
           }
-          op_addresses[io_op] = partition_start + (random_value * config.access_size);
+          op_addresses[io_op] = partition_start + (random_value * access_slot_size);
+
+          if (has_variable_sizes) {
+            op_sizes[io_op] = size_sampler->sample();
+            size_bucket_counters.add(op_sizes[io_op]);
+          }
           break;
         }
         case Mode::Sequential: {
@@ -332,8 +766,22 @@ void Benchmark::run_in_thread(ThreadRunConfig* thread_config, const BenchmarkCon
       }
     }
 
+    std::vector<Operation> op_types{};
+    uint64_t mixed_read_size = 0;
+    if (config.is_mixed_read_write()) {
+      op_types.resize(thread_config->num_ops_per_chunk);
+      for (size_t io_op = 0; io_op < thread_config->num_ops_per_chunk; ++io_op) {
+        if (next_mixed_op_is_read()) {
+          op_types[io_op] = Operation::Read;
+          mixed_read_size += has_variable_sizes ? op_sizes[io_op] : config.access_size;
+        } else {
+          op_types[io_op] = Operation::Write;
+        }
+      }
+    }
+
     // We can always pass the persist_instruction as is. It is ignored for read access.
-    Operation op = is_read_op ? Operation::Read : Operation::Write;
+    Operation op = config.operation;
     const size_t insert_pos = (chunk_num * config.number_threads) + thread_config->thread_num;
 
     IoOperation& current_io = thread_config->execution->io_operations[insert_pos];
@@ -341,6 +789,14 @@ void Benchmark::run_in_thread(ThreadRunConfig* thread_config, const BenchmarkCon
     current_io.access_size_ = config.access_size;
     current_io.op_type_ = op;
     current_io.persist_instruction_ = config.persist_instruction;
+    current_io.op_sizes_ = std::move(op_sizes);
+    current_io.size_bucket_counters_ = size_bucket_counters;
+    current_io.op_types_ = std::move(op_types);
+    current_io.mixed_read_size_ = mixed_read_size;
+    current_io.fence_every_ = config.fence_every;
+    current_io.read_instruction_ = config.read_instruction;
+    current_io.prefetch_distance_ = config.prefetch_distance;
+    current_io.checksum_ = config.checksum;
   }
 
   const auto generation_end_ts = std::chrono::steady_clock::now();
@@ -348,32 +804,67 @@ void Benchmark::run_in_thread(ThreadRunConfig* thread_config, const BenchmarkCon
       std::chrono::duration_cast<std::chrono::milliseconds>(generation_end_ts - generation_begin_ts).count();
   spdlog::debug("Thread #{}: Finished address generation in {} ms", thread_config->thread_num, generation_duration_us);
 
-  bool is_last;
-  uint16_t& threads_remaining = thread_config->execution->threads_remaining;
-  {
-    std::lock_guard<std::mutex> gen_lock{thread_config->execution->generation_lock};
-    threads_remaining -= 1;
-    is_last = threads_remaining == 0;
+  // Chunks are stolen by any thread, so the write data belongs to the executing thread and not to the chunk. It is
+  // filled before the cache state is prepared and before the threads start together.
+  const std::unique_ptr<WriteDataBuffer> write_data =
+      create_write_data(config, thread_config->thread_num, max_access_size);
+
+  if (config.cache_state != CacheState::None) {
+    prepare_cache_state(thread_config, config);
   }
+  wait_for_all_threads(thread_config->execution);
 
-  if (is_last) {
-    thread_config->execution->generation_done.notify_all();
-  } else {
-    std::unique_lock<std::mutex> gen_lock{thread_config->execution->generation_lock};
-    thread_config->execution->generation_done.wait(gen_lock, [&] { return threads_remaining == 0; });
+  // Chunks are stolen by any thread, so each thread follows its own schedule, independent of the chunks it runs.
+  std::unique_ptr<ArrivalSchedule> schedule;
+  if (config.is_rate_limited()) {
+    schedule = std::make_unique<ArrivalSchedule>(thread_config->execution->thread_target_ops_per_second,
+                                                 config.arrival_pattern, seed);
   }
 
-  // Generation is done in all threads, start execution
+  // Generation is done in all threads, start execution. The sub-benchmarks of a parallel benchmark also wait for each
+  // other, so that their measurements overlap from the start.
+  BenchmarkExecution* execution = thread_config->execution;
+  std::unique_ptr<DirtyLineCounter> dirty_line_counter;
+  if (thread_config->dirty_line_hits != nullptr) {
+    dirty_line_counter = std::make_unique<DirtyLineCounter>();
+  }
+  if (execution->parallel_sync != nullptr) {
+    wait_for_parallel_start(execution->parallel_sync);
+  }
+  if (dirty_line_counter) {
+    dirty_line_counter->start();
+  }
   const auto execution_begin_ts = std::chrono::steady_clock::now();
-  std::atomic<uint64_t>* io_position = &thread_config->execution->io_position;
+  std::atomic<uint64_t>* io_position = &execution->io_position;
+  if (schedule) {
+    schedule->start(execution_begin_ts);
+  }
+  if (execution->run_until_stopped) {
+    signal_execution_start(execution);
+  }
 
-  uint64_t num_executed_operations;
-  if (config.run_time == 0) {
-    num_executed_operations = run_fixed_sized_benchmark(&thread_config->execution->io_operations, io_position);
+  const std::atomic<bool>* overlap_ended =
+      execution->parallel_sync != nullptr ? &execution->parallel_sync->overlap_ended : nullptr;
+  AccessedBytes accessed_bytes;
+  if (config.run_time == 0 && !execution->run_until_stopped) {
+    accessed_bytes = run_fixed_sized_benchmark(&execution->io_operations, io_position,
+                                               thread_config->size_bucket_counters, write_data.get(), schedule.get(),
+                                               thread_config->operation_latencies, overlap_ended,
+                                               thread_config->overlap_operation_size);
   } else {
-    const auto execution_end = execution_begin_ts + std::chrono::seconds{config.run_time};
-    num_executed_operations =
-        run_duration_based_benchmark(&thread_config->execution->io_operations, io_position, execution_end);
+    const auto execution_end = execution->run_until_stopped
+                                   ? std::chrono::steady_clock::time_point::max()
+                                   : execution_begin_ts + std::chrono::seconds{config.run_time};
+    accessed_bytes = run_duration_based_benchmark(&execution->io_operations, io_position, execution_end,
+                                                  &execution->is_stopped, thread_config->size_bucket_counters,
+                                                  write_data.get(), schedule.get(), thread_config->operation_latencies,
+                                                  overlap_ended, thread_config->overlap_operation_size);
+  }
+  if (execution->parallel_sync != nullptr) {
+    end_overlap(execution->parallel_sync);
+  }
+  if (dirty_line_counter) {
+    *thread_config->dirty_line_hits = dirty_line_counter->stop();
   }
 
   const auto execution_end_ts = std::chrono::steady_clock::now();
@@ -381,15 +872,92 @@ void Benchmark::run_in_thread(ThreadRunConfig* thread_config, const BenchmarkCon
       std::chrono::duration_cast<std::chrono::milliseconds>(execution_end_ts - execution_begin_ts);
   spdlog::debug("Thread #{}: Finished execution in {} ms", thread_config->thread_num, execution_duration.count());
 
-  const uint64_t chunk_size = config.access_size * thread_config->num_ops_per_chunk;
-  *(thread_config->total_operation_size) = num_executed_operations * chunk_size;
+  *(thread_config->total_operation_size) = accessed_bytes.total;
+  if (thread_config->read_operation_size != nullptr) {
+    *(thread_config->read_operation_size) = accessed_bytes.read;
+  }
   *(thread_config->total_operation_duration) = ExecutionDuration{execution_begin_ts, execution_end_ts};
 }
 
-uint64_t Benchmark::run_fixed_sized_benchmark(std::vector<IoOperation>* io_operations,
-                                              std::atomic<uint64_t>* io_position) {
+void Benchmark::prepare_cache_state(ThreadRunConfig* thread_config, const BenchmarkConfig& config) {
+  const auto begin_ts = std::chrono::steady_clock::now();
+  for (const RegionPartition& range : thread_config->cache_state_ranges) {
+    if (config.cache_state == CacheState::Cold) {
+      rw_ops::evict_range(range.start_addr, range.size);
+    } else {
+      rw_ops::touch_range(range.start_addr, range.size);
+    }
+  }
+  const auto end_ts = std::chrono::steady_clock::now();
+  *thread_config->cache_state_duration = end_ts - begin_ts;
+  spdlog::debug("Thread #{}: Prepared {} cache in {} ms", thread_config->thread_num,
+                utils::get_enum_as_string(ConfigEnums::str_to_cache_state, config.cache_state),
+                std::chrono::duration_cast<std::chrono::milliseconds>(end_ts - begin_ts).count());
+}
+
+void Benchmark::wait_for_all_threads(BenchmarkExecution* execution) {
+  bool is_last;
+  uint16_t& threads_remaining = execution->threads_remaining;
+  {
+    std::lock_guard<std::mutex> gen_lock{execution->generation_lock};
+    threads_remaining -= 1;
+    is_last = threads_remaining == 0;
+  }
+
+  if (is_last) {
+    execution->generation_done.notify_all();
+  } else {
+    std::unique_lock<std::mutex> gen_lock{execution->generation_lock};
+    execution->generation_done.wait(gen_lock, [&] { return threads_remaining == 0; });
+  }
+}
+
+void Benchmark::signal_execution_start(BenchmarkExecution* execution) {
+  {
+    std::lock_guard<std::mutex> gen_lock{execution->generation_lock};
+    execution->threads_executing += 1;
+  }
+  execution->generation_done.notify_all();
+}
+
+void Benchmark::wait_for_execution_start(BenchmarkExecution* execution, const uint16_t number_threads) {
+  std::unique_lock<std::mutex> gen_lock{execution->generation_lock};
+  execution->generation_done.wait(gen_lock, [&] { return execution->threads_executing == number_threads; });
+}
+
+void Benchmark::wait_for_parallel_start(ParallelSync* parallel_sync) {
+  bool is_last;
+  uint32_t& threads_remaining = parallel_sync->threads_remaining;
+  {
+    std::lock_guard<std::mutex> start_lock{parallel_sync->start_lock};
+    threads_remaining -= 1;
+    is_last = threads_remaining == 0;
+  }
+
+  if (is_last) {
+    parallel_sync->all_started.notify_all();
+  } else {
+    std::unique_lock<std::mutex> start_lock{parallel_sync->start_lock};
+    parallel_sync->all_started.wait(start_lock, [&] { return threads_remaining == 0; });
+  }
+}
+
+void Benchmark::end_overlap(ParallelSync* parallel_sync) {
+  const auto end_ts = std::chrono::steady_clock::now();
+  if (!parallel_sync->overlap_ended.exchange(true)) {
+    parallel_sync->overlap_end = end_ts;
+  }
+}
+
+AccessedBytes Benchmark::run_fixed_sized_benchmark(std::vector<IoOperation>* io_operations,
+                                                   std::atomic<uint64_t>* io_position,
+                                                   SizeBucketCounters* size_bucket_counters,
+                                                   WriteDataBuffer* write_data, ArrivalSchedule* schedule,
+                                                   std::vector<uint64_t>* latencies,
+                                                   const std::atomic<bool>* overlap_ended, uint64_t* overlap_size) {
   const uint64_t total_num_operations = io_operations->size();
-  uint64_t num_executed_operations = 0;
+  AccessedBytes accessed_bytes{};
+  bool is_in_overlap = overlap_size != nullptr;
 
   while (true) {
     const uint64_t op_pos = io_position->fetch_add(1);
@@ -397,32 +965,63 @@ uint64_t Benchmark::run_fixed_sized_benchmark(std::vector<IoOperation>* io_opera
       break;
     }
 
-    (*io_operations)[op_pos].run();
-    num_executed_operations++;
+    IoOperation& io_operation = (*io_operations)[op_pos];
+    io_operation.run(write_data, schedule, latencies);
+    accessed_bytes.total += io_operation.total_size();
+    accessed_bytes.read += io_operation.read_size();
+    if (size_bucket_counters != nullptr) {
+      size_bucket_counters->add(io_operation.size_bucket_counters_);
+    }
+    if (is_in_overlap && overlap_ended->load(std::memory_order_relaxed)) {
+      *overlap_size = accessed_bytes.total;
+      is_in_overlap = false;
+    }
   }
 
-  return num_executed_operations;
+  if (is_in_overlap) {
+    *overlap_size = accessed_bytes.total;
+  }
+  return accessed_bytes;
 }
 
-uint64_t Benchmark::run_duration_based_benchmark(std::vector<IoOperation>* io_operations,
-                                                 std::atomic<uint64_t>* io_position,
-                                                 std::chrono::steady_clock::time_point execution_end) {
+AccessedBytes Benchmark::run_duration_based_benchmark(std::vector<IoOperation>* io_operations,
+                                                      std::atomic<uint64_t>* io_position,
+                                                      std::chrono::steady_clock::time_point execution_end,
+                                                      const std::atomic<bool>* is_stopped,
+                                                      SizeBucketCounters* size_bucket_counters,
+                                                      WriteDataBuffer* write_data, ArrivalSchedule* schedule,
+                                                      std::vector<uint64_t>* latencies,
+                                                      const std::atomic<bool>* overlap_ended, uint64_t* overlap_size) {
   const uint64_t total_num_operations = io_operations->size();
-  uint64_t num_executed_operations = 0;
+  AccessedBytes accessed_bytes{};
+  bool is_in_overlap = overlap_size != nullptr;
 
   while (true) {
     const uint64_t work_package = io_position->fetch_add(1) % total_num_operations;
 
-    (*io_operations)[work_package].run();
-    num_executed_operations++;
+    IoOperation& io_operation = (*io_operations)[work_package];
+    io_operation.run(write_data, schedule, latencies);
+    accessed_bytes.total += io_operation.total_size();
+    accessed_bytes.read += io_operation.read_size();
+    if (size_bucket_counters != nullptr) {
+      size_bucket_counters->add(io_operation.size_bucket_counters_);
+    }
+
+    if (is_in_overlap && overlap_ended->load(std::memory_order_relaxed)) {
+      *overlap_size = accessed_bytes.total;
+      is_in_overlap = false;
+    }
 
     const auto current_time = std::chrono::steady_clock::now();
-    if (current_time > execution_end) {
+    if (current_time > execution_end || is_stopped->load(std::memory_order_relaxed)) {
       break;
     }
   }
 
-  return num_executed_operations;
+  if (is_in_overlap) {
+    *overlap_size = accessed_bytes.total;
+  }
+  return accessed_bytes;
 }
 
 const std::vector<BenchmarkConfig>& Benchmark::get_benchmark_configs() const { return configs_; }
@@ -437,11 +1036,83 @@ const std::vector<char*>& Benchmark::get_pmem_data() const { return pmem_data_;
 
 const std::vector<char*>& Benchmark::get_dram_data() const { return dram_data_; }
 
+const std::vector<std::vector<char*>>& Benchmark::get_custom_region_data() const { return custom_region_data_; }
+
 const std::vector<std::vector<ThreadRunConfig>>& Benchmark::get_thread_configs() const { return thread_configs_; }
 const std::vector<std::unique_ptr<BenchmarkResult>>& Benchmark::get_benchmark_results() const { return results_; }
 
 nlohmann::json Benchmark::get_json_config(uint8_t config_index) { return configs_[config_index].as_json(); }
 
+void Benchmark::set_up_steps(const size_t num_data_regions) {
+  pools_.resize(configs_.size());
+  thread_configs_.resize(configs_.size());
+  for (size_t config_idx = 0; config_idx < configs_.size(); ++config_idx) {
+    const size_t data_idx = config_idx % num_data_regions;
+    single_set_up(configs_[config_idx], pmem_data_[data_idx], dram_data_[data_idx], custom_region_data_[data_idx],
+                  executions_[config_idx].get(), results_[config_idx].get(), &pools_[config_idx],
+                  &thread_configs_[config_idx]);
+  }
+}
+
+void Benchmark::start_step(const size_t config_idx) {
+  signal(SIGSEGV, step_thread_error_handler);
+  const BenchmarkConfig& config = configs_[config_idx];
+  for (size_t thread_index = 0; thread_index < config.number_threads; thread_index++) {
+    pools_[config_idx].emplace_back(&run_in_thread, &thread_configs_[config_idx][thread_index], std::ref(config));
+  }
+}
+
+bool Benchmark::finish_step(const size_t config_idx) {
+  for (std::thread& thread : pools_[config_idx]) {
+    if (step_thread_error) {
+      utils::print_segfault_error();
+      return false;
+    }
+    thread.join();
+  }
+
+  executions_[config_idx]->io_operations = std::vector<IoOperation>{};
+  return true;
+}
+
+bool Benchmark::run_steps(const std::function<void(size_t)>& on_step_finished) {
+  for (size_t config_idx = 0; config_idx < configs_.size(); ++config_idx) {
+    start_step(config_idx);
+    if (!finish_step(config_idx)) {
+      return false;
+    }
+    on_step_finished(config_idx);
+  }
+  return true;
+}
+
+std::unique_ptr<SingleBenchmark> Benchmark::run_single_config(const BenchmarkConfig& config,
+                                                              const std::filesystem::path& shared_file) const {
+  std::vector<std::unique_ptr<BenchmarkExecution>> executions{};
+  executions.push_back(std::make_unique<BenchmarkExecution>());
+  std::vector<std::unique_ptr<BenchmarkResult>> results{};
+  results.push_back(std::make_unique<BenchmarkResult>(config));
+
+  // Generate unique file for benchmarks that write or reuse existing file for read-only benchmarks.
+  auto benchmark = config.contains_write_op()
+                       ? std::make_unique<SingleBenchmark>(benchmark_name_, config, std::move(executions),
+                                                           std::move(results))
+                       : std::make_unique<SingleBenchmark>(benchmark_name_, config, std::move(executions),
+                                                           std::move(results), shared_file);
+  benchmark->create_data_files();
+  benchmark->set_up();
+  if (!benchmark->run()) {
+    return nullptr;
+  }
+  return benchmark;
+}
+
+void Benchmark::remove_shared_file(const BenchmarkConfig& config, const std::filesystem::path& shared_file) {
+  if (config.is_pmem && std::filesystem::exists(shared_file)) {
+    std::filesystem::remove(shared_file);
+  }
+}
+
 void Benchmark::tear_down(bool force) {
   executions_.clear();
   results_.clear();
@@ -462,10 +1133,29 @@ void Benchmark::tear_down(bool force) {
       dram_data_[index] = nullptr;
     }
   }
+  for (size_t index = 0; index < custom_region_data_.size(); index++) {
+    const std::vector<CustomRegion>& regions = configs_[index].custom_regions;
+    for (size_t region_idx = 0; region_idx < custom_region_data_[index].size(); region_idx++) {
+      if (custom_region_data_[index][region_idx] != nullptr) {
+        munmap(custom_region_data_[index][region_idx], regions[region_idx].size);
+        custom_region_data_[index][region_idx] = nullptr;
+      }
+      const MemoryRegion& region_file = custom_region_files_[index][region_idx];
+      if (configs_[index].is_pmem && region_file.owns_pmem_file) {
+        std::filesystem::remove(region_file.pmem_file);
+      }
+    }
+  }
 }
 
 const std::unordered_map<std::string, BenchmarkType> BenchmarkEnums::str_to_benchmark_type{
-    {"single", BenchmarkType::Single}, {"parallel", BenchmarkType::Parallel}};
+    {"single", BenchmarkType::Single},
+    {"parallel", BenchmarkType::Parallel},
+    {"loaded_latency", BenchmarkType::LoadedLatency},
+    {"slo_search", BenchmarkType::SloSearch},
+    {"matrix_search", BenchmarkType::MatrixSearch},
+    {"thread_ramp", BenchmarkType::ThreadRamp},
+    {"phased", BenchmarkType::Phased}};
 
 BenchmarkResult::BenchmarkResult(BenchmarkConfig config) : config{std::move(config)}, latency_hdr{nullptr} {
   // Initialize HdrHistrogram
@@ -502,7 +1192,11 @@ nlohmann::json BenchmarkResult::get_result_as_json() const {
   std::chrono::steady_clock::time_point earliest_begin = total_operation_durations[0].begin;
   std::chrono::steady_clock::time_point latest_end = total_operation_durations[0].end;
 
+  // With variable access sizes, the number of operations cannot be derived from the accessed bytes.
+  const bool has_variable_access_sizes = !size_bucket_counters.empty();
+  const bool is_mixed_read_write = !read_operation_sizes.empty();
   uint64_t total_size = 0;
+  uint64_t total_read_size = 0;
   std::vector<double> per_thread_bandwidth(config.number_threads);
   nlohmann::json per_thread_results = nlohmann::json::array();
 
@@ -522,6 +1216,7 @@ nlohmann::json BenchmarkResult::get_result_as_json() const {
     spdlog::debug(" └─ Duration (s): {:.5f}", thread_duration_s);
 
     total_size += thread_op_size;
+    total_read_size += is_mixed_read_write ? read_operation_sizes[thread_num] : 0;
     earliest_begin = std::min(earliest_begin, thread_timestamps.begin);
     latest_end = std::max(latest_end, thread_timestamps.end);
 
@@ -529,6 +1224,22 @@ nlohmann::json BenchmarkResult::get_result_as_json() const {
     thread_results["bandwidth"] = thread_bandwidth;
     thread_results["execution_time"] = thread_duration_s;
     thread_results["accessed_bytes"] = thread_op_size;
+    if (is_mixed_read_write) {
+      const uint64_t thread_read_size = read_operation_sizes[thread_num];
+      const uint64_t thread_write_size = thread_op_size - thread_read_size;
+      thread_results["read_accessed_bytes"] = thread_read_size;
+      thread_results["write_accessed_bytes"] = thread_write_size;
+      thread_results["read_bandwidth"] = get_bandwidth(thread_read_size, thread_duration);
+      thread_results["write_bandwidth"] = get_bandwidth(thread_write_size, thread_duration);
+    }
+    if (!cache_state_durations.empty()) {
+      thread_results["cache_state_time"] = std::chrono::duration<double>(cache_state_durations[thread_num]).count();
+    }
+    if (has_variable_access_sizes) {
+      const uint64_t thread_num_ops = size_bucket_counters[thread_num].total_operations();
+      thread_results["num_operations"] = thread_num_ops;
+      thread_results["ops_per_second"] = static_cast<double>(thread_num_ops) / thread_duration_s;
+    }
     per_thread_results.emplace_back(std::move(thread_results));
   }
 
@@ -555,6 +1266,44 @@ nlohmann::json BenchmarkResult::get_result_as_json() const {
   bandwidth_results["thread_bandwidth_std_dev"] = bandwidth_stddev;
   bandwidth_results["threads"] = per_thread_results;
 
+  if (is_mixed_read_write) {
+    // Reads and writes share the execution time, so their bandwidths add up to the total bandwidth.
+    const uint64_t total_write_size = total_size - total_read_size;
+    bandwidth_results["read_accessed_bytes"] = total_read_size;
+    bandwidth_results["write_accessed_bytes"] = total_write_size;
+    bandwidth_results["read_bandwidth"] = get_bandwidth(total_read_size, execution_time);
+    bandwidth_results["write_bandwidth"] = get_bandwidth(total_write_size, execution_time);
+  }
+
+  if (has_variable_access_sizes) {
+    uint64_t total_num_ops = 0;
+    for (const SizeBucketCounters& thread_counters : size_bucket_counters) {
+      total_num_ops += thread_counters.total_operations();
+    }
+    bandwidth_results["num_operations"] = total_num_ops;
+    bandwidth_results["ops_per_second"] = static_cast<double>(total_num_ops) / execution_time_s.count();
+    bandwidth_results["size_buckets"] = SizeBucketCounters::as_json(size_bucket_counters, execution_time_s.count());
+  }
+
+  if (!cache_state_durations.empty()) {
+    bandwidth_results["cache_state_time"] = cache_state_time_s(cache_state_durations);
+  }
+
+  if (!operation_latencies.empty()) {
+    // Each access of a rate-limited benchmark has a latency, so their number is the number of operations.
+    uint64_t total_num_ops = 0;
+    for (const std::vector<uint64_t>& thread_latencies : operation_latencies) {
+      total_num_ops += thread_latencies.size();
+      for (const uint64_t latency : thread_latencies) {
+        hdr_record_value(latency_hdr, static_cast<int64_t>(latency));
+      }
+    }
+    bandwidth_results["target_ops_per_second"] = target_ops_per_second;
+    bandwidth_results["num_operations"] = total_num_ops;
+    bandwidth_results["ops_per_second"] = static_cast<double>(total_num_ops) / execution_time_s.count();
+    bandwidth_results["latency"] = hdr_histogram_to_json(latency_hdr);
+  }
+
   result["results"] = bandwidth_results;
 
   if (execution_time < std::chrono::seconds{1}) {
@@ -593,6 +1342,9 @@ nlohmann::json BenchmarkResult::get_custom_results_as_json() const {
     thread_results["num_operations"] = num_ops;
     thread_results["execution_time"] = thread_duration_s;
     thread_results["ops_per_second"] = thread_ops_per_s;
+    if (!cache_state_durations.empty()) {
+      thread_results["cache_state_time"] = std::chrono::duration<double>(cache_state_durations[thread_num]).count();
+    }
     per_thread_results.emplace_back(std::move(thread_results));
   }
 
@@ -609,8 +1361,47 @@ nlohmann::json BenchmarkResult::get_custom_results_as_json() const {
   custom_op_results["thread_ops_per_second_avg"] = avg_ops_per_s;
   custom_op_results["thread_ops_per_second_std_dev"] = ops_per_s_std_dev;
   custom_op_results["threads"] = per_thread_results;
+  if (!cache_state_durations.empty()) {
+    custom_op_results["cache_state_time"] = cache_state_time_s(cache_state_durations);
+  }
+
+  // Number of operations of each chain in a mixture. Without a mixture, all operations belong to a single chain.
+  const std::vector<WeightedCustomChain> chains = config.get_custom_chains();
+  const size_t num_chains = chains.size();
+  std::vector<uint64_t> num_chain_ops(num_chains, 0);
+  for (size_t entry = 0; entry < custom_chain_operations.size(); ++entry) {
+    num_chain_ops[entry % num_chains] += custom_chain_operations[entry];
+  }
+
+  if (!size_bucket_counters.empty()) {
+    // Each operation chain accesses the fixed-sized ops once plus the variable-sized ops recorded in the counters.
+    // Prefetches and compute ops do not count as accesses.
+    uint64_t total_size = 0;
+    for (size_t chain_idx = 0; chain_idx < num_chains; ++chain_idx) {
+      uint64_t fixed_size_per_chain = 0;
+      for (const CustomOp& op : chains[chain_idx].operations) {
+        const bool is_access = !op.has_variable_size && op.type != Operation::Prefetch && !op.is_compute();
+        fixed_size_per_chain += is_access ? op.size : 0;
+      }
+      total_size += num_chain_ops[chain_idx] * fixed_size_per_chain;
+    }
+
+    for (const SizeBucketCounters& thread_counters : size_bucket_counters) {
+      total_size += thread_counters.total_bytes();
+    }
+
+    custom_op_results["accessed_bytes"] = total_size;
+    custom_op_results["bandwidth"] = get_bandwidth(total_size, execution_time);
+    custom_op_results["size_buckets"] = SizeBucketCounters::as_json(size_bucket_counters, execution_time_s.count());
+  }
+
+  if (config.is_rate_limited()) {
+    custom_op_results["target_ops_per_second"] = target_ops_per_second;
+  }
 
-  if (config.latency_sample_frequency > 0) {
+  // Rate-limited benchmarks measure the latency of each operation.
+  const bool has_latencies = config.latency_sample_frequency > 0 || config.is_rate_limited();
+  if (has_latencies) {
     for (const std::vector<uint64_t>& thread_latencies : custom_operation_latencies) {
       for (const uint64_t latency : thread_latencies) {
         hdr_record_value(latency_hdr, static_cast<int64_t>(latency));
@@ -619,9 +1410,80 @@ nlohmann::json BenchmarkResult::get_custom_results_as_json() const {
     custom_op_results["latency"] = hdr_histogram_to_json(latency_hdr);
   }
 
+  if (!custom_compute_overlaps.empty() && config.custom_chain_mixture.empty()) {
+    custom_op_results["compute_overlap"] = compute_overlap_to_json(custom_compute_overlaps, 0, num_chains);
+  }
+
+  if (!config.custom_chain_mixture.empty()) {
+    nlohmann::json chain_results = nlohmann::json::array();
+    for (size_t chain_idx = 0; chain_idx < num_chains; ++chain_idx) {
+      nlohmann::json chain_result;
+      chain_result["custom_operations"] = CustomOp::all_to_string(chains[chain_idx].operations);
+      chain_result["weight"] = chains[chain_idx].weight;
+      chain_result["num_operations"] = num_chain_ops[chain_idx];
+      chain_result["ops_per_second"] = static_cast<double>(num_chain_ops[chain_idx]) / execution_time_s.count();
+
+      if (has_latencies) {
+        hdr_histogram* chain_latency_hdr = nullptr;
+        hdr_init(1, 100000000000, 3, &chain_latency_hdr);
+        for (size_t entry = chain_idx; entry < custom_operation_latencies.size(); entry += num_chains) {
+          for (const uint64_t latency : custom_operation_latencies[entry]) {
+            hdr_record_value(chain_latency_hdr, static_cast<int64_t>(latency));
+          }
+        }
+        chain_result["latency"] = hdr_histogram_to_json(chain_latency_hdr);
+        hdr_close(chain_latency_hdr);
+      }
+
+      const std::vector<CustomOp>& operations = chains[chain_idx].operations;
+      const bool has_compute_ops =
+          std::any_of(operations.begin(), operations.end(), [](const CustomOp& op) { return op.is_compute(); });
+      if (!custom_compute_overlaps.empty() && has_compute_ops) {
+        chain_result["compute_overlap"] = compute_overlap_to_json(custom_compute_overlaps, chain_idx, num_chains);
+      }
+      chain_results.emplace_back(std::move(chain_result));
+    }
+    custom_op_results["chains"] = chain_results;
+  }
+
   nlohmann::json result;
   result["results"] = custom_op_results;
   return result;
 }
 
+nlohmann::json BenchmarkResult::get_overlap_as_json(const std::chrono::steady_clock::time_point overlap_begin,
+                                                    const std::chrono::steady_clock::time_point overlap_end) const {
+  uint64_t total_size = 0;
+  uint64_t overlap_size = 0;
+  std::chrono::steady_clock::time_point latest_end = overlap_end;
+  for (uint64_t thread_num = 0; thread_num < config.number_threads; ++thread_num) {
+    total_size += total_operation_sizes[thread_num];
+    overlap_size += overlap_operation_sizes[thread_num];
+    latest_end = std::max(latest_end, total_operation_durations[thread_num].end);
+  }
+
+  // Custom operations count operations instead of Bytes, so they report their throughput in ops/s.
+  const bool is_custom_execution = config.exec_mode == Mode::Custom;
+  auto window_as_json = [&](const uint64_t size, const std::chrono::steady_clock::duration duration) {
+    const double duration_s = std::chrono::duration<double>(duration).count();
+    nlohmann::json window;
+    window["execution_time"] = duration_s;
+    if (is_custom_execution) {
+      window["num_operations"] = size;
+      window["ops_per_second"] = duration_s > 0 ? static_cast<double>(size) / duration_s : 0.0;
+    } else {
+      window["accessed_bytes"] = size;
+      window["bandwidth"] = duration_s > 0 ? get_bandwidth(size, duration) : 0.0;
+    }
+    return window;
+  };
+
+  nlohmann::json result;
+  // Tiny workloads may finish a thread before the last thread took its begin timestamp.
+  const auto overlap_duration = std::max(overlap_end - overlap_begin, std::chrono::steady_clock::duration::zero());
+  result["overlap"] = window_as_json(overlap_size, overlap_duration);
+  result["solo_tail"] = window_as_json(total_size - overlap_size, latest_end - overlap_end);
+  return result;
+}
+
 }  // namespace perma
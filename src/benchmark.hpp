@@ -5,14 +5,18 @@
 #include <chrono>
 #include <condition_variable>
 #include <filesystem>
+#include <functional>
 #include <json.hpp>
 #include <map>
 #include <random>
 #include <utility>
 #include <vector>
 
+#include "arrival_schedule.hpp"
 #include "benchmark_config.hpp"
+#include "data_pattern.hpp"
 #include "io_operation.hpp"
+#include "size_distribution.hpp"
 #include "utils.hpp"
 
 namespace perma {
@@ -26,7 +30,7 @@ struct MemoryRegion {
       : pmem_file{std::move(pmem_file)}, owns_pmem_file{owns_pmem_file}, is_dram{is_dram} {};
 };
 
-enum BenchmarkType { Single, Parallel };
+enum BenchmarkType { Single, Parallel, LoadedLatency, SloSearch, MatrixSearch, ThreadRamp, Phased };
 
 struct BenchmarkEnums {
   static const std::unordered_map<std::string, BenchmarkType> str_to_benchmark_type;
@@ -39,6 +43,27 @@ struct ExecutionDuration {
   std::chrono::steady_clock::duration duration() const { return end - begin; }
 };
 
+// Number of Bytes accessed by a thread. Reads are tracked separately to report the bandwidth of mixed workloads.
+struct AccessedBytes {
+  uint64_t total = 0;
+  uint64_t read = 0;
+};
+
+// Shared by the threads of all sub-benchmarks of a parallel benchmark. They start their measurement together, so that
+// the sub-benchmarks interfere from the first access on. The overlap, in which all of them execute, ends once the
+// first thread finishes.
+struct ParallelSync {
+  std::mutex start_lock{};
+  std::condition_variable all_started{};
+  uint32_t threads_remaining = 0;
+
+  std::atomic<bool> overlap_ended = false;
+  std::chrono::steady_clock::time_point overlap_end{};
+
+  // Sub-benchmarks in a shared region count the loads that hit lines, which another thread modified.
+  bool count_dirty_line_hits = false;
+};
+
 struct BenchmarkExecution {
   // Owning instance for thread synchronization
   std::mutex generation_lock{};
@@ -52,6 +77,39 @@ struct BenchmarkExecution {
 
   // The main list of all IO operations to steal work from
   std::vector<IoOperation> io_operations;
+
+  // Shared table of access sizes to draw from if the benchmark has variable access sizes.
+  std::unique_ptr<AccessSizeSampler> access_size_sampler;
+
+  // Number of operations per second that each thread starts if the benchmark is rate-limited.
+  double thread_target_ops_per_second = 0;
+
+  // Loaded-latency benchmarks run the bandwidth threads until they set `is_stopped` after the latency threads are
+  // done, independent of the number of operations and the run time. Once started, these threads count themselves in
+  // `threads_executing`, which is guarded by the `generation_lock`.
+  bool run_until_stopped = false;
+  uint16_t threads_executing = 0;
+  std::atomic<bool> is_stopped = false;
+
+  // Only set if the execution is a sub-benchmark of a parallel benchmark.
+  ParallelSync* parallel_sync = nullptr;
+};
+
+// A thread's partition of a named custom region. The start address is already shifted by the alignment offset.
+struct RegionPartition {
+  char* start_addr;
+  size_t size;
+};
+
+// Number of chains that each thread runs per variant to measure the compute overlap before the timed run.
+static constexpr uint64_t NUM_OVERLAP_CALIBRATION_CHAINS = 4096;
+
+// Average duration of a chain with only its memory ops, with only its compute ops, and with all ops. If the memory and
+// compute ops overlap, the full chain is faster than the sum of both.
+struct ComputeOverlap {
+  double memory_only_ns = 0;
+  double compute_only_ns = 0;
+  double combined_ns = 0;
 };
 
 struct ThreadRunConfig {
@@ -59,6 +117,10 @@ struct ThreadRunConfig {
   char* dram_partition_start_addr;
   const size_t partition_size;
   const size_t dram_partition_size;
+  // One partition per entry in the `custom_regions` of the config.
+  const std::vector<RegionPartition> custom_region_partitions;
+  // This thread's share of all memory ranges, which it evicts or loads for the `cache_state` of the config.
+  const std::vector<RegionPartition> cache_state_ranges;
   const size_t num_threads_per_partition;
   const size_t thread_num;
   const size_t num_ops_per_chunk;
@@ -69,18 +131,40 @@ struct ThreadRunConfig {
 
   // Pointers to store performance data in.
   uint64_t* total_operation_size;
+  uint64_t* read_operation_size;
   ExecutionDuration* total_operation_duration;
+  // For custom operations, the latencies and numbers of operations of each chain in a mixture are consecutive.
   std::vector<uint64_t>* custom_op_latencies;
+  // Only set for rate-limited sequential and random execution.
+  std::vector<uint64_t>* operation_latencies;
+  uint64_t* custom_chain_operations;
+  // Only set if the custom operations contain compute ops.
+  ComputeOverlap* compute_overlaps;
+  SizeBucketCounters* size_bucket_counters;
+  // Only set if the config has a cache state.
+  std::chrono::steady_clock::duration* cache_state_duration;
+  // Only set if the execution has a parallel sync.
+  uint64_t* overlap_operation_size;
+  // Only set if the parallel sync counts dirty-line hits.
+  uint64_t* dirty_line_hits;
 
   ThreadRunConfig(char* partition_start_addr, char* dram_partition_start_addr, const size_t partition_size,
-                  const size_t dram_partition_size, const size_t num_threads_per_partition, const size_t thread_num,
-                  const size_t num_ops_per_chunk, const size_t num_chunks, const BenchmarkConfig& config,
-                  BenchmarkExecution* execution, ExecutionDuration* total_operation_duration,
-                  uint64_t* total_operation_size, std::vector<uint64_t>* custom_op_latencies)
+                  const size_t dram_partition_size, std::vector<RegionPartition> custom_region_partitions,
+                  std::vector<RegionPartition> cache_state_ranges, const size_t num_threads_per_partition,
+                  const size_t thread_num, const size_t num_ops_per_chunk, const size_t num_chunks,
+                  const BenchmarkConfig& config, BenchmarkExecution* execution,
+                  ExecutionDuration* total_operation_duration, uint64_t* total_operation_size,
+                  uint64_t* read_operation_size, std::vector<uint64_t>* custom_op_latencies,
+                  std::vector<uint64_t>* operation_latencies, uint64_t* custom_chain_operations,
+                  ComputeOverlap* compute_overlaps,
+                  SizeBucketCounters* size_bucket_counters, std::chrono::steady_clock::duration* cache_state_duration,
+                  uint64_t* overlap_operation_size, uint64_t* dirty_line_hits)
       : partition_start_addr{partition_start_addr},
         dram_partition_start_addr{dram_partition_start_addr},
         partition_size{partition_size},
         dram_partition_size{dram_partition_size},
+        custom_region_partitions{std::move(custom_region_partitions)},
+        cache_state_ranges{std::move(cache_state_ranges)},
         num_threads_per_partition{num_threads_per_partition},
         thread_num{thread_num},
         num_ops_per_chunk{num_ops_per_chunk},
@@ -89,7 +173,15 @@ struct ThreadRunConfig {
         execution{execution},
         total_operation_duration{total_operation_duration},
         total_operation_size{total_operation_size},
-        custom_op_latencies{custom_op_latencies} {}
+        read_operation_size{read_operation_size},
+        custom_op_latencies{custom_op_latencies},
+        operation_latencies{operation_latencies},
+        custom_chain_operations{custom_chain_operations},
+        compute_overlaps{compute_overlaps},
+        size_bucket_counters{size_bucket_counters},
+        cache_state_duration{cache_state_duration},
+        overlap_operation_size{overlap_operation_size},
+        dirty_line_hits{dirty_line_hits} {}
 };
 
 struct BenchmarkResult {
@@ -98,18 +190,49 @@ struct BenchmarkResult {
 
   nlohmann::json get_result_as_json() const;
   nlohmann::json get_custom_results_as_json() const;
+  // Splits the results of a parallel sub-benchmark into the overlap with all other sub-benchmarks and its solo tail.
+  nlohmann::json get_overlap_as_json(std::chrono::steady_clock::time_point overlap_begin,
+                                     std::chrono::steady_clock::time_point overlap_end) const;
 
   // Result vectors for raw operation workloads
   std::vector<uint64_t> total_operation_sizes;
   std::vector<ExecutionDuration> total_operation_durations;
 
-  // Result vectors for custom operation workloads
+  // Per-thread read sizes for mixed read/write workloads. The write size is the difference to the total size.
+  std::vector<uint64_t> read_operation_sizes;
+
+  // Result vectors for custom operation workloads. For a mixture of chains, thread t's entry of chain c is at index
+  // t * num_chains + c.
   std::vector<std::vector<uint64_t>> custom_operation_latencies;
+  std::vector<uint64_t> custom_chain_operations;
+  std::vector<ComputeOverlap> custom_compute_overlaps;
+
+  // Per-thread breakdown by access size for workloads with variable access sizes
+  std::vector<SizeBucketCounters> size_bucket_counters;
+
+  // Per-thread latencies of each access in rate-limited sequential and random workloads. Rate-limited custom workloads
+  // store their latencies in the `custom_operation_latencies`.
+  std::vector<std::vector<uint64_t>> operation_latencies;
+
+  // Number of operations per second that all threads together start if the benchmark is rate-limited.
+  double target_ops_per_second = 0;
+
+  // Per-thread time to evict or warm up the caches before the measurement if the config has a cache state.
+  std::vector<std::chrono::steady_clock::duration> cache_state_durations;
+
+  // Per-thread accessed bytes or, for custom operations, number of operations until the overlap of a parallel benchmark
+  // ended.
+  std::vector<uint64_t> overlap_operation_sizes;
+
+  // Per-thread number of loads that hit a cache line, which a thread on another core modified.
+  std::vector<uint64_t> dirty_line_hits;
 
   hdr_histogram* latency_hdr = nullptr;
   const BenchmarkConfig config;
 };
 
+class SingleBenchmark;
+
 class Benchmark {
  public:
   Benchmark(std::string benchmark_name, BenchmarkType benchmark_type, std::vector<MemoryRegion> memory_regions,
@@ -146,7 +269,7 @@ class Benchmark {
   virtual nlohmann::json get_result_as_json() = 0;
 
   /** Clean up after te benchmark */
-  void tear_down(bool force);
+  virtual void tear_down(bool force);
 
   /** Return the name of the benchmark. */
   const std::string& benchmark_name() const;
@@ -160,6 +283,7 @@ class Benchmark {
 
   const std::vector<char*>& get_pmem_data() const;
   const std::vector<char*>& get_dram_data() const;
+  const std::vector<std::vector<char*>>& get_custom_region_data() const;
 
   const std::vector<BenchmarkConfig>& get_benchmark_configs() const;
   const std::vector<std::vector<ThreadRunConfig>>& get_thread_configs() const;
@@ -169,21 +293,82 @@ class Benchmark {
 
  protected:
   static void single_set_up(const BenchmarkConfig& config, char* pmem_data, char* dram_data,
-                            BenchmarkExecution* execution, BenchmarkResult* result, std::vector<std::thread>* pool,
+                            const std::vector<char*>& custom_region_data, BenchmarkExecution* execution,
+                            BenchmarkResult* result, std::vector<std::thread>* pool,
                             std::vector<ThreadRunConfig>* thread_config);
 
-  static char* create_pmem_data_file(const BenchmarkConfig& config, const MemoryRegion& memory_region);
-  static char* create_dram_data(const BenchmarkConfig& config, size_t memory_range);
+  static char* create_pmem_data_file(const BenchmarkConfig& config, const MemoryRegion& memory_region,
+                                     uint64_t memory_range);
+  // If `numa_node` is not negative, the pages are bound to this NUMA node before they are first accessed.
+  static char* create_dram_data(const BenchmarkConfig& config, size_t memory_range, int32_t numa_node = -1);
+
+  // Creates the data of each entry in the `custom_regions`. PMem regions get their own file in the PMem directory,
+  // which is added to `region_files`.
+  static std::vector<char*> create_custom_region_data(const BenchmarkConfig& config,
+                                                      std::vector<MemoryRegion>* region_files);
   static void prepare_data_file(char* file_data, const BenchmarkConfig& config, uint64_t memory_range,
                                 uint64_t page_size);
 
+  // Evicts or loads the thread's share of the memory ranges and records how long it took.
+  static void prepare_cache_state(ThreadRunConfig* thread_config, const BenchmarkConfig& config);
+
+  // Blocks until all threads of the execution called it.
+  static void wait_for_all_threads(BenchmarkExecution* execution);
+
+  // Marks that the calling thread of an execution with `run_until_stopped` started its measurement.
+  static void signal_execution_start(BenchmarkExecution* execution);
+
+  // Blocks the calling thread, which is not one of the execution's threads, until all `number_threads` threads of the
+  // execution called `signal_execution_start()`, i.e., until they all started their measurement.
+  static void wait_for_execution_start(BenchmarkExecution* execution, uint16_t number_threads);
+
+  // Blocks until the threads of all sub-benchmarks of a parallel benchmark called it.
+  static void wait_for_parallel_start(ParallelSync* parallel_sync);
+
+  // Ends the overlap of a parallel benchmark when the first thread calls it. Later calls do nothing.
+  static void end_overlap(ParallelSync* parallel_sync);
+
+  // Sets up each config as a step of a benchmark that runs its configs one after another on the same data, e.g., a
+  // thread ramp. Config `i` accesses the data at index `i % num_data_regions`.
+  void set_up_steps(size_t num_data_regions);
+
+  // Starts the threads of the step with `config_idx`.
+  void start_step(size_t config_idx);
+
+  // Waits for the threads of the step with `config_idx` and frees its addresses, which later steps do not need.
+  // Returns false if a thread crashed.
+  bool finish_step(size_t config_idx);
+
+  // Runs all configs as steps one after another and calls `on_step_finished` with the index of each finished step.
+  bool run_steps(const std::function<void(size_t)>& on_step_finished);
+
+  // Runs `config` as a single benchmark with its own threads and returns it to read its results, or null if the run
+  // failed. Configs that write get their own data file and read-only configs share `shared_file`, which the caller
+  // removes with `remove_shared_file()` after its last run.
+  std::unique_ptr<SingleBenchmark> run_single_config(const BenchmarkConfig& config,
+                                                     const std::filesystem::path& shared_file) const;
+  static void remove_shared_file(const BenchmarkConfig& config, const std::filesystem::path& shared_file);
+
   static void run_custom_ops_in_thread(ThreadRunConfig* thread_config, const BenchmarkConfig& config);
   static void run_in_thread(ThreadRunConfig* thread_config, const BenchmarkConfig& config);
 
-  static uint64_t run_fixed_sized_benchmark(std::vector<IoOperation>* vector, std::atomic<uint64_t>* io_position);
-  static uint64_t run_duration_based_benchmark(std::vector<IoOperation>* io_operations,
-                                               std::atomic<uint64_t>* io_position,
-                                               std::chrono::steady_clock::time_point execution_end);
+  // Both return the number of accessed bytes. The size bucket counters are only updated if they are not null. Writes
+  // store the data of the thread's `write_data` if it is not null. If the `schedule` is not null, the accesses start at
+  // the thread's intended start times and their latencies are added to `latencies`. The duration-based run also stops
+  // once `is_stopped` is set. If `overlap_size` is not null, it receives the accessed bytes of all IO operations that
+  // finished before `overlap_ended` was set.
+  static AccessedBytes run_fixed_sized_benchmark(std::vector<IoOperation>* vector, std::atomic<uint64_t>* io_position,
+                                                 SizeBucketCounters* size_bucket_counters, WriteDataBuffer* write_data,
+                                                 ArrivalSchedule* schedule, std::vector<uint64_t>* latencies,
+                                                 const std::atomic<bool>* overlap_ended, uint64_t* overlap_size);
+  static AccessedBytes run_duration_based_benchmark(std::vector<IoOperation>* io_operations,
+                                                    std::atomic<uint64_t>* io_position,
+                                                    std::chrono::steady_clock::time_point execution_end,
+                                                    const std::atomic<bool>* is_stopped,
+                                                    SizeBucketCounters* size_bucket_counters,
+                                                    WriteDataBuffer* write_data, ArrivalSchedule* schedule,
+                                                    std::vector<uint64_t>* latencies,
+                                                    const std::atomic<bool>* overlap_ended, uint64_t* overlap_size);
 
   const std::string benchmark_name_;
 
@@ -192,6 +377,11 @@ class Benchmark {
   std::vector<char*> pmem_data_;
 
   std::vector<char*> dram_data_;
+
+  // Data and PMem files of the named custom regions of each config.
+  std::vector<std::vector<char*>> custom_region_data_;
+  std::vector<std::vector<MemoryRegion>> custom_region_files_;
+
   const std::vector<BenchmarkConfig> configs_;
   std::vector<std::unique_ptr<BenchmarkResult>> results_;
   std::vector<std::unique_ptr<BenchmarkExecution>> executions_;
@@ -2,7 +2,11 @@
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <cctype>
 #include <charconv>
+#include <filesystem>
+#include <sstream>
 #include <string>
 #include <unordered_map>
 
@@ -20,6 +24,16 @@ namespace {
 
 constexpr auto VISITED_TAG = "visited";
 
+// Checks the single custom operation chain and all chains of a mixture.
+template <typename Predicate>
+bool any_custom_op(const perma::BenchmarkConfig& config, Predicate predicate) {
+  const auto& mixture = config.custom_chain_mixture;
+  return std::any_of(config.custom_operations.begin(), config.custom_operations.end(), predicate) ||
+         std::any_of(mixture.begin(), mixture.end(), [&](const perma::WeightedCustomChain& chain) {
+           return std::any_of(chain.operations.begin(), chain.operations.end(), predicate);
+         });
+}
+
 void ensure_unique_key(const YAML::Node& entry, const std::string& name) {
   if (entry.Tag() == VISITED_TAG) {
     const YAML::Mark& mark = entry.Mark();
@@ -91,6 +105,49 @@ bool get_size_if_present(YAML::Node& data, const std::string& name, const std::u
   return true;
 }
 
+void ensure_all_entries_visited(const YAML::Node& data, const size_t num_found) {
+  if (num_found == data.size()) {
+    return;
+  }
+
+  for (YAML::const_iterator entry = data.begin(); entry != data.end(); ++entry) {
+    if (entry->second.Tag() != VISITED_TAG) {
+      throw std::invalid_argument("Unknown config entry '" + entry->first.as<std::string>() +
+                                  "' in line: " + std::to_string(entry->second.Mark().line));
+    }
+  }
+}
+
+bool get_custom_regions_if_present(YAML::Node& data, std::vector<perma::CustomRegion>* regions) {
+  YAML::Node entry = data["custom_regions"];
+  if (!entry) {
+    return false;
+  }
+  ensure_unique_key(entry, "custom_regions");
+
+  if (!entry.IsMap()) {
+    throw std::invalid_argument("'custom_regions' must be a YAML map from region name to region.");
+  }
+
+  for (YAML::iterator region_entry = entry.begin(); region_entry != entry.end(); ++region_entry) {
+    perma::CustomRegion region{};
+    region.name = region_entry->first.as<std::string>();
+    YAML::Node region_data = region_entry->second;
+    size_t num_found = 0;
+    num_found +=
+        get_size_if_present(region_data, "size", perma::ConfigEnums::scale_suffix_to_factor, &region.size);
+    num_found += get_enum_if_present(region_data, "memory", perma::ConfigEnums::str_to_mem_type, &region.is_pmem);
+    num_found += get_if_present(region_data, "numa_node", &region.numa_node);
+    num_found += get_enum_if_present(region_data, "distribution", perma::ConfigEnums::str_to_random_distribution,
+                                     &region.distribution);
+    ensure_all_entries_visited(region_data, num_found);
+    regions->push_back(region);
+  }
+
+  entry.SetTag(VISITED_TAG);
+  return true;
+}
+
 }  // namespace
 
 namespace perma {
@@ -103,43 +160,74 @@ BenchmarkConfig BenchmarkConfig::decode(YAML::Node& node) {
         get_size_if_present(node, "memory_range", ConfigEnums::scale_suffix_to_factor, &bm_config.memory_range);
     num_found += get_size_if_present(node, "dram_memory_range", ConfigEnums::scale_suffix_to_factor,
                                      &bm_config.dram_memory_range);
+    num_found += get_size_if_present(node, "region_offset", ConfigEnums::scale_suffix_to_factor,
+                                     &bm_config.region_offset);
     num_found += get_size_if_present(node, "access_size", ConfigEnums::scale_suffix_to_factor, &bm_config.access_size);
+    num_found += get_size_if_present(node, "alignment_offset", ConfigEnums::scale_suffix_to_factor,
+                                     &bm_config.alignment_offset);
+    num_found += get_size_if_present(node, "min_access_size", ConfigEnums::scale_suffix_to_factor,
+                                     &bm_config.min_access_size);
+    num_found += get_size_if_present(node, "max_access_size", ConfigEnums::scale_suffix_to_factor,
+                                     &bm_config.max_access_size);
     num_found += get_size_if_present(node, "min_io_chunk_size", ConfigEnums::scale_suffix_to_factor,
                                      &bm_config.min_io_chunk_size);
+    num_found += get_size_if_present(node, "target_bandwidth", ConfigEnums::scale_suffix_to_factor,
+                                     &bm_config.target_bandwidth);
 
     num_found += get_if_present(node, "dram_operation_ratio", &bm_config.dram_operation_ratio);
+    num_found += get_if_present(node, "read_ratio", &bm_config.read_ratio);
+    num_found += get_if_present(node, "fence_every", &bm_config.fence_every);
+    num_found += get_if_present(node, "prefetch_distance", &bm_config.prefetch_distance);
     num_found += get_if_present(node, "number_operations", &bm_config.number_operations);
     num_found += get_if_present(node, "run_time", &bm_config.run_time);
     num_found += get_if_present(node, "number_partitions", &bm_config.number_partitions);
     num_found += get_if_present(node, "number_threads", &bm_config.number_threads);
     num_found += get_if_present(node, "zipf_alpha", &bm_config.zipf_alpha);
+    num_found += get_if_present(node, "lognormal_mu", &bm_config.lognormal_mu);
+    num_found += get_if_present(node, "lognormal_sigma", &bm_config.lognormal_sigma);
+    num_found += get_if_present(node, "access_size_histogram_file", &bm_config.access_size_histogram_file);
+    num_found += get_if_present(node, "data_pattern_file", &bm_config.data_pattern_file);
     num_found += get_if_present(node, "prefault_file", &bm_config.prefault_file);
     num_found += get_if_present(node, "latency_sample_frequency", &bm_config.latency_sample_frequency);
+    num_found += get_if_present(node, "mlp_width", &bm_config.mlp_width);
+    num_found += get_if_present(node, "target_ops_per_second", &bm_config.target_ops_per_second);
     num_found += get_if_present(node, "dram_huge_pages", &bm_config.dram_huge_pages);
 
     num_found += get_enum_if_present(node, "exec_mode", ConfigEnums::str_to_mode, &bm_config.exec_mode);
     num_found += get_enum_if_present(node, "operation", ConfigEnums::str_to_operation, &bm_config.operation);
     num_found += get_enum_if_present(node, "numa_pattern", ConfigEnums::str_to_numa_pattern, &bm_config.numa_pattern);
+    num_found += get_enum_if_present(node, "mix_pattern", ConfigEnums::str_to_mix_pattern, &bm_config.mix_pattern);
     num_found += get_enum_if_present(node, "random_distribution", ConfigEnums::str_to_random_distribution,
                                      &bm_config.random_distribution);
+    num_found += get_enum_if_present(node, "access_size_distribution", ConfigEnums::str_to_size_distribution,
+                                     &bm_config.access_size_distribution);
     num_found += get_enum_if_present(node, "persist_instruction", ConfigEnums::str_to_persist_instruction,
                                      &bm_config.persist_instruction);
+    num_found += get_enum_if_present(node, "read_instruction", ConfigEnums::str_to_read_instruction,
+                                     &bm_config.read_instruction);
+    num_found += get_enum_if_present(node, "checksum", ConfigEnums::str_to_checksum, &bm_config.checksum);
+    num_found +=
+        get_enum_if_present(node, "data_pattern", ConfigEnums::str_to_data_pattern, &bm_config.data_pattern);
+    num_found +=
+        get_enum_if_present(node, "cache_state", ConfigEnums::str_to_cache_state, &bm_config.cache_state);
+    num_found += get_enum_if_present(node, "arrival_pattern", ConfigEnums::str_to_arrival_pattern,
+                                     &bm_config.arrival_pattern);
 
     std::string custom_ops;
     const bool has_custom_ops = get_if_present(node, "custom_operations", &custom_ops);
     if (has_custom_ops) {
-      bm_config.custom_operations = CustomOp::all_from_string(custom_ops);
+      // Weighted chains contain a ':' after each weight.
+      if (custom_ops.find(':') != std::string::npos) {
+        bm_config.custom_chain_mixture = WeightedCustomChain::all_from_string(custom_ops);
+      } else {
+        bm_config.custom_operations = CustomOp::all_from_string(custom_ops);
+      }
       num_found++;
     }
 
-    if (num_found != node.size()) {
-      for (YAML::const_iterator entry = node.begin(); entry != node.end(); ++entry) {
-        if (entry->second.Tag() != VISITED_TAG) {
-          throw std::invalid_argument("Unknown config entry '" + entry->first.as<std::string>() +
-                                      "' in line: " + std::to_string(entry->second.Mark().line));
-        }
-      }
-    }
+    num_found += get_custom_regions_if_present(node, &bm_config.custom_regions);
+
+    ensure_all_entries_visited(node, num_found);
   } catch (const YAML::InvalidNode& e) {
     throw std::invalid_argument("Exception during config parsing: " + e.msg);
   }
@@ -155,19 +243,29 @@ void BenchmarkConfig::validate() const {
   const bool is_access_size_greater_64_byte = access_size >= 64;
   CHECK_ARGUMENT(is_access_size_greater_64_byte, "Access size must be at least 64-byte, i.e., a cache line");
 
-  // Check if access size is a power of two
+  // Power-of-two access sizes must fit exactly into the memory range. For arbitrary access sizes, e.g., 100 Byte, the
+  // trailing bytes of a partition that do not fit a full access are not accessed.
   const bool is_access_size_power_of_two = (access_size & (access_size - 1)) == 0;
-  CHECK_ARGUMENT(is_access_size_power_of_two, "Access size must be a power of 2");
 
   // Check if PMem memory range is multiple of access size
-  const bool is_memory_range_multiple_of_access_size = (memory_range % access_size) == 0;
+  const bool is_memory_range_multiple_of_access_size =
+      !is_access_size_power_of_two || (memory_range % access_size) == 0;
   CHECK_ARGUMENT(is_memory_range_multiple_of_access_size, "PMem memory range must be a multiple of access size.");
 
   // Check if DRAM memory range is multiple of access size
-  const bool is_dram_memory_range_multiple_of_access_size = (dram_memory_range % access_size) == 0;
+  const bool is_dram_memory_range_multiple_of_access_size =
+      !is_access_size_power_of_two || (dram_memory_range % access_size) == 0;
   CHECK_ARGUMENT(is_dram_memory_range_multiple_of_access_size,
                  "DRAM memory range must be a multiple of access size or 0.");
 
+  // Check if alignment offset is within the first page of a partition
+  const bool is_alignment_offset_valid = alignment_offset < utils::DRAM_PAGE_SIZE;
+  CHECK_ARGUMENT(is_alignment_offset_valid, "Alignment offset must be smaller than 4 KiB.");
+
+  // Check if the range starts at a page in a shared region
+  const bool is_region_offset_page_aligned = (region_offset % utils::DRAM_PAGE_SIZE) == 0;
+  CHECK_ARGUMENT(is_region_offset_page_aligned, "Region offset must be a multiple of 4 KiB.");
+
   // Check if set DRAM operation has random or custom mode
   const bool is_dram_operation_mode_valid = dram_operation_ratio == 0.0 || exec_mode == Mode::Random;
   CHECK_ARGUMENT(is_dram_operation_mode_valid, "DRAM operation ratio only supported in random execution.");
@@ -195,7 +293,8 @@ void BenchmarkConfig::validate() const {
                  "Number threads must be a multiple of number partitions.");
 
   // Assumption: total memory range must be evenly divisible into number of partitions
-  const bool is_partitionable = (number_partitions == 0 && ((memory_range / number_threads) % access_size) == 0) ||
+  const bool is_partitionable = !is_access_size_power_of_two ||
+                                (number_partitions == 0 && ((memory_range / number_threads) % access_size) == 0) ||
                                 (number_partitions > 0 && ((memory_range / number_partitions) % access_size) == 0);
   CHECK_ARGUMENT(is_partitionable,
                  "Total memory range must be evenly divisible into number of partitions. "
@@ -203,6 +302,7 @@ void BenchmarkConfig::validate() const {
 
   // Assumption: total memory range must be evenly divisible into number of partitions
   const bool is_dram_partitionable =
+      !is_access_size_power_of_two ||
       (number_partitions == 0 && ((dram_memory_range / number_threads) % access_size) == 0) ||
       (number_partitions > 0 && ((dram_memory_range / number_partitions) % access_size) == 0);
   CHECK_ARGUMENT(is_dram_partitionable,
@@ -248,27 +348,228 @@ void BenchmarkConfig::validate() const {
   const bool is_far_numa_node_available = numa_pattern == NumaPattern::Near || has_far_numa_nodes();
   CHECK_ARGUMENT(is_far_numa_node_available, "Cannot run far NUMA node benchmark without far NUMA nodes.");
 
-  const bool has_custom_ops = exec_mode != Mode::Custom || !custom_operations.empty();
+  const bool has_custom_ops = exec_mode != Mode::Custom || !custom_operations.empty() || !custom_chain_mixture.empty();
   CHECK_ARGUMENT(has_custom_ops, "Must specify custom_operations for custom execution.");
 
-  const bool has_no_custom_ops = exec_mode == Mode::Custom || custom_operations.empty();
+  const bool has_no_custom_ops =
+      exec_mode == Mode::Custom || (custom_operations.empty() && custom_chain_mixture.empty());
   CHECK_ARGUMENT(has_no_custom_ops, "Cannot specify custom_operations for non-custom execution.");
 
+  // Check if the chains of a mixture have valid weights
+  const bool has_single_chain_definition = custom_operations.empty() || custom_chain_mixture.empty();
+  CHECK_ARGUMENT(has_single_chain_definition, "Cannot specify both custom_operations and a custom chain mixture.");
+
+  const bool are_chain_weights_valid =
+      std::all_of(custom_chain_mixture.begin(), custom_chain_mixture.end(),
+                  [](const WeightedCustomChain& chain) { return chain.weight > 0; });
+  CHECK_ARGUMENT(are_chain_weights_valid, "Weights of custom operation chains must be greater than 0.");
+
   const bool latency_sample_is_custom = exec_mode == Mode::Custom || latency_sample_frequency == 0;
   CHECK_ARGUMENT(latency_sample_is_custom, "Latency sampling can only be used with custom operations.");
+
+  // Check if multiple chains are only interleaved in custom execution
+  const bool is_mlp_width_valid = mlp_width > 0;
+  CHECK_ARGUMENT(is_mlp_width_valid, "MLP width must be at least 1.");
+
+  const bool is_mlp_width_mode_valid = mlp_width == 1 || exec_mode == Mode::Custom;
+  CHECK_ARGUMENT(is_mlp_width_mode_valid, "MLP width (mlp_width > 1) only supported in custom execution.");
+
+  const bool is_mlp_width_mixture_valid = mlp_width == 1 || custom_chain_mixture.empty();
+  CHECK_ARGUMENT(is_mlp_width_mixture_valid,
+                 "MLP width (mlp_width > 1) not supported for mixtures of custom operation chains.");
+
+  const bool is_mlp_width_sampling_valid = mlp_width == 1 || latency_sample_frequency == 0;
+  CHECK_ARGUMENT(is_mlp_width_sampling_valid,
+                 "Latency sampling not supported with mlp_width > 1, as the interleaved chains overlap.");
+
+  // Check if rate-limited execution has a single, positive target rate
+  const bool is_target_rate_valid = target_ops_per_second >= 0;
+  CHECK_ARGUMENT(is_target_rate_valid, "Target ops per second must not be negative.");
+
+  const bool has_single_target_rate = target_ops_per_second == 0 || target_bandwidth == 0;
+  CHECK_ARGUMENT(has_single_target_rate, "Only one of target_ops_per_second and target_bandwidth can be set.");
+
+  auto is_access_op = [](const CustomOp& op) {
+    return op.type == Operation::Read || op.type == Operation::Write || op.type == Operation::ReadModifyWrite;
+  };
+  const bool has_target_bandwidth_accesses =
+      target_bandwidth == 0 || exec_mode != Mode::Custom || any_custom_op(*this, is_access_op);
+  CHECK_ARGUMENT(has_target_bandwidth_accesses, "Target bandwidth requires custom operations that access memory.");
+
+  const bool is_rate_limit_sampling_valid = !is_rate_limited() || latency_sample_frequency == 0;
+  CHECK_ARGUMENT(is_rate_limit_sampling_valid,
+                 "Latency sampling not supported with rate-limited execution, which measures each operation.");
+
+  const bool is_rate_limit_mlp_width_valid = !is_rate_limited() || mlp_width == 1;
+  CHECK_ARGUMENT(is_rate_limit_mlp_width_valid,
+                 "Rate-limited execution not supported with mlp_width > 1, as the interleaved chains overlap.");
+
+  // Check if named regions are valid and only accessed in custom execution
+  const bool is_custom_region_mode_valid = custom_regions.empty() || exec_mode == Mode::Custom;
+  CHECK_ARGUMENT(is_custom_region_mode_valid, "Custom regions only supported in custom execution.");
+
+  const uint16_t num_partitions = number_partitions == 0 ? number_threads : number_partitions;
+  for (size_t region_idx = 0; region_idx < custom_regions.size(); ++region_idx) {
+    const CustomRegion& region = custom_regions[region_idx];
+    const bool is_region_name_valid =
+        !region.name.empty() && std::all_of(region.name.begin(), region.name.end(), ::isalnum) &&
+        get_custom_region_index(region.name) == static_cast<int32_t>(region_idx);
+    CHECK_ARGUMENT(is_region_name_valid, "Custom region names must be unique and only contain letters and digits.");
+
+    const bool is_region_partitionable = region.size > 0 && (region.size % (num_partitions * 64ul)) == 0;
+    CHECK_ARGUMENT(is_region_partitionable,
+                   "Size of custom region '" + region.name +
+                       "' must be evenly divisible into 64 Byte-aligned partitions.");
+
+    const bool is_region_numa_node_valid = region.numa_node < 0 || !region.is_pmem;
+    CHECK_ARGUMENT(is_region_numa_node_valid, "NUMA node can only be set for DRAM regions.");
+  }
+
+  // Check if all ops reference existing regions that fit their largest access
+  // The sizes of a histogram are only known after reading its file, so we cannot check them here.
+  const uint32_t max_variable_access_size =
+      access_size_distribution == SizeDistribution::Histogram ? 0 : max_access_size;
+  const bool are_custom_region_ops_valid = !any_custom_op(*this, [&](const CustomOp& op) {
+    if (op.region.empty()) {
+      return false;
+    }
+    const int32_t region_idx = get_custom_region_index(op.region);
+    if (region_idx < 0) {
+      spdlog::error("Custom operation accesses unknown region: {}", op.to_string());
+      return true;
+    }
+    const uint64_t max_op_size = op.has_variable_size ? max_variable_access_size : op.size;
+    const uint64_t region_partition_size = custom_regions[region_idx].size / num_partitions;
+    if (region_partition_size <= max_op_size + alignment_offset) {
+      spdlog::error("Partitions of region '{}' are too small for operation: {}", op.region, op.to_string());
+      return true;
+    }
+    return false;
+  });
+  CHECK_ARGUMENT(are_custom_region_ops_valid,
+                 "Custom operations must access defined custom_regions that are large enough for the access.");
+
+  // Check if read ratio is between 0 and 1 and only used in raw execution
+  const bool is_read_ratio_valid = !is_mixed_read_write() || read_ratio <= 1.0;
+  CHECK_ARGUMENT(is_read_ratio_valid, "Read ratio must be between 0 and 1.");
+
+  const bool is_read_ratio_mode_valid = !is_mixed_read_write() || exec_mode != Mode::Custom;
+  CHECK_ARGUMENT(is_read_ratio_mode_valid, "Read ratio only supported in sequential and random execution.");
+
+  // Check if fences are only batched for raw writes that actually persist
+  const bool is_fence_every_valid = fence_every > 0;
+  CHECK_ARGUMENT(is_fence_every_valid, "Fence every must be at least 1.");
+
+  const bool is_fence_batching_valid = fence_every == 1 || (exec_mode != Mode::Custom && contains_write_op() &&
+                                                            persist_instruction != PersistInstruction::None);
+  CHECK_ARGUMENT(is_fence_batching_valid,
+                 "Fence batching (fence_every > 1) only supported for sequential and random writes with a persist "
+                 "instruction other than none. Use explicit fence (f) operations in custom execution.");
+
+  // Check if read instructions and software prefetching are only used for raw reads
+  const bool has_raw_reads = exec_mode != Mode::Custom && contains_read_op();
+  const bool is_read_instruction_valid =
+      read_instruction == ReadInstruction::Load ||
+      (has_raw_reads && (is_mixed_read_write() || operation == Operation::Read));
+  CHECK_ARGUMENT(is_read_instruction_valid,
+                 "Streaming loads (read_instruction: stream) only supported for sequential and random reads. Use "
+                 "r_<size>_stream operations in custom execution.");
+
+  const bool is_prefetch_distance_valid = prefetch_distance == 0 || has_raw_reads;
+  CHECK_ARGUMENT(is_prefetch_distance_valid,
+                 "Prefetch distance only supported for sequential and random reads. Use p_<size>_<hint> operations in "
+                 "custom execution.");
+
+  const bool is_checksum_mode_valid = checksum == Checksum::None || exec_mode != Mode::Custom;
+  CHECK_ARGUMENT(is_checksum_mode_valid,
+                 "Checksums only supported for sequential and random execution. Use r_<size>_<checksum> and "
+                 "w_<size>_<persist_instruction>_<checksum> operations in custom execution.");
+
+  // Checksum reads load the data as input of the checksum, which does not use streaming loads.
+  const bool is_checksum_read_instruction_valid =
+      checksum == Checksum::None || read_instruction == ReadInstruction::Load;
+  CHECK_ARGUMENT(is_checksum_read_instruction_valid, "Checksums cannot be combined with streaming loads.");
+
+  // Check if size distribution is only used in random mode or with variable-sized custom operations
+  const bool has_fixed_size_distribution = access_size_distribution == SizeDistribution::Fixed;
+  const bool is_size_distribution_mode_valid = has_fixed_size_distribution || exec_mode == Mode::Random ||
+                                               (exec_mode == Mode::Custom && has_variable_access_size());
+  CHECK_ARGUMENT(is_size_distribution_mode_valid,
+                 "Access size distribution only supported in random execution or with variable-sized (*) custom "
+                 "operations.");
+
+  const bool has_size_distribution_for_variable_ops = !has_fixed_size_distribution || !has_variable_access_size();
+  CHECK_ARGUMENT(has_size_distribution_for_variable_ops,
+                 "Variable-sized (*) custom operations require an access_size_distribution other than fixed.");
+
+  const bool is_size_range_valid =
+      has_fixed_size_distribution || (0 < min_access_size && min_access_size <= max_access_size);
+  CHECK_ARGUMENT(is_size_range_valid, "Min access size must be greater than 0 and not greater than max access size.");
+
+  const bool is_lognormal_sigma_valid = access_size_distribution != SizeDistribution::LogNormal || lognormal_sigma > 0;
+  CHECK_ARGUMENT(is_lognormal_sigma_valid, "Log-normal sigma must be greater than 0.");
+
+  const bool has_histogram_file = access_size_distribution != SizeDistribution::Histogram ||
+                                  std::filesystem::is_regular_file(access_size_histogram_file);
+  CHECK_ARGUMENT(has_histogram_file, "Histogram size distribution requires an existing access_size_histogram_file.");
+
+  const bool has_data_pattern_file = data_pattern != DataPattern::File ||
+                                     (std::filesystem::is_regular_file(data_pattern_file) &&
+                                      std::filesystem::file_size(data_pattern_file) > 0);
+  CHECK_ARGUMENT(has_data_pattern_file, "File data pattern requires an existing, non-empty data_pattern_file.");
+}
+bool BenchmarkConfig::contains_read_op() const {
+  if (is_mixed_read_write()) {
+    return read_ratio > 0.0;
+  }
+  // Read-modify-writes also read the data, so we need to generate it.
+  return operation == Operation::Read || operation == Operation::ReadModifyWrite || exec_mode == Mode::Custom;
 }
-bool BenchmarkConfig::contains_read_op() const { return operation == Operation::Read || exec_mode == Mode::Custom; }
 
 bool BenchmarkConfig::contains_write_op() const {
+  if (is_mixed_read_write()) {
+    return read_ratio < 1.0;
+  }
   auto find_custom_write_op = [](const CustomOp& op) { return op.type == Operation::Write; };
-  return operation == Operation::Write ||
-         std::any_of(custom_operations.begin(), custom_operations.end(), find_custom_write_op);
+  return operation == Operation::Write || operation == Operation::ReadModifyWrite ||
+         any_custom_op(*this, find_custom_write_op);
+}
+
+bool BenchmarkConfig::is_mixed_read_write() const { return read_ratio >= 0.0; }
+
+bool BenchmarkConfig::has_explicit_fences() const {
+  auto is_fence_op = [](const CustomOp& op) { return op.type == Operation::Fence; };
+  return any_custom_op(*this, is_fence_op);
+}
+
+bool BenchmarkConfig::has_compute_ops() const {
+  return any_custom_op(*this, [](const CustomOp& op) { return op.is_compute(); });
+}
+
+bool BenchmarkConfig::is_rate_limited() const { return target_ops_per_second > 0 || target_bandwidth > 0; }
+
+bool BenchmarkConfig::has_variable_access_size() const {
+  auto find_variable_size_op = [](const CustomOp& op) { return op.has_variable_size; };
+  return (exec_mode == Mode::Random && access_size_distribution != SizeDistribution::Fixed) ||
+         any_custom_op(*this, find_variable_size_op);
 }
 
 bool BenchmarkConfig::contains_dram_op() const {
   auto find_custom_dram_op = [](const CustomOp& op) { return !op.is_pmem; };
-  return dram_operation_ratio > 0.0 ||
-         std::any_of(custom_operations.begin(), custom_operations.end(), find_custom_dram_op);
+  return dram_operation_ratio > 0.0 || any_custom_op(*this, find_custom_dram_op);
+}
+
+std::vector<WeightedCustomChain> BenchmarkConfig::get_custom_chains() const {
+  if (custom_chain_mixture.empty()) {
+    return {WeightedCustomChain{1.0, custom_operations}};
+  }
+  return custom_chain_mixture;
+}
+
+int32_t BenchmarkConfig::get_custom_region_index(const std::string& name) const {
+  auto region_it = std::find_if(custom_regions.begin(), custom_regions.end(),
+                                [&](const CustomRegion& region) { return region.name == name; });
+  return region_it == custom_regions.end() ? -1 : static_cast<int32_t>(region_it - custom_regions.begin());
 }
 
 nlohmann::json BenchmarkConfig::as_json() const {
@@ -288,16 +589,66 @@ nlohmann::json BenchmarkConfig::as_json() const {
     config["dram_huge_pages"] = dram_huge_pages;
   }
 
-  if (exec_mode != Mode::Custom) {
+  if (alignment_offset > 0) {
+    config["alignment_offset"] = alignment_offset;
+  }
+
+  if (region_offset > 0) {
+    config["region_offset"] = region_offset;
+  }
+
+  if (exec_mode != Mode::Custom && is_mixed_read_write()) {
+    config["access_size"] = access_size;
+    config["read_ratio"] = read_ratio;
+    config["mix_pattern"] = utils::get_enum_as_string(ConfigEnums::str_to_mix_pattern, mix_pattern);
+    config["persist_instruction"] =
+        utils::get_enum_as_string(ConfigEnums::str_to_persist_instruction, persist_instruction);
+  } else if (exec_mode != Mode::Custom) {
     config["access_size"] = access_size;
     config["operation"] = utils::get_enum_as_string(ConfigEnums::str_to_operation, operation);
 
-    if (operation == Operation::Write) {
+    if (operation != Operation::Read) {
       config["persist_instruction"] =
           utils::get_enum_as_string(ConfigEnums::str_to_persist_instruction, persist_instruction);
     }
   }
 
+  if (fence_every > 1) {
+    config["fence_every"] = fence_every;
+  }
+
+  if (read_instruction != ReadInstruction::Load) {
+    config["read_instruction"] = utils::get_enum_as_string(ConfigEnums::str_to_read_instruction, read_instruction);
+  }
+
+  if (prefetch_distance > 0) {
+    config["prefetch_distance"] = prefetch_distance;
+  }
+
+  if (checksum != Checksum::None) {
+    config["checksum"] = utils::get_enum_as_string(ConfigEnums::str_to_checksum, checksum);
+  }
+
+  if (data_pattern != DataPattern::Constant) {
+    config["data_pattern"] = utils::get_enum_as_string(ConfigEnums::str_to_data_pattern, data_pattern);
+    if (data_pattern == DataPattern::File) {
+      config["data_pattern_file"] = data_pattern_file;
+    }
+  }
+
+  if (cache_state != CacheState::None) {
+    config["cache_state"] = utils::get_enum_as_string(ConfigEnums::str_to_cache_state, cache_state);
+  }
+
+  if (is_rate_limited()) {
+    if (target_bandwidth > 0) {
+      config["target_bandwidth"] = target_bandwidth;
+    } else {
+      config["target_ops_per_second"] = target_ops_per_second;
+    }
+    config["arrival_pattern"] = utils::get_enum_as_string(ConfigEnums::str_to_arrival_pattern, arrival_pattern);
+  }
+
   if (exec_mode == Mode::Random) {
     config["number_operations"] = number_operations;
     config["random_distribution"] =
@@ -309,7 +660,41 @@ nlohmann::json BenchmarkConfig::as_json() const {
 
   if (exec_mode == Mode::Custom) {
     config["number_operations"] = number_operations;
-    config["custom_operations"] = CustomOp::all_to_string(custom_operations);
+    config["custom_operations"] = custom_chain_mixture.empty()
+                                      ? CustomOp::all_to_string(custom_operations)
+                                      : WeightedCustomChain::all_to_string(custom_chain_mixture);
+    if (mlp_width > 1) {
+      config["mlp_width"] = mlp_width;
+    }
+
+    for (const CustomRegion& region : custom_regions) {
+      nlohmann::json& region_config = config["custom_regions"][region.name];
+      region_config["size"] = region.size;
+      region_config["memory"] = utils::get_enum_as_string(ConfigEnums::str_to_mem_type, region.is_pmem);
+      region_config["distribution"] =
+          utils::get_enum_as_string(ConfigEnums::str_to_random_distribution, region.distribution);
+      if (region.numa_node >= 0) {
+        region_config["numa_node"] = region.numa_node;
+      }
+      if (region.distribution == RandomDistribution::Zipf) {
+        config["zipf_alpha"] = zipf_alpha;
+      }
+    }
+  }
+
+  if (access_size_distribution != SizeDistribution::Fixed) {
+    config["access_size_distribution"] =
+        utils::get_enum_as_string(ConfigEnums::str_to_size_distribution, access_size_distribution);
+    if (access_size_distribution == SizeDistribution::Histogram) {
+      config["access_size_histogram_file"] = access_size_histogram_file;
+    } else {
+      config["min_access_size"] = min_access_size;
+      config["max_access_size"] = max_access_size;
+    }
+    if (access_size_distribution == SizeDistribution::LogNormal) {
+      config["lognormal_mu"] = lognormal_mu;
+      config["lognormal_sigma"] = lognormal_sigma;
+    }
   }
 
   if (run_time > 0) {
@@ -333,17 +718,53 @@ CustomOp CustomOp::from_string(const std::string& str) {
     op_str_parts.emplace_back(op_str_part);
   }
 
+  // Fences have no size or any other information.
+  if (op_str_parts.size() == 1 && op_str_parts[0] == "f") {
+    return CustomOp{.type = Operation::Fence, .size = 0};
+  }
+
   const size_t num_op_str_parts = op_str_parts.size();
   if (num_op_str_parts < 2) {
     spdlog::error("Custom operation is too short: '{}'. Expected at least <operation>_<size>", str);
     utils::crash_exit();
   }
 
+  // Compute ops only have a duration or a number of hash rounds.
+  if (op_str_parts[0] == "c" || op_str_parts[0] == "h") {
+    const Operation compute_type = op_str_parts[0] == "c" ? Operation::Compute : Operation::Hash;
+    const std::string& amount_str = op_str_parts[1];
+    uint64_t amount = 0;
+    auto amount_result = std::from_chars(amount_str.data(), amount_str.data() + amount_str.size(), amount);
+    if (num_op_str_parts > 2 || amount_result.ec != std::errc() ||
+        amount_result.ptr != amount_str.data() + amount_str.size() || amount == 0) {
+      spdlog::error("Custom compute op must be c_<ns> or h_<rounds> with a value greater than 0. Got: '{}'", str);
+      utils::crash_exit();
+    }
+    return CustomOp{.type = compute_type, .size = amount};
+  }
+
   // Create new custom operation
   CustomOp custom_op;
 
-  // Get operation and location
-  const std::string& operation_str = op_str_parts[0];
+  // Get operation and location. Sequential reads have an additional 's' after the 'r'.
+  std::string operation_str = op_str_parts[0];
+  const bool is_sequential_read = operation_str.size() > 1 && operation_str[0] == 'r' && operation_str[1] == 's';
+  if (is_sequential_read) {
+    operation_str.erase(1, 1);
+    custom_op.read_pattern = ReadPattern::Sequential;
+  }
+
+  // Ops on a named region have the region name in parentheses instead of a location, e.g., r(idx).
+  const size_t region_start = operation_str.find('(');
+  if (region_start != std::string::npos) {
+    if (region_start != 1 || operation_str.size() < 4 || operation_str.back() != ')') {
+      spdlog::error("Could not parse the region of custom operation: '{}'. Expected, e.g., r(<region>)_<size>", str);
+      utils::crash_exit();
+    }
+    custom_op.region = operation_str.substr(2, operation_str.size() - 3);
+    operation_str.erase(1);
+  }
+
   auto op_location_it = ConfigEnums::str_to_op_location.find(operation_str);
   if (op_location_it == ConfigEnums::str_to_op_location.end()) {
     spdlog::error("Unknown operation and/or location: {}", operation_str);
@@ -351,53 +772,128 @@ CustomOp CustomOp::from_string(const std::string& str) {
   }
   custom_op.type = op_location_it->second.first;
   custom_op.is_pmem = op_location_it->second.second;
+  if (is_sequential_read && custom_op.type != Operation::Read) {
+    spdlog::error("Unknown operation and/or location: {}", op_str_parts[0]);
+    utils::crash_exit();
+  }
 
   // Get size of access
   const std::string& size_str = op_str_parts[1];
-  auto size_result = std::from_chars(size_str.data(), size_str.data() + size_str.size(), custom_op.size);
-  if (size_result.ec != std::errc()) {
-    spdlog::error("Could not parse operation size: {}", size_str);
-    utils::crash_exit();
-  }
+  if (size_str == "*") {
+    // The size is drawn from the access size distribution for each access.
+    custom_op.has_variable_size = true;
+    custom_op.size = 0;
+  } else {
+    auto size_result = std::from_chars(size_str.data(), size_str.data() + size_str.size(), custom_op.size);
+    if (size_result.ec != std::errc()) {
+      spdlog::error("Could not parse operation size: {}", size_str);
+      utils::crash_exit();
+    }
 
-  if ((custom_op.size & (custom_op.size - 1)) != 0) {
-    spdlog::error("Access size of custom operation must be power of 2. Got: {}", custom_op.size);
-    utils::crash_exit();
+    if (custom_op.size == 0) {
+      spdlog::error("Access size of custom operation must be greater than 0. Got: {}", str);
+      utils::crash_exit();
+    }
   }
 
-  const bool is_write = custom_op.type == Operation::Write;
+  if (custom_op.type == Operation::Read) {
+    // Read op only has an optional read instruction or checksum and an optional offset.
+    size_t next_part = 2;
+    if (num_op_str_parts > next_part) {
+      auto read_instruction_it = ConfigEnums::str_to_read_instruction.find(op_str_parts[next_part]);
+      auto checksum_it = ConfigEnums::str_to_checksum.find(op_str_parts[next_part]);
+      if (read_instruction_it != ConfigEnums::str_to_read_instruction.end()) {
+        custom_op.read_instruction = read_instruction_it->second;
+        next_part++;
+      } else if (checksum_it != ConfigEnums::str_to_checksum.end()) {
+        custom_op.checksum = checksum_it->second;
+        next_part++;
+      }
+    }
 
-  if (!is_write) {
-    // Read op has no further information.
+    if (num_op_str_parts > next_part) {
+      const std::string& offset_str = op_str_parts[next_part];
+      auto offset_result = std::from_chars(offset_str.data(), offset_str.data() + offset_str.size(), custom_op.offset);
+      if (num_op_str_parts > next_part + 1 || offset_result.ec != std::errc() ||
+          offset_result.ptr != offset_str.data() + offset_str.size()) {
+        spdlog::error("Could not parse the read instruction, checksum, or offset in read op: '{}'", str);
+        utils::crash_exit();
+      }
+
+      if ((std::abs(custom_op.offset) % 64) != 0) {
+        spdlog::error("Offset of custom read operation must be multiple of 64. Got: {}", custom_op.offset);
+        utils::crash_exit();
+      }
+
+      if (is_sequential_read) {
+        spdlog::error("Sequential read op cannot have an offset. Got: '{}'", str);
+        utils::crash_exit();
+      }
+      custom_op.read_pattern = ReadPattern::Relative;
+    }
+
+    if (is_sequential_read && custom_op.has_variable_size) {
+      spdlog::error("Sequential read op must have a fixed size. Got: '{}'", str);
+      utils::crash_exit();
+    }
     return custom_op;
   }
 
-  if (num_op_str_parts < 3) {
-    spdlog::error("Custom write op must have '_<persist_instruction>' after size, e.g., w64_cache. Got: '{}'", str);
+  const bool is_prefetch = custom_op.type == Operation::Prefetch;
+  if (is_prefetch && custom_op.has_variable_size) {
+    spdlog::error("Custom prefetch op must have a fixed size. Got: '{}'", str);
     utils::crash_exit();
   }
 
-  const std::string& persist_str = op_str_parts[2];
-  auto persist_it = ConfigEnums::str_to_persist_instruction.find(persist_str);
-  if (persist_it == ConfigEnums::str_to_persist_instruction.end()) {
-    spdlog::error("Could not parse the persist instruction in write op: '{}'", persist_str);
+  if (num_op_str_parts < 3) {
+    if (is_prefetch) {
+      spdlog::error("Custom prefetch op must have '_<prefetch_hint>' after size, e.g., p_64_nta. Got: '{}'", str);
+    } else {
+      spdlog::error("Custom write op must have '_<persist_instruction>' after size, e.g., w64_cache. Got: '{}'", str);
+    }
     utils::crash_exit();
   }
 
-  custom_op.persist = persist_it->second;
+  if (is_prefetch) {
+    const std::string& hint_str = op_str_parts[2];
+    auto hint_it = ConfigEnums::str_to_prefetch_hint.find(hint_str);
+    if (hint_it == ConfigEnums::str_to_prefetch_hint.end()) {
+      spdlog::error("Could not parse the prefetch hint in prefetch op: '{}'", hint_str);
+      utils::crash_exit();
+    }
+    custom_op.prefetch_hint = hint_it->second;
+  } else {
+    const std::string& persist_str = op_str_parts[2];
+    auto persist_it = ConfigEnums::str_to_persist_instruction.find(persist_str);
+    if (persist_it == ConfigEnums::str_to_persist_instruction.end()) {
+      spdlog::error("Could not parse the persist instruction in write op: '{}'", persist_str);
+      utils::crash_exit();
+    }
+    custom_op.persist = persist_it->second;
+  }
+
+  // Writes have an optional checksum before the offset.
+  size_t next_part = 3;
+  if (!is_prefetch && num_op_str_parts > next_part) {
+    auto checksum_it = ConfigEnums::str_to_checksum.find(op_str_parts[next_part]);
+    if (checksum_it != ConfigEnums::str_to_checksum.end()) {
+      custom_op.checksum = checksum_it->second;
+      next_part++;
+    }
+  }
 
-  const bool has_offset_information = num_op_str_parts == 4;
+  const bool has_offset_information = num_op_str_parts > next_part;
   if (has_offset_information) {
-    const std::string& offset_str = op_str_parts[3];
+    const std::string& offset_str = op_str_parts[next_part];
     auto offset_result = std::from_chars(offset_str.data(), offset_str.data() + offset_str.size(), custom_op.offset);
-    if (offset_result.ec != std::errc()) {
+    if (num_op_str_parts > next_part + 1 || offset_result.ec != std::errc()) {
       spdlog::error("Could not parse operation offset: {}", offset_str);
       utils::crash_exit();
     }
 
     const uint64_t absolute_offset = std::abs(custom_op.offset);
     if ((absolute_offset % 64) != 0) {
-      spdlog::error("Offset of custom write operation must be multiple of 64. Got: {}", custom_op.offset);
+      spdlog::error("Offset of custom write/prefetch operation must be multiple of 64. Got: {}", custom_op.offset);
       utils::crash_exit();
     }
   }
@@ -429,11 +925,48 @@ std::vector<CustomOp> CustomOp::all_from_string(const std::string& str) {
 }
 
 std::string CustomOp::to_string() const {
+  if (type == Operation::Fence) {
+    return "f";
+  }
+
   std::stringstream out;
-  out << utils::get_enum_as_string(ConfigEnums::str_to_op_location, std::make_pair(type, is_pmem));
-  out << '_' << size;
-  if (type == Operation::Write) {
-    out << '_' << utils::get_enum_as_string(ConfigEnums::str_to_persist_instruction, persist);
+  if (is_compute()) {
+    out << (type == Operation::Compute ? 'c' : 'h') << '_' << size;
+    return out.str();
+  }
+
+  std::string op_location_str =
+      utils::get_enum_as_string(ConfigEnums::str_to_op_location, std::make_pair(type, is_pmem));
+  if (!region.empty()) {
+    op_location_str = op_location_str.substr(0, 1) + '(' + region + ')';
+  }
+  if (type == Operation::Read && read_pattern == ReadPattern::Sequential) {
+    op_location_str.insert(1, "s");
+  }
+  out << op_location_str;
+  if (has_variable_size) {
+    out << "_*";
+  } else {
+    out << '_' << size;
+  }
+  if (type == Operation::Read && read_instruction != ReadInstruction::Load) {
+    out << '_' << utils::get_enum_as_string(ConfigEnums::str_to_read_instruction, read_instruction);
+  }
+  if (type == Operation::Read && checksum != Checksum::None) {
+    out << '_' << utils::get_enum_as_string(ConfigEnums::str_to_checksum, checksum);
+  }
+  if (type == Operation::Read && read_pattern == ReadPattern::Relative) {
+    out << '_' << offset;
+  }
+  if (type == Operation::Write || type == Operation::Prefetch) {
+    if (type == Operation::Write) {
+      out << '_' << utils::get_enum_as_string(ConfigEnums::str_to_persist_instruction, persist);
+      if (checksum != Checksum::None) {
+        out << '_' << utils::get_enum_as_string(ConfigEnums::str_to_checksum, checksum);
+      }
+    } else {
+      out << '_' << utils::get_enum_as_string(ConfigEnums::str_to_prefetch_hint, prefetch_hint);
+    }
     if (offset != 0) {
       out << '_' << offset;
     }
@@ -452,21 +985,81 @@ std::string CustomOp::all_to_string(const std::vector<CustomOp>& ops) {
   return out.str();
 }
 
+WeightedCustomChain WeightedCustomChain::from_string(const std::string& str) {
+  const size_t weight_end = str.find(':');
+  if (weight_end == std::string::npos) {
+    spdlog::error("Custom operation chain in a mixture must have a weight, e.g., '0.9: r_512'. Got: '{}'", str);
+    utils::crash_exit();
+  }
+
+  std::stringstream weight_stream{str.substr(0, weight_end)};
+  double weight = 0;
+  std::string remainder;
+  weight_stream >> weight;
+  if (weight_stream.fail() || (weight_stream >> remainder)) {
+    spdlog::error("Could not parse weight of custom operation chain: '{}'", str);
+    utils::crash_exit();
+  }
+
+  // Operations cannot contain whitespace, so we remove the spaces around the separators.
+  std::string chain_str = str.substr(weight_end + 1);
+  chain_str.erase(std::remove_if(chain_str.begin(), chain_str.end(), [](unsigned char c) { return std::isspace(c); }),
+                  chain_str.end());
+  return WeightedCustomChain{weight, CustomOp::all_from_string(chain_str)};
+}
+
+std::vector<WeightedCustomChain> WeightedCustomChain::all_from_string(const std::string& str) {
+  std::vector<WeightedCustomChain> chains;
+  std::stringstream stream{str};
+  std::string chain_str;
+  while (std::getline(stream, chain_str, '|')) {
+    chains.emplace_back(from_string(chain_str));
+  }
+
+  if (chains.empty()) {
+    spdlog::error("Custom operation chain mixture cannot be empty!");
+    utils::crash_exit();
+  }
+  return chains;
+}
+
+std::string WeightedCustomChain::all_to_string(const std::vector<WeightedCustomChain>& chains) {
+  std::stringstream out;
+  for (size_t i = 0; i < chains.size(); ++i) {
+    if (i > 0) {
+      out << " | ";
+    }
+    out << chains[i].weight << ": " << CustomOp::all_to_string(chains[i].operations);
+  }
+  return out.str();
+}
+
 bool CustomOp::validate(const std::vector<CustomOp>& operations) {
-  if (operations[0].type != Operation::Read) {
-    spdlog::error("First custom operation must be a read");
+  if (operations[0].type != Operation::Read || operations[0].read_pattern == ReadPattern::Relative) {
+    spdlog::error("First custom operation must be a random or sequential read");
     return false;
   }
 
-  // Check if write is to same memory type
+  // Check if write is to same memory type or region
   bool is_currently_pmem = operations[0].is_pmem;
+  const std::string* current_region = &operations[0].region;
   for (const CustomOp& op : operations) {
-    if ((op.type == Operation::Write) && (is_currently_pmem ^ op.is_pmem)) {
-      spdlog::error("A write must occur after a read to the same memory type, i.e., DRAM or PMem.");
+    if (op.type == Operation::Fence || op.is_compute()) {
+      // Fences and compute ops are independent of the memory type.
+      continue;
+    }
+
+    const bool is_relative_op = op.type == Operation::Write || op.type == Operation::Prefetch ||
+                                op.read_pattern == ReadPattern::Relative;
+    if (is_relative_op && ((is_currently_pmem ^ op.is_pmem) || *current_region != op.region)) {
+      spdlog::error(
+          "A write, prefetch, or relative read must occur after an access to the same memory type, i.e., DRAM or "
+          "PMem, or to the same region.");
       spdlog::error("Bad operation: {}", op.to_string());
       return false;
     }
     is_currently_pmem = op.is_pmem;
+    current_region = &op.region;
   }
 
   return true;
@@ -474,7 +1067,9 @@ bool CustomOp::validate(const std::vector<CustomOp>& operations) {
 
 bool CustomOp::operator==(const CustomOp& rhs) const {
   return type == rhs.type && is_pmem == rhs.is_pmem && size == rhs.size && persist == rhs.persist &&
-         offset == rhs.offset;
+         offset == rhs.offset && has_variable_size == rhs.has_variable_size &&
+         read_instruction == rhs.read_instruction && prefetch_hint == rhs.prefetch_hint &&
+         read_pattern == rhs.read_pattern && checksum == rhs.checksum && region == rhs.region;
 }
 bool CustomOp::operator!=(const CustomOp& rhs) const { return !(rhs == *this); }
 std::ostream& operator<<(std::ostream& os, const CustomOp& op) { return os << op.to_string(); }
@@ -486,25 +1081,59 @@ const std::unordered_map<std::string, Mode> ConfigEnums::str_to_mode{{"sequentia
                                                                      {"random", Mode::Random},
                                                                      {"custom", Mode::Custom}};
 
-const std::unordered_map<std::string, Operation> ConfigEnums::str_to_operation{{"read", Operation::Read},
-                                                                               {"write", Operation::Write}};
+const std::unordered_map<std::string, Operation> ConfigEnums::str_to_operation{
+    {"read", Operation::Read}, {"write", Operation::Write}, {"read_modify_write", Operation::ReadModifyWrite}};
 
 const std::unordered_map<std::string, NumaPattern> ConfigEnums::str_to_numa_pattern{{"near", NumaPattern::Near},
                                                                                     {"far", NumaPattern::Far}};
 
+const std::unordered_map<std::string, MixPattern> ConfigEnums::str_to_mix_pattern{
+    {"interleaved", MixPattern::Interleaved}, {"random", MixPattern::Random}};
+
 const std::unordered_map<std::string, PersistInstruction> ConfigEnums::str_to_persist_instruction{
     {"nocache", PersistInstruction::NoCache},
     {"cache", PersistInstruction::Cache},
     {"cacheinv", PersistInstruction::CacheInvalidate},
+    {"fence", PersistInstruction::Fence},
     {"none", PersistInstruction::None}};
 
+const std::unordered_map<std::string, ReadInstruction> ConfigEnums::str_to_read_instruction{
+    {"load", ReadInstruction::Load}, {"stream", ReadInstruction::Stream}};
+
+const std::unordered_map<std::string, PrefetchHint> ConfigEnums::str_to_prefetch_hint{{"t0", PrefetchHint::T0},
+                                                                                    {"nta", PrefetchHint::NTA}};
+
+const std::unordered_map<std::string, Checksum> ConfigEnums::str_to_checksum{
+    {"none", Checksum::None}, {"crc32c", Checksum::Crc32c}, {"xxhash", Checksum::XxHash}};
+
+const std::unordered_map<std::string, DataPattern> ConfigEnums::str_to_data_pattern{
+    {"constant", DataPattern::Constant},
+    {"zero", DataPattern::Zero},
+    {"random_line", DataPattern::RandomLine},
+    {"random_op", DataPattern::RandomOp},
+    {"file", DataPattern::File}};
+
+const std::unordered_map<std::string, CacheState> ConfigEnums::str_to_cache_state{
+    {"none", CacheState::None}, {"cold", CacheState::Cold}, {"warm", CacheState::Warm}};
+
+const std::unordered_map<std::string, ArrivalPattern> ConfigEnums::str_to_arrival_pattern{
+    {"fixed", ArrivalPattern::Fixed}, {"poisson", ArrivalPattern::Poisson}};
+
 const std::unordered_map<std::string, RandomDistribution> ConfigEnums::str_to_random_distribution{
     {"uniform", RandomDistribution::Uniform}, {"zipf", RandomDistribution::Zipf}};
 
+const std::unordered_map<std::string, SizeDistribution> ConfigEnums::str_to_size_distribution{
+    {"fixed", SizeDistribution::Fixed},
+    {"uniform", SizeDistribution::Uniform},
+    {"lognormal", SizeDistribution::LogNormal},
+    {"histogram", SizeDistribution::Histogram}};
+
 const std::unordered_map<std::string, ConfigEnums::OpLocation> ConfigEnums::str_to_op_location = {
     {"r", {perma::Operation::Read, true}},   {"w", {perma::Operation::Write, true}},
     {"rp", {perma::Operation::Read, true}},  {"wp", {perma::Operation::Write, true}},
     {"rd", {perma::Operation::Read, false}}, {"wd", {perma::Operation::Write, false}},
+    {"p", {perma::Operation::Prefetch, true}}, {"pp", {perma::Operation::Prefetch, true}},
+    {"pd", {perma::Operation::Prefetch, false}},
 };
 
 const std::unordered_map<char, uint64_t> ConfigEnums::scale_suffix_to_factor{{'k', 1024},
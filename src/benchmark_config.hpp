@@ -14,12 +14,38 @@ enum class Mode : uint8_t { Sequential, Sequential_Desc, Random, Custom };
 
 enum class RandomDistribution : uint8_t { Uniform, Zipf };
 
-enum class PersistInstruction : uint8_t { Cache, CacheInvalidate, NoCache, None };
+enum class SizeDistribution : uint8_t { Fixed, Uniform, LogNormal, Histogram };
 
-enum class Operation : uint8_t { Read, Write };
+enum class PersistInstruction : uint8_t { Cache, CacheInvalidate, NoCache, Fence, None };
+
+enum class ReadInstruction : uint8_t { Load, Stream };
+
+enum class PrefetchHint : uint8_t { T0, NTA };
+
+enum class Checksum : uint8_t { None, Crc32c, XxHash };
+
+// The same 64 Byte line for all writes, only zeros, random data for each cache line or for each access, or lines
+// sampled from a file.
+enum class DataPattern : uint8_t { Constant, Zero, RandomLine, RandomOp, File };
+
+// Whether the CPU caches hold any of the memory ranges before the measurement is not controlled, evicted, or warmed up.
+enum class CacheState : uint8_t { None, Cold, Warm };
+
+// Rate-limited threads start their operations at fixed intervals or at exponentially distributed intervals, i.e., as a
+// Poisson process.
+enum class ArrivalPattern : uint8_t { Fixed, Poisson };
+
+// Random reads chase pointers, relative reads access the previous address plus an offset, and sequential reads advance
+// a per-thread cursor through their memory region.
+enum class ReadPattern : uint8_t { Random, Relative, Sequential };
+
+// Fence, Prefetch, Compute, and Hash are only available as custom operations.
+enum class Operation : uint8_t { Read, Write, ReadModifyWrite, Fence, Prefetch, Compute, Hash };
 
 enum class NumaPattern : uint8_t { Near, Far };
 
+enum class MixPattern : uint8_t { Interleaved, Random };
+
 // We assume 2^30 for GB and not 10^9
 static constexpr size_t BYTES_IN_MEGABYTE = 1024u * 1024;
 static constexpr size_t BYTES_IN_GIGABYTE = 1024u * BYTES_IN_MEGABYTE;
@@ -28,30 +54,75 @@ static constexpr size_t NANOSECONDS_IN_SECONDS = 1e9;
 /**
  * This represents a custom operation to be specified by the user. Its string representation, is:
  *
- * For reads: r(<location>)_<size>
+ * For reads: r(s)(<location>)_<size>(_<read_instruction>|_<checksum>)(_<offset>)
  *
  * with:
  * 'r' for read,
- * (optional) <location> is 'd' or 'p' for DRAM/PMem (with p as default is nothing is specified),
- * <size> is the size of the access (must be power of 2).
+ * (optional) 's' for a sequential read that advances a per-thread cursor through its memory region instead of reading
+ *     a random (dependent) address, e.g., to replay a log. Sequential reads must have a fixed size and no offset,
+ * (optional) <location> is 'd' or 'p' for DRAM/PMem (with p as default is nothing is specified) or the name of a
+ *     `custom_regions` entry in parentheses, e.g., r(idx)_256,
+ * <size> is the size of the access in Byte (does not need to be a power of 2 or a multiple of 64) or '*' to draw
+ *        the size of each access from the `access_size_distribution`,
+ * (optional) <read_instruction> is the load instruction to use (load, stream), with load as default,
+ * (optional) <checksum> computes a checksum over the read data (crc32c, xxhash) instead of choosing a load
+ *     instruction. The next dependent read uses the checksum as its input, e.g., r_4096_crc32c,
+ * (optional) <offset> makes the read relative, i.e., it reads at the previously accessed address plus the offset (can
+ *     be negative) instead of a random address, e.g., to read a neighboring bucket.
  *
- * For writes: w(<location>)_<size>_<persist_instruction>(_<offset>)
+ * For writes: w(<location>)_<size>_<persist_instruction>(_<checksum>)(_<offset>)
  *
  * with:
  * 'w' for write,
- * (optional) <location> is 'd' or 'p' for DRAM/PMem (with p as default is nothing is specified),
- * <size> is the size of the access (must be power of 2),
- * <persist_instruction> is the instruction to use after the write (none, cache, cacheinv, noache),
+ * (optional) <location> is 'd' or 'p' for DRAM/PMem (with p as default is nothing is specified) or a region name in
+ *     parentheses, e.g., w(log)_64_cache,
+ * <size> is the size of the access in Byte (does not need to be a power of 2 or a multiple of 64) or '*',
+ * <persist_instruction> is the instruction to use after the write (none, fence, cache, cacheinv, noache),
+ * (optional) <checksum> computes a checksum over the written data before the write (crc32c, xxhash),
  * (optional) <offset> is the offset to the previously accessed address (can be negative, default is 0)
  *
+ * For prefetches: p(<location>)_<size>_<prefetch_hint>(_<offset>)
+ *
+ * with:
+ * 'p' for prefetch,
+ * (optional) <location> is 'd' or 'p' for DRAM/PMem (with p as default is nothing is specified) or a region name in
+ *     parentheses,
+ * <size> is the number of Bytes to prefetch,
+ * <prefetch_hint> is the cache level hint of the prefetch (t0, nta),
+ * (optional) <offset> is the offset to the previously accessed address (can be negative, default is 0). The prefetch
+ *     does not change the previously accessed address for the following operations.
+ *
+ * For fences: f
+ *
+ * with:
+ * 'f' for a standalone sfence. If a chain contains a fence, its writes only flush and do not fence individually, i.e.,
+ *     all fences of the chain are explicit. This allows to batch the fences of multiple writes.
+ *
+ * For compute: c_<ns> or h_<rounds>
+ *
+ * with:
+ * 'c' for a busy-wait of <ns> nanoseconds that does not depend on the accessed data, e.g., to model think time. The
+ *     CPU can execute it while earlier memory accesses are still in flight,
+ * 'h' for <rounds> rounds of a 64-bit hash over the data of the last read, e.g., to hash a key before the next probe.
+ *     The next random read depends on the hash, so it cannot start before the hash is computed.
+ *
  * */
 struct CustomOp {
   Operation type;
   bool is_pmem = true;
+  // For compute ops, this is the duration in nanoseconds (c) or the number of hash rounds (h).
   uint64_t size;
   PersistInstruction persist = PersistInstruction::None;
   // This can be signed, e.g., to represent the case when the previous cache line should be written to.
   int64_t offset = 0;
+  // If set, the size of each access is drawn from the `access_size_distribution` and `size` is ignored.
+  bool has_variable_size = false;
+  ReadInstruction read_instruction = ReadInstruction::Load;
+  PrefetchHint prefetch_hint = PrefetchHint::T0;
+  ReadPattern read_pattern = ReadPattern::Random;
+  Checksum checksum = Checksum::None;
+  // Name of the `custom_regions` entry to access. If empty, the op accesses the PMem or DRAM range based on `is_pmem`.
+  std::string region{};
 
   static CustomOp from_string(const std::string& str);
   static std::vector<CustomOp> all_from_string(const std::string& str);
@@ -61,21 +132,81 @@ struct CustomOp {
 
   static bool validate(const std::vector<CustomOp>& operations);
 
+  /** Compute ops busy-wait or hash and do not access memory. */
+  bool is_compute() const { return type == Operation::Compute || type == Operation::Hash; }
+
   friend std::ostream& operator<<(std::ostream& os, const CustomOp& op);
   bool operator==(const CustomOp& rhs) const;
   bool operator!=(const CustomOp& rhs) const;
 };
 
+/**
+ * A chain of custom operations with its relative weight in a mixture of chains. Its string representation is
+ * <weight>: <chain>, and the chains of a mixture are separated by '|', e.g., "0.9: r_512 | 0.1: r_512,w_64_cache" for
+ * 90% lookups and 10% updates. The weights do not need to sum up to 1.
+ */
+struct WeightedCustomChain {
+  double weight;
+  std::vector<CustomOp> operations;
+
+  static WeightedCustomChain from_string(const std::string& str);
+  static std::vector<WeightedCustomChain> all_from_string(const std::string& str);
+  static std::string all_to_string(const std::vector<WeightedCustomChain>& chains);
+};
+
+/**
+ * A named memory region for custom operations, e.g., a small hot index, a large heap, and a log that a workload
+ * accesses at the same time. Each region has its own size, memory type, and access distribution and is partitioned
+ * among the threads like the `memory_range`. Custom operations reference a region by its name, e.g., r(idx)_256.
+ */
+struct CustomRegion {
+  std::string name;
+  uint64_t size = 0;
+  bool is_pmem = true;
+  // NUMA node to bind the pages of a DRAM region to. Negative values do not bind the region.
+  int32_t numa_node = -1;
+  // Distribution of random reads in this region. Zipfian reads access the start of the region most often.
+  RandomDistribution distribution = RandomDistribution::Uniform;
+};
+
 /**
  * The values shown here define the benchmark and represent user-facing configuration options.
  */
 struct BenchmarkConfig {
-  /** Represents the size of an individual memory access in Byte. Must be a power of two. */
+  /** Represents the size of an individual memory access in Byte. Must be at least 64 Byte. Sizes that are not a power
+   * of two, e.g., 100 Byte records, are accessed with masked loads/stores for the partial last cache line. */
   uint32_t access_size = 256;
 
+  /** Distribution to draw the size of each access from, i.e., "fixed" (always `access_size`), "uniform", "lognormal",
+   * or "histogram". Only works with `Mode::Random` and with custom operations of size '*'. */
+  SizeDistribution access_size_distribution = SizeDistribution::Fixed;
+
+  /** Smallest and largest access size in Byte for the uniform and log-normal size distributions. Log-normal sizes are
+   * clamped to this range. */
+  uint32_t min_access_size = 64;
+  uint32_t max_access_size = 16 * 1024;
+
+  /** Mean and standard deviation of the natural logarithm of the access size for the log-normal size distribution. */
+  double lognormal_mu = 7.0;
+  double lognormal_sigma = 1.0;
+
+  /** File containing an empirical access size histogram with one `<size> <weight>` pair per line. Only works with the
+   * histogram size distribution. */
+  std::string access_size_histogram_file{};
+
+  /** Offset in Byte that is added to the start of each partition, i.e., all accesses are shifted by this offset. This
+   * can be used to measure accesses that are not cache line aligned or that straddle cache lines. Must be smaller than
+   * 4 KiB. Applies to raw and custom operations. */
+  uint32_t alignment_offset = 0;
+
   /** Represents the total PMem memory range to use for the benchmark. Must be a multiple of `access_size`.  */
   uint64_t memory_range = 10 * BYTES_IN_GIGABYTE;  // 10 GiB
 
+  /** Offset in Byte of the `memory_range` in the region that all sub-benchmarks of a parallel benchmark with
+   * `shared_region` access, e.g., to let a reader and a writer overlap in a part of their ranges. Must be a multiple of
+   * 4 KiB. Only applies to parallel benchmarks. */
+  uint64_t region_offset = 0;
+
   /** Represents the total DRAM memory range to use for the benchmark. Must be a multiple of `access_size`.  */
   uint64_t dram_memory_range = 0;
 
@@ -92,16 +223,64 @@ struct BenchmarkConfig {
   /** Alternative measure to end a benchmark by letting is run for `run_time` seconds. */
   uint64_t run_time = 0;
 
-  /** Type of memory access operation to perform, i.e., read or write. */
+  /** Type of memory access operation to perform, i.e., read, write, or read_modify_write. A read-modify-write loads
+   * each cache line of an access, modifies it, and writes it back to the same address. */
   Operation operation = Operation::Read;
 
+  /** Ratio of reads in a mixed read/write workload, i.e., 0.7 results in 70% reads and 30% writes within each thread's
+   * chunks. Must be between 0 and 1. If not set (i.e., negative), all accesses are of type `operation`. Only works with
+   * sequential and random execution. Writes use the `persist_instruction`. */
+  double read_ratio = -1.0;
+
+  /** Order of reads and writes in a mixed workload, i.e., "interleaved" for a fixed pattern that spreads the writes
+   * evenly among the reads (e.g., RRRW for 0.75) or "random" to pick each operation randomly based on `read_ratio`. */
+  MixPattern mix_pattern = MixPattern::Interleaved;
+
+  /** Load instruction to use for reads, i.e., "load" for regular loads or "stream" for non-temporal streaming loads
+   * (movntdqa). Streaming loads fall back to regular loads for accesses that are not cache line-aligned. Only works
+   * with sequential and random reads. Use the `_stream` suffix of reads in custom execution. */
+  ReadInstruction read_instruction = ReadInstruction::Load;
+
+  /** Number of accesses to prefetch ahead of the current one with a software prefetch (prefetcht0), e.g., 8 prefetches
+   * the 8th next address of a sequential scan or a random access pattern. 0 disables software prefetching. Only works
+   * with sequential and random execution. Use `p_<size>_<hint>` operations in custom execution. */
+  uint32_t prefetch_distance = 0;
+
+  /** Checksum to compute over the data of each access, i.e., "crc32c" (SSE4.2) or "xxhash" (AVX-512). Reads compute
+   * the checksum over the loaded data, writes compute it over the data before storing it, and read-modify-writes
+   * compute it over the loaded and the modified data, like a storage engine that checksums its pages. Compare against
+   * "none" to get the bandwidth cost of integrity checking. Only works with sequential and random execution and regular
+   * loads. Use the `_<checksum>` suffix of reads and writes in custom execution. */
+  Checksum checksum = Checksum::None;
+
+  /** Data that writes store and that the data generator fills the memory range with, i.e., "constant" (the same 64
+   * Byte line everywhere), "zero", "random_line" (different random data in each cache line), "random_op" (one random
+   * line per access), or "file" (lines sampled from the `data_pattern_file`). Devices that compress or deduplicate
+   * data perform differently for each pattern. Read-modify-writes store the modified loaded data and are not affected.
+   * All patterns except "constant" write each access with a per-access kernel. */
+  DataPattern data_pattern = DataPattern::Constant;
+
+  /** File to sample the written data from. Only works with the file data pattern. */
+  std::string data_pattern_file{};
+
+  /** State of the CPU caches at the start of the measurement, i.e., "cold" to evict all memory ranges with clflushopt
+   * or "warm" to load each of their cache lines once. Generating and prefaulting the data leaves parts of it in the
+   * LLC, so benchmarks with small ranges otherwise partly measure the cache. Each thread prepares its share of the
+   * ranges right before the measurement starts. The results contain the preparation time. */
+  CacheState cache_state = CacheState::None;
+
   /** Mode of execution, i.e., sequential, random, or custom. See `Mode` for all options. */
   Mode exec_mode = Mode::Sequential;
 
-  /** Persist instruction to use after write operations. Only works with `Operation::Write`. See
-   * `PersistInstruction` for more details on available options. */
+  /** Persist instruction to use after write operations. Only works with `Operation::Write` and
+   * `Operation::ReadModifyWrite`. See `PersistInstruction` for more details on available options. */
   PersistInstruction persist_instruction = PersistInstruction::NoCache;
 
+  /** Number of persisting writes after which a single fence is issued, e.g., to measure group commits that flush N
+   * cache lines and then fence once. The default of 1 fences after each write. Only works with sequential and random
+   * execution and a `persist_instruction` other than none. Use explicit `f` operations in custom execution. */
+  uint32_t fence_every = 1;
+
   /** Number of disjoint memory regions to partition the `memory_range` into. Must be 0 or a divisor of
    * `number_threads` i.e., one or more threads map to one partition. When set to 0, it is equal to the number of
    * threads, i.e., each thread has its own partition. Default is set to 1.  */
@@ -119,9 +298,42 @@ struct BenchmarkConfig {
   /** List of custom operations to use in `Mode::Custom`. See `CustomOp` for more details on string representation.  */
   std::vector<CustomOp> custom_operations;
 
+  /** Weighted mixture of custom operation chains to use in `Mode::Custom` instead of a single chain. Each thread picks
+   * the chain of each iteration randomly based on the weights, and the results contain the ops/s and latency per
+   * chain. Specify as `custom_operations` string with weights in YAML, e.g., "0.9: r_512 | 0.1: r_512,w_64_cache". See
+   * `WeightedCustomChain` for details. */
+  std::vector<WeightedCustomChain> custom_chain_mixture;
+
+  /** Named memory regions that custom operations can access in addition to the PMem and DRAM range. Specify as YAML
+   * map from name to `size`, `memory` (pmem or dram), `numa_node` (only DRAM), and `distribution` (uniform or zipf with
+   * `zipf_alpha`), e.g., `idx: {size: 1G, memory: dram, distribution: zipf}`. See `CustomRegion` for details. */
+  std::vector<CustomRegion> custom_regions;
+
   /** Frequency in which to sample latency of custom operations. Only works in combination with `Mode::Custom`. */
   uint64_t latency_sample_frequency = 0;
 
+  /** Number of independent instances of the `custom_operations` chain that each thread interleaves, e.g., 8 keeps up to
+   * 8 cache misses of latency-bound chains like r_512,r_512 in flight. Each thread switches to the next instance after
+   * every operation and prefetches the instance's next access, so that the misses overlap. Only works in combination
+   * with `Mode::Custom` and without latency sampling. */
+  uint32_t mlp_width = 1;
+
+  /** Number of operations per second that all threads together start, e.g., to measure the latency at a given load
+   * instead of at peak throughput. Each thread schedules its share of the operations at the intervals of the
+   * `arrival_pattern` and measures the latency of each operation from its intended start, not from its actual one. A
+   * thread that falls behind its schedule starts the next operations right away, so the latency contains the queueing
+   * delay that closed-loop measurements omit. An operation is a single access in sequential and random execution and a
+   * chain in custom execution. 0 runs closed-loop at peak throughput. Does not work with latency sampling or
+   * `mlp_width` > 1. */
+  double target_ops_per_second = 0;
+
+  /** Alternative to `target_ops_per_second` that sets the rate in Byte per second, e.g., 2G. The benchmark divides it
+   * by the average number of Bytes that an operation accesses. */
+  uint64_t target_bandwidth = 0;
+
+  /** Intervals between the operations of a rate-limited thread, i.e., "fixed" or "poisson". */
+  ArrivalPattern arrival_pattern = ArrivalPattern::Fixed;
+
   /** Whether or not to prefault the memory region before writing to it. If set to false, the benchmark will include the
    * time caused by page faults on first access to the allocated memory region. */
   bool prefault_file = true;
@@ -145,12 +357,25 @@ struct BenchmarkConfig {
   bool contains_read_op() const;
   bool contains_write_op() const;
   bool contains_dram_op() const;
+  bool is_mixed_read_write() const;
+  bool has_variable_access_size() const;
+  bool has_explicit_fences() const;
+  bool has_compute_ops() const;
+
+  /** Returns true if `target_ops_per_second` or `target_bandwidth` is set. */
+  bool is_rate_limited() const;
+
+  /** Returns the `custom_chain_mixture` or the `custom_operations` as a single chain if there is no mixture. */
+  std::vector<WeightedCustomChain> get_custom_chains() const;
+
+  /** Returns the index of the `custom_regions` entry with the given name or -1 if there is no such region. */
+  int32_t get_custom_region_index(const std::string& name) const;
 
   nlohmann::json as_json() const;
 };
 
 struct ConfigEnums {
-  // <read or write, is_pmem>
+  // <read, write, or prefetch, is_pmem>
   using OpLocation = std::pair<perma::Operation, bool>;
 
   static const std::unordered_map<std::string, bool> str_to_mem_type;
@@ -158,8 +383,16 @@ struct ConfigEnums {
   static const std::unordered_map<std::string, Operation> str_to_operation;
   static const std::unordered_map<std::string, OpLocation> str_to_op_location;
   static const std::unordered_map<std::string, NumaPattern> str_to_numa_pattern;
+  static const std::unordered_map<std::string, MixPattern> str_to_mix_pattern;
   static const std::unordered_map<std::string, PersistInstruction> str_to_persist_instruction;
+  static const std::unordered_map<std::string, ReadInstruction> str_to_read_instruction;
+  static const std::unordered_map<std::string, PrefetchHint> str_to_prefetch_hint;
+  static const std::unordered_map<std::string, Checksum> str_to_checksum;
+  static const std::unordered_map<std::string, DataPattern> str_to_data_pattern;
+  static const std::unordered_map<std::string, CacheState> str_to_cache_state;
+  static const std::unordered_map<std::string, ArrivalPattern> str_to_arrival_pattern;
   static const std::unordered_map<std::string, RandomDistribution> str_to_random_distribution;
+  static const std::unordered_map<std::string, SizeDistribution> str_to_size_distribution;
 
   // Map to convert a K/M/G suffix to the correct kibi, mebi-, gibibyte value.
   static const std::unordered_map<char, uint64_t> scale_suffix_to_factor;
@@ -2,8 +2,263 @@
 
 #include <yaml-cpp/yaml.h>
 
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <set>
 #include <string>
 
+namespace {
+
+constexpr auto MATRIX_ZIP = "zip";
+constexpr auto MATRIX_EXCLUDE = "exclude";
+constexpr auto MATRIX_WHERE = "where";
+
+// Parallel benchmarks expand their sub-benchmarks' matrices themselves, which a matrix search would silently skip.
+constexpr auto PARALLEL_MATRIX_SEARCH_ERROR =
+    "Matrix searches are not supported for parallel benchmarks. Remove the 'matrix_search' to run the full matrices.";
+
+// Args of a matrix whose values advance together. `values` holds the sequence of values of each arg.
+struct MatrixAxis {
+  std::vector<std::string> arg_names;
+  std::vector<std::vector<YAML::Node>> values;
+};
+
+// Pairs of matrix args and values. A config is excluded if it has all of these values.
+using MatrixExclusion = std::vector<std::pair<std::string, std::string>>;
+
+std::vector<YAML::Node> sequence_to_vector(const YAML::Node& sequence) {
+  std::vector<YAML::Node> values{};
+  for (const YAML::Node& value : sequence) {
+    values.push_back(value);
+  }
+  return values;
+}
+
+// Parses a number with an optional size suffix, e.g., 64, 0.5, or 10G.
+bool parse_matrix_number(const std::string& str, double* number) {
+  std::string number_str = str;
+  double factor = 1;
+  auto suffix_it = perma::ConfigEnums::scale_suffix_to_factor.find(str.empty() ? ' ' : str.back());
+  if (suffix_it != perma::ConfigEnums::scale_suffix_to_factor.end()) {
+    factor = static_cast<double>(suffix_it->second);
+    number_str.pop_back();
+  }
+
+  char* end;
+  const double parsed = std::strtod(number_str.c_str(), &end);
+  if (number_str.empty() || end != number_str.c_str() + number_str.size()) {
+    return false;
+  }
+  *number = parsed * factor;
+  return true;
+}
+
+/**
+ * A `where` constraint of a matrix, e.g., "access_size <= memory_range / number_threads". Both sides of the comparison
+ * are arithmetic expressions with +, -, *, /, and parentheses over numbers and args of the config.
+ */
+class MatrixConstraint {
+ public:
+  MatrixConstraint(const std::string& constraint, std::function<double(const std::string&)> resolve_arg)
+      : constraint_{constraint}, resolve_arg_{std::move(resolve_arg)} {
+    for (size_t pos = 0; pos < constraint.size();) {
+      const char c = constraint[pos];
+      if (std::isspace(c)) {
+        ++pos;
+      } else if (std::isalnum(c) || c == '_' || c == '.') {
+        const size_t token_start = pos;
+        while (pos < constraint.size() && (std::isalnum(constraint[pos]) || constraint[pos] == '_' ||
+                                           constraint[pos] == '.')) {
+          ++pos;
+        }
+        tokens_.push_back(constraint.substr(token_start, pos - token_start));
+      } else if (pos + 1 < constraint.size() && constraint[pos + 1] == '=' && std::strchr("<>=!", c) != nullptr) {
+        tokens_.push_back(constraint.substr(pos, 2));
+        pos += 2;
+      } else if (std::strchr("<>+-*/()", c) != nullptr) {
+        tokens_.emplace_back(1, c);
+        ++pos;
+      } else {
+        throw_invalid();
+      }
+    }
+  }
+
+  bool holds() {
+    token_idx_ = 0;
+    const double lhs = parse_sum();
+    const std::string comparison = next_token();
+    const double rhs = parse_sum();
+    if (token_idx_ != tokens_.size()) {
+      throw_invalid();
+    }
+
+    if (comparison == "<") {
+      return lhs < rhs;
+    } else if (comparison == "<=") {
+      return lhs <= rhs;
+    } else if (comparison == ">") {
+      return lhs > rhs;
+    } else if (comparison == ">=") {
+      return lhs >= rhs;
+    } else if (comparison == "==") {
+      return lhs == rhs;
+    } else if (comparison == "!=") {
+      return lhs != rhs;
+    }
+    throw_invalid();
+  }
+
+ private:
+  double parse_sum() {
+    double value = parse_product();
+    while (peek_token() == "+" || peek_token() == "-") {
+      value = next_token() == "+" ? value + parse_product() : value - parse_product();
+    }
+    return value;
+  }
+
+  double parse_product() {
+    double value = parse_factor();
+    while (peek_token() == "*" || peek_token() == "/") {
+      value = next_token() == "*" ? value * parse_factor() : value / parse_factor();
+    }
+    return value;
+  }
+
+  double parse_factor() {
+    const std::string token = next_token();
+    if (token == "(") {
+      const double value = parse_sum();
+      if (next_token() != ")") {
+        throw_invalid();
+      }
+      return value;
+    }
+    if (token == "-") {
+      return -parse_factor();
+    }
+
+    double number;
+    if (parse_matrix_number(token, &number)) {
+      return number;
+    }
+    if (!std::isalpha(token[0]) && token[0] != '_') {
+      throw_invalid();
+    }
+    return resolve_arg_(token);
+  }
+
+  const std::string& peek_token() const {
+    static const std::string end_token{};
+    return token_idx_ < tokens_.size() ? tokens_[token_idx_] : end_token;
+  }
+
+  std::string next_token() {
+    if (token_idx_ == tokens_.size()) {
+      throw_invalid();
+    }
+    return tokens_[token_idx_++];
+  }
+
+  [[noreturn]] void throw_invalid() const {
+    throw std::invalid_argument("Invalid matrix 'where' constraint: '" + constraint_ + "'.");
+  }
+
+  const std::string constraint_;
+  const std::function<double(const std::string&)> resolve_arg_;
+  std::vector<std::string> tokens_{};
+  size_t token_idx_ = 0;
+};
+
+MatrixAxis create_zip_axis(YAML::Node& zip_group) {
+  if (!zip_group.IsMap() || zip_group.size() == 0) {
+    throw std::invalid_argument("Matrix 'zip' groups must be YAML maps of sequences.");
+  }
+
+  MatrixAxis axis{};
+  for (YAML::iterator it = zip_group.begin(); it != zip_group.end(); ++it) {
+    YAML::Node values = it->second;
+    if (!values.IsSequence() || (!axis.values.empty() && values.size() != axis.values[0].size())) {
+      throw std::invalid_argument("All entries of a matrix 'zip' group must be YAML sequences of the same length.");
+    }
+    axis.arg_names.push_back(it->first.as<std::string>());
+    axis.values.push_back(sequence_to_vector(values));
+  }
+  return axis;
+}
+
+std::vector<MatrixExclusion> create_matrix_exclusions(YAML::Node& exclude, const std::vector<MatrixAxis>& axes) {
+  if (exclude.IsNull()) {
+    return {};
+  }
+  if (!exclude.IsSequence()) {
+    throw std::invalid_argument("Matrix 'exclude' must be a list of maps of matrix args to their values.");
+  }
+
+  std::vector<MatrixExclusion> exclusions{};
+  for (YAML::Node entry : exclude) {
+    if (!entry.IsMap()) {
+      throw std::invalid_argument("Matrix 'exclude' must be a list of maps of matrix args to their values.");
+    }
+
+    MatrixExclusion exclusion{};
+    for (YAML::iterator it = entry.begin(); it != entry.end(); ++it) {
+      const auto arg_name = it->first.as<std::string>();
+      const bool is_matrix_arg = std::any_of(axes.begin(), axes.end(), [&](const MatrixAxis& axis) {
+        return std::find(axis.arg_names.begin(), axis.arg_names.end(), arg_name) != axis.arg_names.end();
+      });
+      if (!is_matrix_arg) {
+        throw std::invalid_argument("Matrix 'exclude' contains '" + arg_name + "', which is not a matrix arg.");
+      }
+      exclusion.emplace_back(arg_name, it->second.as<std::string>());
+    }
+    exclusions.push_back(std::move(exclusion));
+  }
+  return exclusions;
+}
+
+// Returns true if the args match one of the `exclusions` or violate one of the `constraints`.
+bool is_excluded(const YAML::Node& config_args, const std::vector<MatrixExclusion>& exclusions,
+                 const std::vector<std::string>& constraints) {
+  for (const MatrixExclusion& exclusion : exclusions) {
+    const bool matches =
+        std::all_of(exclusion.begin(), exclusion.end(), [&](const std::pair<std::string, std::string>& arg) {
+          return config_args[arg.first].as<std::string>() == arg.second;
+        });
+    if (matches) {
+      return true;
+    }
+  }
+
+  // Constraints are checked before decoding the config, as they usually skip configs that would not be valid.
+  auto resolve_arg = [&](const std::string& arg_name) {
+    const YAML::Node value = config_args[arg_name];
+    double number;
+    if (value.IsDefined()) {
+      if (value.IsScalar() && parse_matrix_number(value.as<std::string>(), &number)) {
+        return number;
+      }
+      throw std::invalid_argument("Matrix 'where' uses '" + arg_name + "', which is not a numeric arg.");
+    }
+
+    static const nlohmann::json default_config = perma::BenchmarkConfig{}.as_json();
+    if (default_config.contains(arg_name) && default_config[arg_name].is_number()) {
+      return default_config[arg_name].get<double>();
+    }
+    throw std::invalid_argument("Matrix 'where' uses '" + arg_name + "', which is not a numeric arg.");
+  };
+  return std::any_of(constraints.begin(), constraints.end(), [&](const std::string& constraint) {
+    return !MatrixConstraint{constraint, resolve_arg}.holds();
+  });
+}
+
+}  // namespace
+
 namespace perma {
 
 std::vector<SingleBenchmark> BenchmarkFactory::create_single_benchmarks(const std::filesystem::path& pmem_directory,
@@ -16,9 +271,15 @@ std::vector<SingleBenchmark> BenchmarkFactory::create_single_benchmarks(const st
       const auto name = it->first.as<std::string>();
       YAML::Node raw_bm_args = it->second;
 
-      // Ignore parallel benchmarks
+      // Ignore parallel, loaded-latency, SLO search, matrix search, thread ramp, and phased benchmarks
       YAML::Node parallel_bm = raw_bm_args["parallel_benchmark"];
-      if (parallel_bm.IsDefined()) {
+      YAML::Node loaded_latency_bm = raw_bm_args["loaded_latency_benchmark"];
+      YAML::Node slo_search = raw_bm_args["slo_search"];
+      YAML::Node matrix_search = raw_bm_args["matrix_search"];
+      YAML::Node thread_ramp = raw_bm_args["thread_ramp"];
+      YAML::Node phases = raw_bm_args["phases"];
+      if (parallel_bm.IsDefined() || loaded_latency_bm.IsDefined() || slo_search.IsDefined() ||
+          matrix_search.IsDefined() || thread_ramp.IsDefined() || phases.IsDefined()) {
         continue;
       }
 
@@ -79,51 +340,441 @@ std::vector<ParallelBenchmark> BenchmarkFactory::create_parallel_benchmarks(cons
         continue;
       }
 
-      if (parallel_bm.size() != 2) {
-        throw std::invalid_argument{"Number of parallel benchmarks should be two."};
+      if (!parallel_bm.IsMap() || parallel_bm.size() < 2) {
+        throw std::invalid_argument{"Parallel benchmarks need at least two sub-benchmarks."};
+      }
+      if (raw_par_bm["matrix_search"].IsDefined()) {
+        throw std::invalid_argument{PARALLEL_MATRIX_SEARCH_ERROR};
       }
 
-      std::vector<BenchmarkConfig> bm_one_configs{};
-      std::vector<BenchmarkConfig> bm_two_configs{};
-      std::string unique_name_one;
-      std::string unique_name_two;
-
+      const size_t num_sub_bms = parallel_bm.size();
+      std::vector<std::vector<BenchmarkConfig>> sub_bm_configs(num_sub_bms);
+      std::vector<std::string> sub_bm_names(num_sub_bms);
+      std::vector<std::filesystem::path> pmem_data_files{};
       YAML::iterator par_it = parallel_bm.begin();
-      parse_yaml_node(pmem_directory, bm_one_configs, par_it, unique_name_one, use_dram);
-      par_it++;
-      parse_yaml_node(pmem_directory, bm_two_configs, par_it, unique_name_two, use_dram);
-
-      const std::filesystem::path pmem_data_file_one = utils::generate_random_file_name(pmem_directory);
-      const std::filesystem::path pmem_data_file_two = utils::generate_random_file_name(pmem_directory);
-      // Build cartesian product of both benchmarks
-      for (const BenchmarkConfig& config_one : bm_one_configs) {
-        for (const BenchmarkConfig& config_two : bm_two_configs) {
-          // Generate unique file for benchmarks that write or reuse existing file for read-only benchmarks.
-          std::vector<std::unique_ptr<BenchmarkExecution>> executions{};
-          executions.push_back(std::make_unique<BenchmarkExecution>());
-          executions.push_back(std::make_unique<BenchmarkExecution>());
+      for (size_t sub_bm = 0; sub_bm < num_sub_bms; ++sub_bm, ++par_it) {
+        parse_yaml_node(pmem_directory, sub_bm_configs[sub_bm], par_it, sub_bm_names[sub_bm], use_dram);
+        pmem_data_files.push_back(utils::generate_random_file_name(pmem_directory));
+      }
 
-          std::vector<std::unique_ptr<BenchmarkResult>> results{};
-          results.push_back(std::make_unique<BenchmarkResult>(config_one));
-          results.push_back(std::make_unique<BenchmarkResult>(config_two));
-
-          if (config_one.contains_write_op() && config_two.contains_write_op()) {
-            benchmarks.emplace_back(name, unique_name_one, unique_name_two, config_one, config_two,
-                                    std::move(executions), std::move(results));
-          } else if (config_one.contains_write_op()) {
-            // Reorder benchmarks if the first benchmark is read-only and the second writing
-            std::swap(results[0], results[1]);
-            benchmarks.emplace_back(name, unique_name_two, unique_name_one, config_two, config_one,
-                                    std::move(executions), std::move(results), pmem_data_file_two);
-          } else if (config_two.contains_write_op()) {
-            benchmarks.emplace_back(name, unique_name_one, unique_name_two, config_one, config_two,
-                                    std::move(executions), std::move(results), pmem_data_file_one);
-          } else {
-            benchmarks.emplace_back(name, unique_name_one, unique_name_two, config_one, config_two,
-                                    std::move(executions), std::move(results), pmem_data_file_one, pmem_data_file_two);
+      // In a shared region, all sub-benchmarks access the same data at the `region_offset` of their config.
+      const bool shared_region = raw_par_bm["shared_region"].as<bool>(false);
+      for (const std::vector<BenchmarkConfig>& configs_of_sub_bm : sub_bm_configs) {
+        for (const BenchmarkConfig& sub_bm_config : configs_of_sub_bm) {
+          if (sub_bm_config.region_offset > 0 && !shared_region) {
+            throw std::invalid_argument{"Sub-benchmarks can only set a 'region_offset' with 'shared_region'."};
           }
         }
       }
+
+      // Takes the index of each sub-benchmark's config.
+      auto add_benchmark = [&](const std::vector<size_t>& config_indices) {
+        // Read-only sub-benchmarks come first and reuse their existing file. Writing benchmarks generate a unique file.
+        // A shared region is always new, as the writing sub-benchmarks modify it.
+        std::vector<size_t> order(num_sub_bms);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_partition(order.begin(), order.end(), [&](const size_t sub_bm) {
+          return !sub_bm_configs[sub_bm][config_indices[sub_bm]].contains_write_op();
+        });
+
+        std::vector<std::string> names{};
+        std::vector<BenchmarkConfig> bm_configs{};
+        std::vector<std::filesystem::path> reused_pmem_files{};
+        std::vector<std::unique_ptr<BenchmarkExecution>> executions{};
+        std::vector<std::unique_ptr<BenchmarkResult>> results{};
+        for (const size_t sub_bm : order) {
+          const BenchmarkConfig& sub_bm_config = sub_bm_configs[sub_bm][config_indices[sub_bm]];
+          names.push_back(sub_bm_names[sub_bm]);
+          bm_configs.push_back(sub_bm_config);
+          reused_pmem_files.push_back(sub_bm_config.contains_write_op() || shared_region ? std::filesystem::path{}
+                                                                                         : pmem_data_files[sub_bm]);
+          executions.push_back(std::make_unique<BenchmarkExecution>());
+          results.push_back(std::make_unique<BenchmarkResult>(sub_bm_config));
+        }
+        benchmarks.emplace_back(name, std::move(names), bm_configs, std::move(executions), std::move(results),
+                                reused_pmem_files, shared_region);
+      };
+
+      // With `zip_matrices`, the i-th configs of all sub-benchmarks run together and sub-benchmarks without a matrix
+      // run with each of them. Otherwise, we build the cartesian product of all sub-benchmarks. To avoid an explosion
+      // of combinations, more than two sub-benchmarks are zipped by default.
+      std::vector<size_t> config_indices(num_sub_bms, 0);
+      if (raw_par_bm["zip_matrices"].as<bool>(num_sub_bms > 2)) {
+        size_t num_configs = 1;
+        for (const std::vector<BenchmarkConfig>& configs_of_sub_bm : sub_bm_configs) {
+          if (configs_of_sub_bm.size() != 1 && num_configs != 1 && configs_of_sub_bm.size() != num_configs) {
+            throw std::invalid_argument{"Parallel benchmarks with 'zip_matrices' need matrices of the same size."};
+          }
+          num_configs = std::max(num_configs, configs_of_sub_bm.size());
+        }
+        for (size_t config_idx = 0; config_idx < num_configs; ++config_idx) {
+          for (size_t sub_bm = 0; sub_bm < num_sub_bms; ++sub_bm) {
+            config_indices[sub_bm] = sub_bm_configs[sub_bm].size() == 1 ? 0 : config_idx;
+          }
+          add_benchmark(config_indices);
+        }
+      } else {
+        // The configs of the last sub-benchmark advance first.
+        std::function<void(size_t)> add_cartesian_product = [&](const size_t sub_bm) {
+          if (sub_bm == num_sub_bms) {
+            add_benchmark(config_indices);
+            return;
+          }
+          for (size_t config_idx = 0; config_idx < sub_bm_configs[sub_bm].size(); ++config_idx) {
+            config_indices[sub_bm] = config_idx;
+            add_cartesian_product(sub_bm + 1);
+          }
+        };
+        add_cartesian_product(0);
+      }
+    }
+  }
+  return benchmarks;
+}
+
+std::vector<LoadedLatencyBenchmark> BenchmarkFactory::create_loaded_latency_benchmarks(
+    const std::filesystem::path& pmem_directory, std::vector<YAML::Node>& configs, const bool use_dram) {
+  std::vector<LoadedLatencyBenchmark> benchmarks{};
+
+  for (YAML::Node& config : configs) {
+    for (YAML::iterator it = config.begin(); it != config.end(); ++it) {
+      const auto name = it->first.as<std::string>();
+      YAML::Node raw_bm = it->second;
+
+      // Only consider loaded-latency nodes
+      YAML::Node loaded_latency_bm = raw_bm["loaded_latency_benchmark"];
+      if (!loaded_latency_bm.IsDefined()) {
+        continue;
+      }
+
+      if (loaded_latency_bm.size() != 2) {
+        throw std::invalid_argument{"Number of loaded-latency benchmarks should be two, i.e., latency and bandwidth."};
+      }
+
+      YAML::Node injection_rates = raw_bm["injection_rates"];
+      if (!injection_rates.IsSequence() || injection_rates.size() == 0) {
+        throw std::invalid_argument{"Loaded-latency benchmarks require 'injection_rates' as a non-empty sequence."};
+      }
+
+      YAML::iterator sub_bm_it = loaded_latency_bm.begin();
+      std::vector<BenchmarkConfig> latency_configs{};
+      std::string latency_name;
+      parse_yaml_node(pmem_directory, latency_configs, sub_bm_it, latency_name, use_dram);
+      sub_bm_it++;
+      const auto bandwidth_name = sub_bm_it->first.as<std::string>();
+      YAML::Node bandwidth_args = sub_bm_it->second["args"];
+
+      if (latency_configs.size() != 1 || sub_bm_it->second["matrix"] || !bandwidth_args) {
+        throw std::invalid_argument{"Loaded-latency benchmarks must contain 'args' and no 'matrix'."};
+      }
+
+      BenchmarkConfig& latency_config = latency_configs[0];
+      latency_config.is_hybrid = latency_config.contains_dram_op();
+      const bool has_latencies = latency_config.latency_sample_frequency > 0 || latency_config.is_rate_limited();
+      if (latency_config.exec_mode != Mode::Custom || !has_latencies) {
+        throw std::invalid_argument{
+            "The latency benchmark must run custom operations with a latency_sample_frequency or target rate."};
+      }
+
+      if (bandwidth_args["target_bandwidth"] || bandwidth_args["target_ops_per_second"]) {
+        throw std::invalid_argument{"The bandwidth benchmark gets its target rate from the 'injection_rates'."};
+      }
+
+      // Each injection rate is the target bandwidth of one step. A rate of 0 runs the bandwidth threads unthrottled.
+      std::vector<BenchmarkConfig> bandwidth_step_configs{};
+      for (YAML::Node rate : injection_rates) {
+        YAML::Node step_args = YAML::Clone(bandwidth_args);
+        step_args["target_bandwidth"] = rate;
+        BenchmarkConfig step_config = BenchmarkConfig::decode(step_args);
+        step_config.pmem_directory = pmem_directory;
+        step_config.is_pmem = !use_dram;
+        step_config.is_hybrid = step_config.contains_dram_op();
+        if (step_config.exec_mode == Mode::Custom) {
+          throw std::invalid_argument{"The bandwidth benchmark must run sequential or random operations."};
+        }
+        bandwidth_step_configs.push_back(step_config);
+      }
+
+      std::vector<std::unique_ptr<BenchmarkExecution>> executions{};
+      std::vector<std::unique_ptr<BenchmarkResult>> results{};
+      for (const BenchmarkConfig& bandwidth_config : bandwidth_step_configs) {
+        executions.push_back(std::make_unique<BenchmarkExecution>());
+        executions.push_back(std::make_unique<BenchmarkExecution>());
+        results.push_back(std::make_unique<BenchmarkResult>(latency_config));
+        results.push_back(std::make_unique<BenchmarkResult>(bandwidth_config));
+      }
+
+      benchmarks.emplace_back(name, latency_name, bandwidth_name, latency_config, bandwidth_step_configs,
+                              std::move(executions), std::move(results));
+    }
+  }
+  return benchmarks;
+}
+
+std::vector<SloSearchBenchmark> BenchmarkFactory::create_slo_search_benchmarks(
+    const std::filesystem::path& pmem_directory, std::vector<YAML::Node>& configs, const bool use_dram) {
+  std::vector<SloSearchBenchmark> benchmarks{};
+
+  for (YAML::Node& config : configs) {
+    for (YAML::iterator it = config.begin(); it != config.end(); ++it) {
+      const auto name = it->first.as<std::string>();
+      YAML::Node raw_bm = it->second;
+
+      // Only consider SLO search nodes
+      YAML::Node slo_search = raw_bm["slo_search"];
+      if (!slo_search.IsDefined()) {
+        continue;
+      }
+
+      YAML::Node bm_args = raw_bm["args"];
+      if (!slo_search.IsMap() || !bm_args || raw_bm["matrix"]) {
+        throw std::invalid_argument{"SLO searches must contain a 'slo_search' map, 'args', and no 'matrix'."};
+      }
+
+      const auto parameter_str = slo_search["parameter"].as<std::string>("");
+      const auto parameter_it = SloSearchConfig::str_to_search_parameter.find(parameter_str);
+      if (parameter_it == SloSearchConfig::str_to_search_parameter.end()) {
+        throw std::invalid_argument{"SLO search 'parameter' must be 'target_ops_per_second' or 'number_threads'."};
+      }
+
+      SloSearchConfig search_config{};
+      search_config.parameter = parameter_it->second;
+      search_config.min = slo_search["min"].as<double>(0);
+      search_config.max = slo_search["max"].as<double>(0);
+      search_config.latency_percentile = slo_search["latency_percentile"].as<double>(search_config.latency_percentile);
+      search_config.max_latency_ns = slo_search["max_latency_ns"].as<uint64_t>(0);
+      search_config.max_probes = slo_search["max_probes"].as<uint32_t>(search_config.max_probes);
+
+      const bool is_number_threads = search_config.parameter == SloSearchParameter::NumberThreads;
+      const bool is_integer_range = std::floor(search_config.min) == search_config.min &&
+                                    std::floor(search_config.max) == search_config.max;
+      const bool is_valid_range = search_config.min > 0 && search_config.min < search_config.max;
+      if (!is_valid_range || (is_number_threads && !is_integer_range)) {
+        throw std::invalid_argument{"SLO search requires 0 < min < max, with whole numbers for number_threads."};
+      }
+      if (search_config.latency_percentile <= 0 || search_config.latency_percentile > 100 ||
+          search_config.max_latency_ns == 0 || search_config.max_probes < 2) {
+        throw std::invalid_argument{
+            "SLO search requires a latency_percentile in (0, 100], a max_latency_ns, and at least 2 max_probes."};
+      }
+      if (bm_args[parameter_str] || (!is_number_threads && bm_args["target_bandwidth"])) {
+        throw std::invalid_argument{"The SLO search sets the '" + parameter_str + "' of each probe."};
+      }
+
+      // Decode the config at both ends of the range, so that invalid probes fail before the search starts.
+      std::vector<BenchmarkConfig> range_configs{};
+      for (const double bound : {search_config.min, search_config.max}) {
+        YAML::Node probe_args = YAML::Clone(bm_args);
+        if (is_number_threads) {
+          probe_args[parameter_str] = static_cast<uint16_t>(bound);
+        } else {
+          probe_args[parameter_str] = bound;
+        }
+        range_configs.push_back(BenchmarkConfig::decode(probe_args));
+      }
+
+      BenchmarkConfig& bm_config = range_configs[0];
+      bm_config.pmem_directory = pmem_directory;
+      bm_config.is_pmem = !use_dram;
+      bm_config.is_hybrid = bm_config.contains_dram_op();
+      const bool has_latencies = bm_config.is_rate_limited() ||
+                                 (bm_config.exec_mode == Mode::Custom && bm_config.latency_sample_frequency > 0);
+      if (!has_latencies) {
+        throw std::invalid_argument{
+            "SLO searches need latencies, i.e., a target rate or custom operations with a latency_sample_frequency."};
+      }
+
+      benchmarks.emplace_back(name, bm_config, search_config);
+    }
+  }
+  return benchmarks;
+}
+
+std::vector<MatrixSearchBenchmark> BenchmarkFactory::create_matrix_search_benchmarks(
+    const std::filesystem::path& pmem_directory, std::vector<YAML::Node>& configs, const bool use_dram) {
+  std::vector<MatrixSearchBenchmark> benchmarks{};
+
+  for (YAML::Node& config : configs) {
+    for (YAML::iterator it = config.begin(); it != config.end(); ++it) {
+      const auto name = it->first.as<std::string>();
+      YAML::Node raw_bm = it->second;
+
+      // Only consider matrix search nodes
+      YAML::Node matrix_search = raw_bm["matrix_search"];
+      if (!matrix_search.IsDefined()) {
+        continue;
+      }
+      if (raw_bm["parallel_benchmark"].IsDefined()) {
+        throw std::invalid_argument{PARALLEL_MATRIX_SEARCH_ERROR};
+      }
+
+      YAML::Node bm_args = raw_bm["args"];
+      YAML::Node bm_matrix = raw_bm["matrix"];
+      if (!matrix_search.IsMap() || !bm_args || !bm_matrix) {
+        throw std::invalid_argument{"Matrix searches must contain a 'matrix_search' map, 'args', and a 'matrix'."};
+      }
+
+      const auto strategy_str = matrix_search["strategy"].as<std::string>("adaptive");
+      const auto strategy_it = MatrixSearchConfig::str_to_strategy.find(strategy_str);
+      if (strategy_it == MatrixSearchConfig::str_to_strategy.end()) {
+        throw std::invalid_argument{"Matrix search 'strategy' must be 'latin_hypercube' or 'adaptive'."};
+      }
+
+      MatrixSearchConfig search_config{};
+      search_config.strategy = strategy_it->second;
+      search_config.samples = matrix_search["samples"].as<uint32_t>(0);
+      search_config.refine_threshold = matrix_search["refine_threshold"].as<double>(search_config.refine_threshold);
+      search_config.max_runs = matrix_search["max_runs"].as<uint32_t>(search_config.max_runs);
+      const bool is_latin_hypercube = search_config.strategy == MatrixSearchStrategy::LatinHypercube;
+      if ((is_latin_hypercube && search_config.samples == 0) || search_config.refine_threshold < 0 ||
+          search_config.max_runs == 0) {
+        throw std::invalid_argument{
+            "Matrix searches require samples > 0 for 'latin_hypercube', a refine_threshold >= 0, and max_runs > 0."};
+      }
+
+      std::vector<MatrixDimension> dimensions{};
+      std::vector<BenchmarkConfig> matrix =
+          create_benchmark_matrix(pmem_directory, bm_args, bm_matrix, use_dram, &dimensions);
+
+      benchmarks.emplace_back(name, matrix, std::move(dimensions), search_config);
+    }
+  }
+  return benchmarks;
+}
+
+std::vector<ThreadRampBenchmark> BenchmarkFactory::create_thread_ramp_benchmarks(
+    const std::filesystem::path& pmem_directory, std::vector<YAML::Node>& configs, const bool use_dram) {
+  std::vector<ThreadRampBenchmark> benchmarks{};
+
+  for (YAML::Node& config : configs) {
+    for (YAML::iterator it = config.begin(); it != config.end(); ++it) {
+      const auto name = it->first.as<std::string>();
+      YAML::Node raw_bm = it->second;
+
+      // Only consider thread ramp nodes
+      YAML::Node thread_ramp = raw_bm["thread_ramp"];
+      if (!thread_ramp.IsDefined()) {
+        continue;
+      }
+
+      YAML::Node bm_args = raw_bm["args"];
+      if (!thread_ramp.IsMap() || !bm_args || raw_bm["matrix"]) {
+        throw std::invalid_argument{"Thread ramps must contain a 'thread_ramp' map, 'args', and no 'matrix'."};
+      }
+
+      const auto mode_str = thread_ramp["mode"].as<std::string>("doubling");
+      const auto mode_it = ThreadRampConfig::str_to_mode.find(mode_str);
+      if (mode_it == ThreadRampConfig::str_to_mode.end()) {
+        throw std::invalid_argument{"Thread ramp 'mode' must be 'linear' or 'doubling'."};
+      }
+
+      ThreadRampConfig ramp_config{};
+      ramp_config.mode = mode_it->second;
+      ramp_config.max_threads = thread_ramp["max_threads"].as<uint16_t>(0);
+      ramp_config.step_threads = thread_ramp["step_threads"].as<uint16_t>(ramp_config.step_threads);
+      if (ramp_config.max_threads < 2 || ramp_config.step_threads == 0) {
+        throw std::invalid_argument{"Thread ramps require max_threads > 1 and step_threads > 0."};
+      }
+      if (bm_args["number_threads"]) {
+        throw std::invalid_argument{"The thread ramp sets the 'number_threads' of each step."};
+      }
+
+      // Each step is a fixed interval of the ramp, so that the bandwidth of all steps is comparable.
+      std::vector<BenchmarkConfig> step_configs{};
+      for (const uint16_t number_threads : ramp_config.get_step_threads()) {
+        YAML::Node step_args = YAML::Clone(bm_args);
+        step_args["number_threads"] = number_threads;
+        BenchmarkConfig step_config = BenchmarkConfig::decode(step_args);
+        step_config.pmem_directory = pmem_directory;
+        step_config.is_pmem = !use_dram;
+        step_config.is_hybrid = step_config.contains_dram_op();
+        if (step_config.exec_mode == Mode::Custom || step_config.run_time == 0) {
+          throw std::invalid_argument{
+              "Thread ramps must run sequential or random operations with a 'run_time', i.e., the length of a step."};
+        }
+        step_configs.push_back(step_config);
+      }
+
+      std::vector<std::unique_ptr<BenchmarkExecution>> executions{};
+      std::vector<std::unique_ptr<BenchmarkResult>> results{};
+      for (const BenchmarkConfig& step_config : step_configs) {
+        executions.push_back(std::make_unique<BenchmarkExecution>());
+        results.push_back(std::make_unique<BenchmarkResult>(step_config));
+      }
+
+      benchmarks.emplace_back(name, step_configs, ramp_config, std::move(executions), std::move(results));
+    }
+  }
+  return benchmarks;
+}
+
+std::vector<PhasedBenchmark> BenchmarkFactory::create_phased_benchmarks(const std::filesystem::path& pmem_directory,
+                                                                        std::vector<YAML::Node>& configs,
+                                                                        const bool use_dram) {
+  std::vector<PhasedBenchmark> benchmarks{};
+
+  for (YAML::Node& config : configs) {
+    for (YAML::iterator it = config.begin(); it != config.end(); ++it) {
+      const auto name = it->first.as<std::string>();
+      YAML::Node raw_bm = it->second;
+
+      // Only consider phased nodes
+      YAML::Node phases = raw_bm["phases"];
+      if (!phases.IsDefined()) {
+        continue;
+      }
+
+      if (!phases.IsSequence() || phases.size() == 0 || raw_bm["matrix"]) {
+        throw std::invalid_argument{"Phased benchmarks must contain 'phases' as a non-empty sequence and no 'matrix'."};
+      }
+
+      // The optional `args` of the benchmark are shared by all phases. Each phase can override them with its own args.
+      YAML::Node shared_args = raw_bm["args"];
+      std::vector<std::string> phase_names{};
+      std::vector<BenchmarkConfig> phase_configs{};
+      for (YAML::Node phase : phases) {
+        YAML::Node phase_args = phase["args"];
+        if (!phase.IsMap() || !phase_args.IsMap()) {
+          throw std::invalid_argument{"Each phase must be a map with 'args'."};
+        }
+
+        YAML::Node merged_args = shared_args ? YAML::Clone(shared_args) : YAML::Node{YAML::NodeType::Map};
+        for (YAML::const_iterator arg_it = phase_args.begin(); arg_it != phase_args.end(); ++arg_it) {
+          merged_args[arg_it->first.as<std::string>()] = YAML::Clone(arg_it->second);
+        }
+
+        BenchmarkConfig phase_config = BenchmarkConfig::decode(merged_args);
+        phase_config.pmem_directory = pmem_directory;
+        phase_config.is_pmem = !use_dram;
+        phase_config.is_hybrid = phase_config.contains_dram_op();
+        phase_configs.push_back(phase_config);
+        phase_names.push_back(phase["name"].as<std::string>("phase_" + std::to_string(phase_configs.size())));
+      }
+
+      // All phases access the same data, which is only created once.
+      const BenchmarkConfig& first_phase = phase_configs[0];
+      for (const BenchmarkConfig& phase_config : phase_configs) {
+        const bool has_same_regions =
+            std::equal(phase_config.custom_regions.begin(), phase_config.custom_regions.end(),
+                       first_phase.custom_regions.begin(), first_phase.custom_regions.end(),
+                       [](const CustomRegion& lhs, const CustomRegion& rhs) {
+                         return lhs.name == rhs.name && lhs.size == rhs.size && lhs.is_pmem == rhs.is_pmem;
+                       });
+        if (phase_config.memory_range != first_phase.memory_range ||
+            phase_config.dram_memory_range != first_phase.dram_memory_range || !has_same_regions) {
+          throw std::invalid_argument{
+              "All phases must have the same memory_range, dram_memory_range, and custom_regions."};
+        }
+      }
+
+      std::vector<std::unique_ptr<BenchmarkExecution>> executions{};
+      std::vector<std::unique_ptr<BenchmarkResult>> results{};
+      for (const BenchmarkConfig& phase_config : phase_configs) {
+        executions.push_back(std::make_unique<BenchmarkExecution>());
+        results.push_back(std::make_unique<BenchmarkResult>(phase_config));
+      }
+
+      benchmarks.emplace_back(name, std::move(phase_names), phase_configs, std::move(executions), std::move(results));
     }
   }
   return benchmarks;
@@ -154,19 +805,77 @@ void BenchmarkFactory::parse_yaml_node(const std::filesystem::path& pmem_directo
 
 std::vector<BenchmarkConfig> BenchmarkFactory::create_benchmark_matrix(const std::filesystem::path& pmem_directory,
                                                                        YAML::Node& config_args, YAML::Node& matrix_args,
-                                                                       const bool use_dram) {
+                                                                       const bool use_dram,
+                                                                       std::vector<MatrixDimension>* dimensions) {
   if (!matrix_args.IsMap()) {
     throw std::invalid_argument("'matrix' must be a YAML map.");
   }
 
-  std::vector<BenchmarkConfig> matrix{};
+  // Each axis of the matrix advances all of its args together. Only `zip` groups have more than one arg.
+  std::vector<MatrixAxis> axes{};
+  YAML::Node exclude{};
+  YAML::Node where{};
+  for (YAML::iterator it = matrix_args.begin(); it != matrix_args.end(); ++it) {
+    const auto arg_name = it->first.as<std::string>();
+    YAML::Node values = it->second;
+    if (arg_name == MATRIX_EXCLUDE) {
+      exclude = values;
+    } else if (arg_name == MATRIX_WHERE) {
+      where = values;
+    } else if (arg_name == MATRIX_ZIP) {
+      // A single group can be given as a map, multiple groups as a list of maps.
+      std::vector<YAML::Node> zip_groups = values.IsSequence() ? sequence_to_vector(values) : std::vector{values};
+      for (YAML::Node& zip_group : zip_groups) {
+        axes.push_back(create_zip_axis(zip_group));
+      }
+    } else if (!values.IsNull()) {
+      if (!values.IsSequence()) {
+        throw std::invalid_argument("Matrix entries must be a YAML sequence, i.e., [a, b, c].");
+      }
+      axes.push_back(MatrixAxis{{arg_name}, {sequence_to_vector(values)}});
+    }
+  }
+
+  const std::vector<MatrixExclusion> exclusions = create_matrix_exclusions(exclude, axes);
+  std::vector<std::string> constraints{};
+  if (where.IsScalar()) {
+    constraints.push_back(where.as<std::string>());
+  } else if (where.IsSequence()) {
+    for (const YAML::Node& constraint : where) {
+      constraints.push_back(constraint.as<std::string>());
+    }
+  } else if (!where.IsNull()) {
+    throw std::invalid_argument("Matrix 'where' must be a constraint or a list of constraints.");
+  }
+
   std::set<std::string> matrix_arg_names{};
+  for (const MatrixAxis& axis : axes) {
+    matrix_arg_names.insert(axis.arg_names.begin(), axis.arg_names.end());
+  }
 
-  std::function<void(const YAML::iterator&, YAML::Node&)> create_matrix = [&](const YAML::iterator& node_iterator,
-                                                                              YAML::Node& current_config) {
-    YAML::Node current_values = node_iterator->second;
-    if (node_iterator == matrix_args.end() || current_values.IsNull()) {
+  if (dimensions != nullptr) {
+    // Searches address the configs by their position in the full matrix, so they cannot skip any.
+    if (!exclusions.empty() || !constraints.empty()) {
+      throw std::invalid_argument("Matrix searches do not support 'exclude' or 'where' in the matrix.");
+    }
+    for (const MatrixAxis& axis : axes) {
+      std::string dimension_name = axis.arg_names[0];
+      for (size_t arg_idx = 1; arg_idx < axis.arg_names.size(); ++arg_idx) {
+        dimension_name += "+" + axis.arg_names[arg_idx];
+      }
+      dimensions->push_back(MatrixDimension{dimension_name, axis.values[0].size()});
+    }
+  }
+
+  std::vector<BenchmarkConfig> matrix{};
+  YAML::Node current_config = YAML::Clone(config_args);
+  std::function<void(size_t)> create_matrix = [&](const size_t axis_idx) {
+    if (axis_idx == axes.size()) {
       // End of matrix recursion.
+      if (is_excluded(current_config, exclusions, constraints)) {
+        return;
+      }
+
       // We need to copy here to keep the tags clean in the YAML.
       // Otherwise, everything is 'visited' after the first iteration and decoding fails.
       YAML::Node clean_config = YAML::Clone(current_config);
@@ -181,22 +890,16 @@ std::vector<BenchmarkConfig> BenchmarkFactory::create_benchmark_matrix(const std
       return;
     }
 
-    if (!current_values.IsSequence()) {
-      throw std::invalid_argument("Matrix entries must be a YAML sequence, i.e., [a, b, c].");
-    }
-
-    const auto arg_name = node_iterator->first.as<std::string>();
-    matrix_arg_names.insert(arg_name);
-    YAML::iterator next_node = node_iterator;
-    next_node++;
-    for (YAML::Node value : current_values) {
-      current_config[arg_name] = value;
-      create_matrix(next_node, current_config);
+    const MatrixAxis& axis = axes[axis_idx];
+    for (size_t step = 0; step < axis.values[0].size(); ++step) {
+      for (size_t arg_idx = 0; arg_idx < axis.arg_names.size(); ++arg_idx) {
+        current_config[axis.arg_names[arg_idx]] = axis.values[arg_idx][step];
+      }
+      create_matrix(axis_idx + 1);
     }
   };
 
-  YAML::Node base_config = YAML::Clone(config_args);
-  create_matrix(matrix_args.begin(), base_config);
+  create_matrix(0);
   return matrix;
 }
 
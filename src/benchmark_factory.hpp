@@ -1,8 +1,13 @@
 #pragma once
 
 #include "benchmark.hpp"
+#include "loaded_latency_benchmark.hpp"
+#include "matrix_search_benchmark.hpp"
 #include "parallel_benchmark.hpp"
+#include "phased_benchmark.hpp"
 #include "single_benchmark.hpp"
+#include "slo_search_benchmark.hpp"
+#include "thread_ramp_benchmark.hpp"
 
 namespace perma {
 
@@ -18,10 +23,29 @@ class BenchmarkFactory {
   static std::vector<ParallelBenchmark> create_parallel_benchmarks(const std::filesystem::path& pmem_directory,
                                                                    std::vector<YAML::Node>& configs, bool use_dram);
 
+  static std::vector<LoadedLatencyBenchmark> create_loaded_latency_benchmarks(
+      const std::filesystem::path& pmem_directory, std::vector<YAML::Node>& configs, bool use_dram);
+
+  static std::vector<SloSearchBenchmark> create_slo_search_benchmarks(const std::filesystem::path& pmem_directory,
+                                                                      std::vector<YAML::Node>& configs, bool use_dram);
+
+  static std::vector<MatrixSearchBenchmark> create_matrix_search_benchmarks(
+      const std::filesystem::path& pmem_directory, std::vector<YAML::Node>& configs, bool use_dram);
+
+  static std::vector<ThreadRampBenchmark> create_thread_ramp_benchmarks(const std::filesystem::path& pmem_directory,
+                                                                        std::vector<YAML::Node>& configs,
+                                                                        bool use_dram);
+
+  static std::vector<PhasedBenchmark> create_phased_benchmarks(const std::filesystem::path& pmem_directory,
+                                                               std::vector<YAML::Node>& configs, bool use_dram);
+
  private:
+  // Creates the configs of all combinations of the matrix values. If `dimensions` is not null, it receives the
+  // dimensions of the matrix, in which the last dimension advances first.
   static std::vector<BenchmarkConfig> create_benchmark_matrix(const std::filesystem::path& pmem_directory,
                                                               YAML::Node& config_args, YAML::Node& matrix_args,
-                                                              bool use_dram);
+                                                              bool use_dram,
+                                                              std::vector<MatrixDimension>* dimensions = nullptr);
   static void parse_yaml_node(const std::filesystem::path& pmem_directory, std::vector<BenchmarkConfig>& bm_configs,
                               YAML::iterator& par_it, std::string& unique_name, bool use_dram);
 };
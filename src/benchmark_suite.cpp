@@ -18,12 +18,45 @@ nlohmann::json single_results_to_json(const perma::SingleBenchmark& bm, const nl
 }
 
 nlohmann::json parallel_results_to_json(const perma::ParallelBenchmark& bm, const nlohmann::json& bm_results) {
+  nlohmann::json matrix_args;
+  for (size_t bm_num = 0; bm_num < bm.num_sub_benchmarks(); ++bm_num) {
+    matrix_args[bm.get_sub_benchmark_names()[bm_num]] = bm.get_benchmark_configs()[bm_num].matrix_args;
+  }
+  return {{"bm_name", bm.benchmark_name()},
+          {"sub_bm_names", bm.get_sub_benchmark_names()},
+          {"bm_type", bm.benchmark_type_as_str()},
+          {"matrix_args", matrix_args},
+          {"shared_region", bm.has_shared_region()},
+          {"benchmarks", bm_results}};
+}
+
+nlohmann::json loaded_latency_results_to_json(const perma::LoadedLatencyBenchmark& bm,
+                                            const nlohmann::json& bm_results) {
+  return {{"bm_name", bm.benchmark_name()},
+          {"sub_bm_names", {bm.get_latency_benchmark_name(), bm.get_bandwidth_benchmark_name()}},
+          {"bm_type", bm.benchmark_type_as_str()},
+          {"benchmarks", bm_results}};
+}
+
+nlohmann::json slo_search_results_to_json(const perma::SloSearchBenchmark& bm, const nlohmann::json& bm_results) {
+  return {{"bm_name", bm.benchmark_name()}, {"bm_type", bm.benchmark_type_as_str()}, {"benchmarks", bm_results}};
+}
+
+nlohmann::json matrix_search_results_to_json(const perma::MatrixSearchBenchmark& bm, const nlohmann::json& bm_results) {
   return {{"bm_name", bm.benchmark_name()},
-          {"sub_bm_names", {bm.get_benchmark_name_one(), bm.get_benchmark_name_two()}},
           {"bm_type", bm.benchmark_type_as_str()},
-          {"matrix_args",
-           {{bm.get_benchmark_name_one(), bm.get_benchmark_configs()[0].matrix_args},
-            {bm.get_benchmark_name_two(), bm.get_benchmark_configs()[1].matrix_args}}},
+          {"matrix_args", bm.get_benchmark_configs()[0].matrix_args},
+          {"benchmarks", bm_results}};
+}
+
+nlohmann::json thread_ramp_results_to_json(const perma::ThreadRampBenchmark& bm, const nlohmann::json& bm_results) {
+  return {{"bm_name", bm.benchmark_name()}, {"bm_type", bm.benchmark_type_as_str()}, {"benchmarks", bm_results}};
+}
+
+nlohmann::json phased_results_to_json(const perma::PhasedBenchmark& bm, const nlohmann::json& bm_results) {
+  return {{"bm_name", bm.benchmark_name()},
+          {"sub_bm_names", bm.get_phase_names()},
+          {"bm_type", bm.benchmark_type_as_str()},
           {"benchmarks", bm_results}};
 }
 
@@ -32,6 +65,16 @@ nlohmann::json benchmark_results_to_json(const perma::Benchmark& bm, const nlohm
     return single_results_to_json(dynamic_cast<const perma::SingleBenchmark&>(bm), bm_results);
   } else if (bm.get_benchmark_type() == perma::BenchmarkType::Parallel) {
     return parallel_results_to_json(dynamic_cast<const perma::ParallelBenchmark&>(bm), bm_results);
+  } else if (bm.get_benchmark_type() == perma::BenchmarkType::LoadedLatency) {
+    return loaded_latency_results_to_json(dynamic_cast<const perma::LoadedLatencyBenchmark&>(bm), bm_results);
+  } else if (bm.get_benchmark_type() == perma::BenchmarkType::SloSearch) {
+    return slo_search_results_to_json(dynamic_cast<const perma::SloSearchBenchmark&>(bm), bm_results);
+  } else if (bm.get_benchmark_type() == perma::BenchmarkType::MatrixSearch) {
+    return matrix_search_results_to_json(dynamic_cast<const perma::MatrixSearchBenchmark&>(bm), bm_results);
+  } else if (bm.get_benchmark_type() == perma::BenchmarkType::ThreadRamp) {
+    return thread_ramp_results_to_json(dynamic_cast<const perma::ThreadRampBenchmark&>(bm), bm_results);
+  } else if (bm.get_benchmark_type() == perma::BenchmarkType::Phased) {
+    return phased_results_to_json(dynamic_cast<const perma::PhasedBenchmark&>(bm), bm_results);
   } else {
     return {{"bm_name", bm.benchmark_name()}, {"bm_type", bm.benchmark_type_as_str()}, {"benchmarks", bm_results}};
   }
@@ -43,8 +86,40 @@ void print_bm_information(const perma::Benchmark& bm) {
                  nlohmann::json(bm.get_benchmark_configs()[0].matrix_args).dump());
   } else if (bm.get_benchmark_type() == perma::BenchmarkType::Parallel) {
     const auto& benchmark = dynamic_cast<const perma::ParallelBenchmark&>(bm);
-    spdlog::info("Running parallel benchmark {} with sub benchmarks {} and {}.", benchmark.benchmark_name(),
-                 benchmark.get_benchmark_name_one(), benchmark.get_benchmark_name_two());
+    spdlog::info("Running parallel benchmark {} with sub benchmarks {}.", benchmark.benchmark_name(),
+                 nlohmann::json(benchmark.get_sub_benchmark_names()).dump());
+  } else if (bm.get_benchmark_type() == perma::BenchmarkType::LoadedLatency) {
+    const auto& benchmark = dynamic_cast<const perma::LoadedLatencyBenchmark&>(bm);
+    spdlog::info("Running loaded-latency benchmark {} with {} steps of {} under the load of {}.",
+                 benchmark.benchmark_name(), benchmark.num_steps(), benchmark.get_latency_benchmark_name(),
+                 benchmark.get_bandwidth_benchmark_name());
+  } else if (bm.get_benchmark_type() == perma::BenchmarkType::SloSearch) {
+    const auto& benchmark = dynamic_cast<const perma::SloSearchBenchmark&>(bm);
+    const perma::SloSearchConfig& search_config = benchmark.get_search_config();
+    spdlog::info("Running SLO search {} for the highest {} in [{}, {}] with a p{} latency of at most {} ns.",
+                 benchmark.benchmark_name(),
+                 perma::utils::get_enum_as_string(perma::SloSearchConfig::str_to_search_parameter,
+                                                  search_config.parameter),
+                 search_config.min, search_config.max, search_config.latency_percentile, search_config.max_latency_ns);
+  } else if (bm.get_benchmark_type() == perma::BenchmarkType::MatrixSearch) {
+    const auto& benchmark = dynamic_cast<const perma::MatrixSearchBenchmark&>(bm);
+    spdlog::info("Running {} matrix search {} over {} configs with matrix args {}.",
+                 perma::utils::get_enum_as_string(perma::MatrixSearchConfig::str_to_strategy,
+                                                  benchmark.get_search_config().strategy),
+                 benchmark.benchmark_name(), benchmark.get_benchmark_configs().size(),
+                 nlohmann::json(benchmark.get_benchmark_configs()[0].matrix_args).dump());
+  } else if (bm.get_benchmark_type() == perma::BenchmarkType::ThreadRamp) {
+    const auto& benchmark = dynamic_cast<const perma::ThreadRampBenchmark&>(bm);
+    const std::vector<perma::BenchmarkConfig>& step_configs = benchmark.get_benchmark_configs();
+    spdlog::info("Running {} thread ramp {} with {} steps from {} to {} threads.",
+                 perma::utils::get_enum_as_string(perma::ThreadRampConfig::str_to_mode,
+                                                  benchmark.get_ramp_config().mode),
+                 benchmark.benchmark_name(), benchmark.num_steps(), step_configs.front().number_threads,
+                 step_configs.back().number_threads);
+  } else if (bm.get_benchmark_type() == perma::BenchmarkType::Phased) {
+    const auto& benchmark = dynamic_cast<const perma::PhasedBenchmark&>(bm);
+    spdlog::info("Running phased benchmark {} with phases {}.", benchmark.benchmark_name(),
+                 nlohmann::json(benchmark.get_phase_names()).dump());
   } else {
     // This should never happen
     spdlog::critical("Unknown benchmark type: {}", bm.get_benchmark_type());
@@ -68,16 +143,50 @@ void BenchmarkSuite::run_benchmarks(const PermaOptions& options) {
       BenchmarkFactory::create_parallel_benchmarks(options.pmem_directory, configs, !options.is_pmem);
   spdlog::info("Found {} parallel benchmark{}.", parallel_benchmarks.size(),
                parallel_benchmarks.size() != 1 ? "s" : "");
+  std::vector<LoadedLatencyBenchmark> loaded_latency_benchmarks =
+      BenchmarkFactory::create_loaded_latency_benchmarks(options.pmem_directory, configs, !options.is_pmem);
+  spdlog::info("Found {} loaded-latency benchmark{}.", loaded_latency_benchmarks.size(),
+               loaded_latency_benchmarks.size() != 1 ? "s" : "");
+  std::vector<SloSearchBenchmark> slo_search_benchmarks =
+      BenchmarkFactory::create_slo_search_benchmarks(options.pmem_directory, configs, !options.is_pmem);
+  spdlog::info("Found {} SLO search{}.", slo_search_benchmarks.size(), slo_search_benchmarks.size() != 1 ? "es" : "");
+  std::vector<MatrixSearchBenchmark> matrix_search_benchmarks =
+      BenchmarkFactory::create_matrix_search_benchmarks(options.pmem_directory, configs, !options.is_pmem);
+  spdlog::info("Found {} matrix search{}.", matrix_search_benchmarks.size(),
+               matrix_search_benchmarks.size() != 1 ? "es" : "");
+  std::vector<ThreadRampBenchmark> thread_ramp_benchmarks =
+      BenchmarkFactory::create_thread_ramp_benchmarks(options.pmem_directory, configs, !options.is_pmem);
+  spdlog::info("Found {} thread ramp{}.", thread_ramp_benchmarks.size(), thread_ramp_benchmarks.size() != 1 ? "s" : "");
+  std::vector<PhasedBenchmark> phased_benchmarks =
+      BenchmarkFactory::create_phased_benchmarks(options.pmem_directory, configs, !options.is_pmem);
+  spdlog::info("Found {} phased benchmark{}.", phased_benchmarks.size(), phased_benchmarks.size() != 1 ? "s" : "");
 
   Benchmark* previous_bm = nullptr;
   std::vector<Benchmark*> benchmarks{};
-  benchmarks.reserve(single_benchmarks.size() + parallel_benchmarks.size());
+  benchmarks.reserve(single_benchmarks.size() + parallel_benchmarks.size() + loaded_latency_benchmarks.size() +
+                     slo_search_benchmarks.size() + matrix_search_benchmarks.size() + thread_ramp_benchmarks.size() +
+                     phased_benchmarks.size());
   for (Benchmark& benchmark : single_benchmarks) {
     benchmarks.push_back(&benchmark);
   }
   for (Benchmark& benchmark : parallel_benchmarks) {
     benchmarks.push_back(&benchmark);
   }
+  for (Benchmark& benchmark : loaded_latency_benchmarks) {
+    benchmarks.push_back(&benchmark);
+  }
+  for (Benchmark& benchmark : slo_search_benchmarks) {
+    benchmarks.push_back(&benchmark);
+  }
+  for (Benchmark& benchmark : matrix_search_benchmarks) {
+    benchmarks.push_back(&benchmark);
+  }
+  for (Benchmark& benchmark : thread_ramp_benchmarks) {
+    benchmarks.push_back(&benchmark);
+  }
+  for (Benchmark& benchmark : phased_benchmarks) {
+    benchmarks.push_back(&benchmark);
+  }
 
   const std::filesystem::path result_file = utils::create_result_file(options.result_directory, options.config_file);
 
@@ -108,8 +217,18 @@ void BenchmarkSuite::run_benchmarks(const PermaOptions& options) {
 
     const size_t benchmark_num = i + 1;
     if (benchmark.get_benchmark_type() == BenchmarkType::Parallel) {
-      spdlog::debug("Preparing parallel benchmark #{} with two configs: {} AND {}", benchmark_num,
-                    to_string(benchmark.get_json_config(0)), to_string(benchmark.get_json_config(1)));
+      const size_t num_sub_bms = benchmark.get_benchmark_configs().size();
+      std::string sub_bm_configs = to_string(benchmark.get_json_config(0));
+      for (size_t bm_num = 1; bm_num < num_sub_bms; ++bm_num) {
+        sub_bm_configs += " AND " + to_string(benchmark.get_json_config(bm_num));
+      }
+      spdlog::debug("Preparing parallel benchmark #{} with {} configs: {}", benchmark_num, num_sub_bms, sub_bm_configs);
+    } else if (benchmark.get_benchmark_type() == BenchmarkType::LoadedLatency) {
+      // The configs alternate between the latency config and the bandwidth config of each step.
+      const size_t num_steps = static_cast<const LoadedLatencyBenchmark&>(benchmark).num_steps();
+      spdlog::debug("Preparing loaded-latency benchmark #{} with {} step{}: {} AND {}", benchmark_num, num_steps,
+                    num_steps != 1 ? "s" : "", to_string(benchmark.get_json_config(0)),
+                    to_string(benchmark.get_json_config(1)));
     } else {
       spdlog::debug("Preparing benchmark #{} with config: {}", benchmark_num, to_string(benchmark.get_json_config(0)));
     }
@@ -0,0 +1,234 @@
+#include "compiled_chain.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace {
+
+using perma::ChainedOperation;
+using perma::PersistInstruction;
+using ChainState = perma::CompiledChain::ChainState;
+using CompiledStep = perma::CompiledChain::CompiledStep;
+using StepFn = perma::CompiledChain::StepFn;
+using ChainRunner = perma::CompiledChain::ChainRunner;
+
+void generic_step(ChainedOperation& op, ChainState& state) {
+  char* target_addr = op.get_target_address(state.current_addr, state.dependent_addr);
+  state.dependent_addr = op.run_step(target_addr, state.dependent_addr);
+  if (op.moves_current_address()) {
+    state.current_addr = target_addr;
+  }
+}
+
+template <size_t ACCESS_SIZE>
+void read_step(ChainedOperation& op, ChainState& state) {
+  char* addr = op.get_random_address(state.dependent_addr);
+  state.current_addr = addr;
+#ifdef HAS_AVX
+  __m512i read_value = perma::read_single_access(addr, ACCESS_SIZE);
+  // Make sure the compiler does not optimize the load away.
+  KEEP(&read_value);
+  state.dependent_addr = (char*)read_value[0];
+#endif
+}
+
+template <size_t ACCESS_SIZE, PersistInstruction PERSIST>
+void write_step(ChainedOperation& op, ChainState& state) {
+  char* addr = state.current_addr + op.offset();
+  state.current_addr = addr;
+#ifdef HAS_AVX
+  perma::write_single_access(addr, ACCESS_SIZE, PERSIST);
+#endif
+}
+
+template <size_t ACCESS_SIZE>
+StepFn write_step_for(const PersistInstruction persist_instruction) {
+  switch (persist_instruction) {
+    case PersistInstruction::Cache:
+      return &write_step<ACCESS_SIZE, PersistInstruction::Cache>;
+    case PersistInstruction::CacheInvalidate:
+      return &write_step<ACCESS_SIZE, PersistInstruction::CacheInvalidate>;
+    case PersistInstruction::NoCache:
+      return &write_step<ACCESS_SIZE, PersistInstruction::NoCache>;
+    case PersistInstruction::Fence:
+      return &write_step<ACCESS_SIZE, PersistInstruction::Fence>;
+    case PersistInstruction::None:
+      return &write_step<ACCESS_SIZE, PersistInstruction::None>;
+  }
+  return &generic_step;
+}
+
+void run_flat(const CompiledStep* steps, const size_t num_steps, const uint64_t num_chains, char* start_addr) {
+  for (uint64_t chain = 0; chain < num_chains; ++chain) {
+    ChainState state{start_addr, start_addr};
+    for (size_t step = 0; step < num_steps; ++step) {
+      steps[step].fn(*steps[step].op, state);
+    }
+  }
+}
+
+template <StepFn... STEPS>
+void run_unrolled(const CompiledStep* steps, const size_t /*num_steps*/, const uint64_t num_chains, char* start_addr) {
+  for (uint64_t chain = 0; chain < num_chains; ++chain) {
+    ChainState state{start_addr, start_addr};
+    size_t step = 0;
+    // The steps are template arguments, so the compiler can inline them instead of calling through the pointers.
+    (STEPS(*steps[step++].op, state), ...);
+  }
+}
+
+struct ChainShape {
+  std::vector<StepFn> steps;
+  ChainRunner runner;
+};
+
+template <StepFn... STEPS>
+ChainShape make_shape() {
+  return ChainShape{{STEPS...}, &run_unrolled<STEPS...>};
+}
+
+constexpr StepFn R128 = &read_step<128>;
+constexpr StepFn R256 = &read_step<256>;
+constexpr StepFn R512 = &read_step<512>;
+constexpr StepFn R1024 = &read_step<1024>;
+constexpr StepFn R2048 = &read_step<2048>;
+constexpr StepFn W64_CACHE = &write_step<64, PersistInstruction::Cache>;
+constexpr StepFn W64_NONE = &write_step<64, PersistInstruction::None>;
+
+// Shapes of the chains in workloads/operations, labeled by their file and benchmark name. The DRAM and PMem variants of
+// a chain share the same shape, as the memory range is part of the `ChainedOperation`.
+const std::vector<ChainShape>& bundled_shapes() {
+  static const std::vector<ChainShape> shapes = {
+      // hash_index.yaml: hash_index_lookup
+      make_shape<R128>(),
+      make_shape<R512>(),
+      make_shape<R1024>(),
+      // tree_index.yaml: tree_index_lookup
+      make_shape<R256, R256, R256>(),
+      make_shape<R512, R512, R512>(),
+      make_shape<R1024, R1024, R1024>(),
+      // aggregation.yaml: hash_aggregation
+      make_shape<R128, W64_NONE>(),
+      make_shape<R512, W64_NONE, W64_NONE>(),
+      make_shape<R1024, W64_NONE, W64_NONE>(),
+      // hash_index.yaml: hash_index_update
+      make_shape<R128, W64_CACHE, W64_CACHE>(),
+      make_shape<R512, W64_CACHE, W64_CACHE>(),
+      make_shape<R1024, W64_CACHE, W64_CACHE>(),
+      // tree_index.yaml: tree_index_update
+      make_shape<R256, R256, R256, W64_CACHE, W64_CACHE>(),
+      make_shape<R512, R512, R512, W64_CACHE, W64_CACHE, W64_CACHE, W64_CACHE>(),
+      make_shape<R1024, R1024, R1024, W64_CACHE, W64_CACHE, W64_CACHE, W64_CACHE, W64_CACHE, W64_CACHE, W64_CACHE,
+                 W64_CACHE>(),
+      // tree_index.yaml: tree_index_range_scan
+      make_shape<R512, R512, R512, R512, R512, R512, R512>(),
+      make_shape<R256, R256, R256, R256, R256, R256, R256, R256, R256, R256, R256>(),
+      make_shape<R1024, R1024, R1024, R1024, R1024>(),
+      // hybrid_tree_index.yaml: hybrid_tree_index_lookup
+      make_shape<R512, R512, R512, R256>(),
+      make_shape<R1024, R1024, R1024, R512>(),
+      make_shape<R2048, R2048, R1024>(),
+      // hybrid_tree_index.yaml: hybrid_tree_index_update
+      make_shape<R512, R512, R512, R256, W64_CACHE, W64_CACHE, W64_CACHE>(),
+      make_shape<R1024, R1024, R1024, R512, W64_CACHE, W64_CACHE, W64_CACHE>(),
+      make_shape<R2048, R2048, R1024, W64_CACHE, W64_CACHE, W64_CACHE>(),
+  };
+  return shapes;
+}
+
+}  // namespace
+
+namespace perma {
+
+CompiledChain::CompiledChain(std::vector<ChainedOperation>& operation_chain, const std::vector<CustomOp>& operations,
+                             const bool has_explicit_fences)
+    : runner_(&run_flat) {
+  steps_.reserve(operations.size());
+  for (size_t i = 0; i < operations.size(); ++i) {
+    // The specialized write steps store WRITE_DATA, so writes with a data pattern use the generic step.
+    const StepFn step_fn =
+        operation_chain[i].has_write_data() ? &generic_step : compile_step(operations[i], has_explicit_fences);
+    steps_.push_back(CompiledStep{step_fn, &operation_chain[i]});
+  }
+
+  for (const ChainShape& shape : bundled_shapes()) {
+    const bool matches_shape =
+        std::equal(shape.steps.begin(), shape.steps.end(), steps_.begin(), steps_.end(),
+                   [](const StepFn shape_step, const CompiledStep& step) { return shape_step == step.fn; });
+    if (matches_shape) {
+      runner_ = shape.runner;
+      is_unrolled_ = true;
+      break;
+    }
+  }
+}
+
+size_t CompiledChain::num_specialized_steps() const {
+  return std::count_if(steps_.begin(), steps_.end(), [](const CompiledStep& step) { return step.fn != &generic_step; });
+}
+
+CompiledChain::StepFn CompiledChain::compile_step(const CustomOp& op, const bool has_explicit_fences) {
+  if (op.has_variable_size || op.checksum != Checksum::None) {
+    return &generic_step;
+  }
+
+  if (op.type == Operation::Read && op.read_instruction == ReadInstruction::Load &&
+      op.read_pattern == ReadPattern::Random) {
+    switch (op.size) {
+      case 64:
+        return &read_step<64>;
+      case 128:
+        return &read_step<128>;
+      case 256:
+        return &read_step<256>;
+      case 512:
+        return &read_step<512>;
+      case 1024:
+        return &read_step<1024>;
+      case 2048:
+        return &read_step<2048>;
+      default:
+        return &generic_step;
+    }
+  }
+
+  // Writes in chains with explicit fences must not fence themselves, which only the generic step handles.
+  if (op.type == Operation::Write && !has_explicit_fences) {
+    switch (op.size) {
+      case 64:
+        return write_step_for<64>(op.persist);
+      case 128:
+        return write_step_for<128>(op.persist);
+      case 256:
+        return write_step_for<256>(op.persist);
+      case 512:
+        return write_step_for<512>(op.persist);
+      default:
+        return &generic_step;
+    }
+  }
+
+  return &generic_step;
+}
+
+ChainSampler::ChainSampler(const std::vector<WeightedCustomChain>& chains) {
+  chain_indices_.reserve(NUM_SAMPLED_CHAINS);
+  const double total_weight =
+      std::accumulate(chains.begin(), chains.end(), 0.0,
+                      [](const double sum, const WeightedCustomChain& chain) { return sum + chain.weight; });
+
+  // Give each chain its share of the table, rounded to full entries. Chains with a small weight get at least one entry,
+  // so that they are executed at all.
+  double cumulative_weight = 0;
+  for (size_t chain_idx = 0; chain_idx < chains.size(); ++chain_idx) {
+    cumulative_weight += chains[chain_idx].weight;
+    const size_t num_remaining_chains = chains.size() - chain_idx - 1;
+    const auto rounded_end = static_cast<size_t>(std::round((cumulative_weight / total_weight) * NUM_SAMPLED_CHAINS));
+    const size_t chain_end =
+        std::clamp(rounded_end, chain_indices_.size() + 1, NUM_SAMPLED_CHAINS - num_remaining_chains);
+    chain_indices_.insert(chain_indices_.end(), chain_end - chain_indices_.size(), chain_idx);
+  }
+}
+
+}  // namespace perma
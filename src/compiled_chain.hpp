@@ -0,0 +1,76 @@
+#pragma once
+
+#include <vector>
+
+#include "benchmark_config.hpp"
+#include "fast_random.hpp"
+#include "io_operation.hpp"
+
+namespace perma {
+
+/**
+ * Flattens a chain of `ChainedOperation`s into a loop over an array of steps. `ChainedOperation::run` recurses through
+ * the chain and switches on the type, access size, and persist instruction in every operation, which is a visible part
+ * of a short chain's latency. Common operations compile to template instantiations with a fixed access size and
+ * persist instruction, so the compiler resolves this dispatch at compile time. All other operations fall back to the
+ * generic step of the `ChainedOperation`. Chains that match a shape of the bundled workloads in
+ * `workloads/operations` run a fully unrolled loop without any indirect calls.
+ */
+class CompiledChain {
+ public:
+  struct ChainState {
+    char* current_addr;
+    char* dependent_addr;
+  };
+
+  using StepFn = void (*)(ChainedOperation& op, ChainState& state);
+
+  struct CompiledStep {
+    StepFn fn;
+    ChainedOperation* op;
+  };
+
+  using ChainRunner = void (*)(const CompiledStep* steps, size_t num_steps, uint64_t num_chains, char* start_addr);
+
+  // The `operation_chain` must be created from `operations` and outlive the compiled chain.
+  CompiledChain(std::vector<ChainedOperation>& operation_chain, const std::vector<CustomOp>& operations,
+                bool has_explicit_fences);
+
+  /** Runs `num_chains` chains back-to-back. Each chain starts at `start_addr`, like `ChainedOperation::run`. */
+  inline void run(const uint64_t num_chains, char* start_addr) const {
+    runner_(steps_.data(), steps_.size(), num_chains, start_addr);
+  }
+
+  /** Whether the chain matched a pre-instantiated shape and runs without indirect calls. */
+  bool is_unrolled() const { return is_unrolled_; }
+
+  /** Number of operations that run a specialized step instead of the generic one. */
+  size_t num_specialized_steps() const;
+
+ private:
+  static StepFn compile_step(const CustomOp& op, bool has_explicit_fences);
+
+  std::vector<CompiledStep> steps_;
+  ChainRunner runner_;
+  bool is_unrolled_ = false;
+};
+
+/**
+ * Picks the chain of each iteration in a `custom_chain_mixture`. Like the `AccessSizeSampler`, it fills a table of
+ * chain indices according to the weights once, so that each pick only costs a random number and a table lookup without
+ * any branches on the weights.
+ */
+class ChainSampler {
+ public:
+  explicit ChainSampler(const std::vector<WeightedCustomChain>& chains);
+
+  inline size_t sample() const { return chain_indices_[lehmer64() & (NUM_SAMPLED_CHAINS - 1)]; }
+
+ private:
+  // Must be a power of two. This allows weights down to ~0.01%.
+  static constexpr size_t NUM_SAMPLED_CHAINS = 8192;
+
+  std::vector<uint32_t> chain_indices_;
+};
+
+}  // namespace perma
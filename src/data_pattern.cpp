@@ -0,0 +1,150 @@
+#include "data_pattern.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <fstream>
+#include <random>
+#include <thread>
+
+#include "fast_random.hpp"
+#include "utils.hpp"
+
+namespace perma {
+
+WriteDataBuffer::WriteDataBuffer(const BenchmarkConfig& config, const uint64_t seed, const size_t max_access_size) {
+  const bool has_line_stride =
+      config.data_pattern == DataPattern::RandomLine || config.data_pattern == DataPattern::File;
+  line_stride_ = has_line_stride ? rw_ops::CACHE_LINE_SIZE : 0;
+
+  const size_t num_extra_lines =
+      has_line_stride ? (max_access_size + rw_ops::CACHE_LINE_SIZE - 1) / rw_ops::CACHE_LINE_SIZE : 0;
+  lines_.resize(NUM_DATA_LINES + num_extra_lines);
+
+  switch (config.data_pattern) {
+    case DataPattern::Constant: {
+      for (DataLine& line : lines_) {
+        std::memcpy(line.bytes, rw_ops::WRITE_DATA, rw_ops::CACHE_LINE_SIZE);
+      }
+      break;
+    }
+    case DataPattern::Zero: {
+      for (DataLine& line : lines_) {
+        std::memset(line.bytes, 0, rw_ops::CACHE_LINE_SIZE);
+      }
+      break;
+    }
+    case DataPattern::RandomLine:
+    case DataPattern::RandomOp: {
+      std::mt19937_64 generator{seed};
+      for (size_t line_idx = 0; line_idx < NUM_DATA_LINES; ++line_idx) {
+        for (size_t word = 0; word < rw_ops::CACHE_LINE_SIZE / sizeof(uint64_t); ++word) {
+          const uint64_t value = generator();
+          std::memcpy(lines_[line_idx].bytes + word * sizeof(uint64_t), &value, sizeof(uint64_t));
+        }
+      }
+      break;
+    }
+    case DataPattern::File: {
+      const std::vector<char> sample = read_file_sample(config.data_pattern_file);
+      for (size_t line_idx = 0; line_idx < NUM_DATA_LINES; ++line_idx) {
+        std::memcpy(lines_[line_idx].bytes, sample.data() + line_idx * rw_ops::CACHE_LINE_SIZE,
+                    rw_ops::CACHE_LINE_SIZE);
+      }
+      break;
+    }
+  }
+
+  // The extra lines repeat the first lines, so that accesses that start at the end of the buffer continue with the
+  // same data as if they wrapped around.
+  for (size_t line_idx = NUM_DATA_LINES; line_idx < lines_.size(); ++line_idx) {
+    lines_[line_idx] = lines_[line_idx % NUM_DATA_LINES];
+  }
+}
+
+void WriteDataBuffer::fill(char* from, const char* to) const {
+  size_t line_idx = 0;
+  for (char* addr = from; addr < to; addr += rw_ops::CACHE_LINE_SIZE) {
+    const auto num_bytes = std::min<size_t>(rw_ops::CACHE_LINE_SIZE, to - addr);
+    std::memcpy(addr, lines_[line_idx].bytes, num_bytes);
+    line_idx = (line_idx + 1) & (NUM_DATA_LINES - 1);
+  }
+}
+
+void WriteDataBuffer::fill_random(char* from, const char* to, const uint64_t seed) {
+  // A 64 KiB buffer repeated over the range would be trivially deduplicated, so we draw each word from the stream.
+  lehmer64_seed(seed);
+  char* addr = from;
+  for (; addr + sizeof(uint64_t) <= to; addr += sizeof(uint64_t)) {
+    const uint64_t value = lehmer64();
+    std::memcpy(addr, &value, sizeof(uint64_t));
+  }
+  if (addr < to) {
+    const uint64_t value = lehmer64();
+    std::memcpy(addr, &value, to - addr);
+  }
+}
+
+void WriteDataBuffer::generate_read_data(char* addr, const uint64_t memory_range, const BenchmarkConfig& config) {
+  if (memory_range == 0) {
+    return;
+  }
+
+  spdlog::debug("Generating {} GB of {} data to read.", memory_range / utils::ONE_GB,
+                utils::get_enum_as_string(ConfigEnums::str_to_data_pattern, config.data_pattern));
+  // Each thread fills its part with its own buffer or random stream. Random patterns use a different seed per thread,
+  // so that the parts do not repeat each other.
+  const bool is_random = config.data_pattern == DataPattern::RandomLine || config.data_pattern == DataPattern::RandomOp;
+  auto fill_range = [&](const uint64_t seed, char* from, const char* to) {
+    if (is_random) {
+      return fill_random(from, to, seed);
+    }
+    const WriteDataBuffer buffer{config, seed, 0};
+    buffer.fill(from, to);
+  };
+
+  std::vector<std::thread> thread_pool;
+  thread_pool.reserve(utils::NUM_UTIL_THREADS - 1);
+  const uint64_t thread_memory_range = memory_range / utils::NUM_UTIL_THREADS;
+  for (uint8_t thread_count = 0; thread_count < utils::NUM_UTIL_THREADS - 1; thread_count++) {
+    char* from = addr + thread_count * thread_memory_range;
+    const char* to = addr + (thread_count + 1) * thread_memory_range;
+    thread_pool.emplace_back(fill_range, thread_count, from, to);
+  }
+
+  fill_range(utils::NUM_UTIL_THREADS - 1, addr + (utils::NUM_UTIL_THREADS - 1) * thread_memory_range,
+             addr + memory_range);
+
+  // wait for all threads
+  for (std::thread& thread : thread_pool) {
+    thread.join();
+  }
+}
+
+std::vector<char> WriteDataBuffer::read_file_sample(const std::filesystem::path& data_file) {
+  std::ifstream data_stream{data_file, std::ios::binary};
+  const uint64_t file_size = std::filesystem::is_regular_file(data_file) ? std::filesystem::file_size(data_file) : 0;
+  if (!data_stream.is_open() || file_size == 0) {
+    spdlog::error("Could not read data pattern file: {}", data_file.string());
+    utils::crash_exit();
+  }
+
+  const size_t sample_size = NUM_DATA_LINES * rw_ops::CACHE_LINE_SIZE;
+  std::vector<char> sample(sample_size);
+  if (file_size <= sample_size) {
+    data_stream.read(sample.data(), file_size);
+    for (size_t offset = file_size; offset < sample_size; ++offset) {
+      sample[offset] = sample[offset % file_size];
+    }
+    return sample;
+  }
+
+  // Sample lines from the whole file instead of only its beginning, which is often a header.
+  const uint64_t line_distance = file_size / NUM_DATA_LINES;
+  for (size_t line_idx = 0; line_idx < NUM_DATA_LINES; ++line_idx) {
+    data_stream.seekg(static_cast<std::streamoff>(line_idx * line_distance));
+    data_stream.read(sample.data() + line_idx * rw_ops::CACHE_LINE_SIZE, rw_ops::CACHE_LINE_SIZE);
+  }
+  return sample;
+}
+
+}  // namespace perma
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "benchmark_config.hpp"
+#include "read_write_ops.hpp"
+
+namespace perma {
+
+/**
+ * Holds the data that writes store for the `data_pattern` of a benchmark. Generating random data or reading a file on
+ * every write costs more than the write itself, so each thread fills a buffer of cache lines once during the set up.
+ * Each write then only takes the next lines of the buffer, which is small enough to stay in the L2 cache.
+ */
+class WriteDataBuffer {
+ public:
+  // Random patterns are seeded with `seed`, so that each thread writes different data. The buffer holds enough extra
+  // lines that an access of up to `max_access_size` never wraps around within the access.
+  WriteDataBuffer(const BenchmarkConfig& config, uint64_t seed, size_t max_access_size);
+
+  /** Returns the data of the next access of `access_size`. Its i-th cache line is at `data + i * line_stride()`. */
+  inline const char* next(const size_t access_size) {
+    const char* data = lines_[next_line_].bytes;
+    const size_t num_lines =
+        line_stride_ == 0 ? 1 : (access_size + rw_ops::CACHE_LINE_SIZE - 1) / rw_ops::CACHE_LINE_SIZE;
+    next_line_ = (next_line_ + num_lines) & (NUM_DATA_LINES - 1);
+    return data;
+  }
+
+  /** 0 if all cache lines of an access store the same line and 64 if they store consecutive lines. */
+  size_t line_stride() const { return line_stride_; }
+
+  /** Fills the range with the lines of the buffer, starting at the first line. */
+  void fill(char* from, const char* to) const;
+
+  /** Fills `memory_range` Byte at `addr` with the data pattern in parallel. Replaces `utils::generate_read_data` for
+   * all patterns except the constant one. Random patterns draw new data for the whole range instead of repeating the
+   * buffer, so that no part of the range is a copy of another one. */
+  static void generate_read_data(char* addr, uint64_t memory_range, const BenchmarkConfig& config);
+
+  /** Reads `NUM_DATA_LINES` cache lines from evenly spaced offsets of the file. Smaller files are repeated. */
+  static std::vector<char> read_file_sample(const std::filesystem::path& data_file);
+
+  // Must be a power of two. 1024 lines are 64 KiB.
+  static constexpr size_t NUM_DATA_LINES = 1024;
+
+ private:
+  /** Fills the range with a random stream seeded with `seed`. */
+  static void fill_random(char* from, const char* to, uint64_t seed);
+
+  struct alignas(rw_ops::CACHE_LINE_SIZE) DataLine {
+    char bytes[rw_ops::CACHE_LINE_SIZE];
+  };
+
+  std::vector<DataLine> lines_;
+  size_t line_stride_;
+  size_t next_line_ = 0;
+};
+
+}  // namespace perma
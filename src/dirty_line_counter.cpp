@@ -0,0 +1,96 @@
+#include "dirty_line_counter.hpp"
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <array>
+#include <fstream>
+#include <string>
+
+namespace {
+
+// Name of the core PMU, e.g., "skylake" for Skylake and Cascade Lake or "icelake" for Ice Lake.
+constexpr auto PMU_NAME_FILE = "/sys/bus/event_source/devices/cpu/caps/pmu_name";
+
+// Raw events as (umask << 8) | event. These encodings are the same on Skylake, Cascade Lake, and Ice Lake servers.
+// MEM_LOAD_L3_HIT_RETIRED.XSNP_HITM: loads that hit a modified line in another core of the same socket.
+constexpr uint64_t LOCAL_HITM_EVENT = 0x04D2;
+// MEM_LOAD_L3_MISS_RETIRED.REMOTE_HITM: loads that hit a modified line in a core of another socket.
+constexpr uint64_t REMOTE_HITM_EVENT = 0x04D3;
+
+bool has_hitm_events() {
+  std::ifstream pmu_name_file{PMU_NAME_FILE};
+  std::string pmu_name;
+  if (!(pmu_name_file >> pmu_name)) {
+    return false;
+  }
+  return pmu_name == "skylake" || pmu_name == "icelake";
+}
+
+int open_event(const uint64_t raw_event) {
+  perf_event_attr attr{};
+  attr.type = PERF_TYPE_RAW;
+  attr.size = sizeof(perf_event_attr);
+  attr.config = raw_event;
+  attr.disabled = 1;
+  // User space events of the calling thread on any CPU work with the default perf_event_paranoid level.
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+}  // namespace
+
+namespace perma {
+
+DirtyLineCounter::DirtyLineCounter() {
+  if (!has_hitm_events()) {
+    return;
+  }
+
+  for (const uint64_t raw_event : std::array<uint64_t, 2>{LOCAL_HITM_EVENT, REMOTE_HITM_EVENT}) {
+    const int event_fd = open_event(raw_event);
+    if (event_fd < 0) {
+      // Only report hits if we count all of them.
+      for (const int open_fd : event_fds_) {
+        close(open_fd);
+      }
+      event_fds_.clear();
+      return;
+    }
+    event_fds_.push_back(event_fd);
+  }
+}
+
+DirtyLineCounter::~DirtyLineCounter() {
+  for (const int event_fd : event_fds_) {
+    close(event_fd);
+  }
+}
+
+void DirtyLineCounter::start() {
+  for (const int event_fd : event_fds_) {
+    ioctl(event_fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(event_fd, PERF_EVENT_IOC_ENABLE, 0);
+  }
+}
+
+uint64_t DirtyLineCounter::stop() {
+  uint64_t num_hits = 0;
+  for (const int event_fd : event_fds_) {
+    ioctl(event_fd, PERF_EVENT_IOC_DISABLE, 0);
+    uint64_t event_count = 0;
+    if (read(event_fd, &event_count, sizeof(event_count)) == sizeof(event_count)) {
+      num_hits += event_count;
+    }
+  }
+  return num_hits;
+}
+
+bool DirtyLineCounter::is_available() const { return !event_fds_.empty(); }
+
+bool DirtyLineCounter::is_supported() { return DirtyLineCounter{}.is_available(); }
+
+}  // namespace perma
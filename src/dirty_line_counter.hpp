@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace perma {
+
+/**
+ * Counts the loads of the calling thread that hit a cache line in the modified state in another core's cache (HITM),
+ * i.e., a line that another thread wrote and did not yet write back. It counts hits in the local socket and in remote
+ * sockets. This needs the precise load events of Intel Xeon CPUs (Skylake/Cascade Lake and Ice Lake) and access to
+ * perf events. Otherwise, the counter is not available and reports no hits.
+ */
+class DirtyLineCounter {
+ public:
+  /** Opens the perf events of the calling thread, which do not count until `start()`. */
+  DirtyLineCounter();
+  ~DirtyLineCounter();
+
+  DirtyLineCounter(const DirtyLineCounter& other) = delete;
+  DirtyLineCounter& operator=(const DirtyLineCounter& other) = delete;
+
+  void start();
+
+  /** Stops counting and returns the number of hits since `start()`. */
+  uint64_t stop();
+
+  bool is_available() const;
+
+  /** Checks if the CPU has the events and if this process may open them. */
+  static bool is_supported();
+
+ private:
+  std::vector<int> event_fds_;
+};
+
+}  // namespace perma
@@ -3,14 +3,379 @@
 #include <thread>
 #include <vector>
 
+#include "arrival_schedule.hpp"
 #include "benchmark_config.hpp"
+#include "data_pattern.hpp"
 #include "fast_random.hpp"
 #include "read_write_ops.hpp"
+#include "size_distribution.hpp"
 #include "spdlog/spdlog.h"
 #include "utils.hpp"
 
 namespace perma {
 
+#ifdef HAS_AVX
+/** Reads a single access with the unrolled kernels if possible and with the masked kernels otherwise. */
+inline __m512i read_single_access(char* addr, const size_t access_size) {
+  if (!rw_ops::is_aligned_access(addr, access_size)) {
+    return rw_ops::simd_read_unaligned(addr, access_size);
+  }
+
+  switch (access_size) {
+    case 64:
+      return rw_ops::simd_read_64(addr);
+    case 128:
+      return rw_ops::simd_read_128(addr);
+    case 256:
+      return rw_ops::simd_read_256(addr);
+    case 512:
+      return rw_ops::simd_read_512(addr);
+    default:
+      return rw_ops::simd_read(addr, access_size);
+  }
+}
+
+/** Reads a single access with streaming loads if it is cache line-aligned and with regular masked loads otherwise. */
+inline __m512i stream_read_single_access(char* addr, const size_t access_size) {
+  if (!rw_ops::is_aligned_access(addr, access_size)) {
+    return rw_ops::simd_read_unaligned(addr, access_size);
+  }
+
+  switch (access_size) {
+    case 64:
+      return rw_ops::simd_read_nt_64(addr);
+    case 128:
+      return rw_ops::simd_read_nt_128(addr);
+    case 256:
+      return rw_ops::simd_read_nt_256(addr);
+    case 512:
+      return rw_ops::simd_read_nt_512(addr);
+    default:
+      return rw_ops::simd_read_nt(addr, access_size);
+  }
+}
+
+inline void write_single_unaligned_access(char* addr, const size_t access_size,
+                                          const PersistInstruction persist_instruction) {
+  switch (persist_instruction) {
+#ifdef HAS_CLWB
+    case PersistInstruction::Cache:
+      return rw_ops::simd_write_clwb_unaligned(addr, access_size);
+#endif
+#ifdef HAS_CLFLUSHOPT
+    case PersistInstruction::CacheInvalidate:
+      return rw_ops::simd_write_clflushopt_unaligned(addr, access_size);
+#endif
+    case PersistInstruction::Fence:
+      return rw_ops::simd_write_fence_unaligned(addr, access_size);
+    case PersistInstruction::NoCache:
+      return rw_ops::simd_write_nt_unaligned(addr, access_size);
+    case PersistInstruction::None:
+      return rw_ops::simd_write_none_unaligned(addr, access_size);
+  }
+}
+
+/** Writes a single access with the unrolled kernels if possible and with the masked kernels otherwise. */
+inline void write_single_access(char* addr, const size_t access_size, const PersistInstruction persist_instruction) {
+  if (!rw_ops::is_aligned_access(addr, access_size)) {
+    return write_single_unaligned_access(addr, access_size, persist_instruction);
+  }
+
+  switch (persist_instruction) {
+#ifdef HAS_CLWB
+    case PersistInstruction::Cache: {
+      switch (access_size) {
+        case 64:
+          return rw_ops::simd_write_clwb_64(addr);
+        case 128:
+          return rw_ops::simd_write_clwb_128(addr);
+        case 256:
+          return rw_ops::simd_write_clwb_256(addr);
+        case 512:
+          return rw_ops::simd_write_clwb_512(addr);
+        default:
+          return rw_ops::simd_write_clwb(addr, access_size);
+      }
+    }
+#endif
+#ifdef HAS_CLFLUSHOPT
+    case PersistInstruction::CacheInvalidate: {
+      switch (access_size) {
+        case 64:
+          return rw_ops::simd_write_clflushopt_64(addr);
+        case 128:
+          return rw_ops::simd_write_clflushopt_128(addr);
+        case 256:
+          return rw_ops::simd_write_clflushopt_256(addr);
+        case 512:
+          return rw_ops::simd_write_clflushopt_512(addr);
+        default:
+          return rw_ops::simd_write_clflushopt(addr, access_size);
+      }
+    }
+#endif
+    case PersistInstruction::Fence: {
+      switch (access_size) {
+        case 64:
+          return rw_ops::simd_write_fence_64(addr);
+        case 128:
+          return rw_ops::simd_write_fence_128(addr);
+        case 256:
+          return rw_ops::simd_write_fence_256(addr);
+        case 512:
+          return rw_ops::simd_write_fence_512(addr);
+        default:
+          return rw_ops::simd_write_fence(addr, access_size);
+      }
+    }
+    case PersistInstruction::NoCache: {
+      switch (access_size) {
+        case 64:
+          return rw_ops::simd_write_nt_64(addr);
+        case 128:
+          return rw_ops::simd_write_nt_128(addr);
+        case 256:
+          return rw_ops::simd_write_nt_256(addr);
+        case 512:
+          return rw_ops::simd_write_nt_512(addr);
+        default:
+          return rw_ops::simd_write_nt(addr, access_size);
+      }
+    }
+    case PersistInstruction::None: {
+      switch (access_size) {
+        case 64:
+          return rw_ops::simd_write_none_64(addr);
+        case 128:
+          return rw_ops::simd_write_none_128(addr);
+        case 256:
+          return rw_ops::simd_write_none_256(addr);
+        case 512:
+          return rw_ops::simd_write_none_512(addr);
+        default:
+          return rw_ops::simd_write_none(addr, access_size);
+      }
+    }
+  }
+}
+
+inline void read_modify_write_single_unaligned_access(char* addr, const size_t access_size,
+                                                      const PersistInstruction persist_instruction) {
+  switch (persist_instruction) {
+#ifdef HAS_CLWB
+    case PersistInstruction::Cache:
+      return rw_ops::simd_rmw_clwb_unaligned(addr, access_size);
+#endif
+#ifdef HAS_CLFLUSHOPT
+    case PersistInstruction::CacheInvalidate:
+      return rw_ops::simd_rmw_clflushopt_unaligned(addr, access_size);
+#endif
+    case PersistInstruction::Fence:
+      return rw_ops::simd_rmw_fence_unaligned(addr, access_size);
+    case PersistInstruction::NoCache:
+      return rw_ops::simd_rmw_nt_unaligned(addr, access_size);
+    case PersistInstruction::None:
+      return rw_ops::simd_rmw_none_unaligned(addr, access_size);
+  }
+}
+
+/** Reads, modifies, and writes a single access with the unrolled kernels if possible and the masked ones otherwise. */
+inline void read_modify_write_single_access(char* addr, const size_t access_size,
+                                            const PersistInstruction persist_instruction) {
+  if (!rw_ops::is_aligned_access(addr, access_size)) {
+    return read_modify_write_single_unaligned_access(addr, access_size, persist_instruction);
+  }
+
+  switch (persist_instruction) {
+#ifdef HAS_CLWB
+    case PersistInstruction::Cache: {
+      switch (access_size) {
+        case 64:
+          return rw_ops::simd_rmw_clwb_64(addr);
+        case 128:
+          return rw_ops::simd_rmw_clwb_128(addr);
+        case 256:
+          return rw_ops::simd_rmw_clwb_256(addr);
+        case 512:
+          return rw_ops::simd_rmw_clwb_512(addr);
+        default:
+          return rw_ops::simd_rmw_clwb(addr, access_size);
+      }
+    }
+#endif
+#ifdef HAS_CLFLUSHOPT
+    case PersistInstruction::CacheInvalidate: {
+      switch (access_size) {
+        case 64:
+          return rw_ops::simd_rmw_clflushopt_64(addr);
+        case 128:
+          return rw_ops::simd_rmw_clflushopt_128(addr);
+        case 256:
+          return rw_ops::simd_rmw_clflushopt_256(addr);
+        case 512:
+          return rw_ops::simd_rmw_clflushopt_512(addr);
+        default:
+          return rw_ops::simd_rmw_clflushopt(addr, access_size);
+      }
+    }
+#endif
+    case PersistInstruction::Fence: {
+      switch (access_size) {
+        case 64:
+          return rw_ops::simd_rmw_fence_64(addr);
+        case 128:
+          return rw_ops::simd_rmw_fence_128(addr);
+        case 256:
+          return rw_ops::simd_rmw_fence_256(addr);
+        case 512:
+          return rw_ops::simd_rmw_fence_512(addr);
+        default:
+          return rw_ops::simd_rmw_fence(addr, access_size);
+      }
+    }
+    case PersistInstruction::NoCache: {
+      switch (access_size) {
+        case 64:
+          return rw_ops::simd_rmw_nt_64(addr);
+        case 128:
+          return rw_ops::simd_rmw_nt_128(addr);
+        case 256:
+          return rw_ops::simd_rmw_nt_256(addr);
+        case 512:
+          return rw_ops::simd_rmw_nt_512(addr);
+        default:
+          return rw_ops::simd_rmw_nt(addr, access_size);
+      }
+    }
+    case PersistInstruction::None: {
+      switch (access_size) {
+        case 64:
+          return rw_ops::simd_rmw_none_64(addr);
+        case 128:
+          return rw_ops::simd_rmw_none_128(addr);
+        case 256:
+          return rw_ops::simd_rmw_none_256(addr);
+        case 512:
+          return rw_ops::simd_rmw_none_512(addr);
+        default:
+          return rw_ops::simd_rmw_none(addr, access_size);
+      }
+    }
+  }
+}
+
+/**
+ * Writes a single access and flushes it according to the persist instruction, but does not issue the trailing fence.
+ * This allows the caller to batch the fences of multiple accesses. We use the masked kernels for all accesses here, as
+ * they have the same performance as the unrolled ones for aligned addresses and keep the number of variants small.
+ */
+inline void write_single_unfenced_access(char* addr, const size_t access_size,
+                                         const PersistInstruction persist_instruction) {
+  switch (persist_instruction) {
+#ifdef HAS_CLWB
+    case PersistInstruction::Cache:
+      return rw_ops::simd_write_unaligned(addr, access_size, rw_ops::flush_clwb, rw_ops::no_barrier);
+#endif
+#ifdef HAS_CLFLUSHOPT
+    case PersistInstruction::CacheInvalidate:
+      return rw_ops::simd_write_unaligned(addr, access_size, rw_ops::flush_clflushopt, rw_ops::no_barrier);
+#endif
+    case PersistInstruction::NoCache:
+      return rw_ops::simd_write_nt_unaligned(addr, access_size, rw_ops::no_barrier);
+    case PersistInstruction::Fence:
+    case PersistInstruction::None:
+      return rw_ops::simd_write_unaligned(addr, access_size, rw_ops::no_flush, rw_ops::no_barrier);
+  }
+}
+
+/** Reads a single access as input of the checksum and returns the checksum. */
+inline uint64_t checksum_read_single_access(char* addr, const size_t access_size, const Checksum checksum) {
+  return checksum == Checksum::Crc32c ? rw_ops::simd_read_crc32c(addr, access_size)
+                                      : rw_ops::simd_read_xxhash(addr, access_size);
+}
+
+/** Returns the checksum of the data that a write of `access_size` stores. */
+inline uint64_t checksum_write_data(const size_t access_size, const Checksum checksum,
+                                    const char* data = rw_ops::WRITE_DATA, const size_t data_stride = 0) {
+  return checksum == Checksum::Crc32c ? rw_ops::crc32c_write_data(access_size, data, data_stride)
+                                      : rw_ops::xxhash_write_data(access_size, data, data_stride);
+}
+
+/**
+ * Reads, modifies, and writes a single access and returns the checksum over the loaded and the modified data. Each
+ * line is loaded only once. Without `fence`, it does not issue the trailing fence, like `write_single_unfenced_access`.
+ */
+inline uint64_t checksum_read_modify_write_single_access(char* addr, const size_t access_size,
+                                                         const PersistInstruction persist_instruction,
+                                                         const Checksum checksum, const bool fence) {
+  auto* rmw_fn = checksum == Checksum::Crc32c ? &rw_ops::simd_rmw_crc32c : &rw_ops::simd_rmw_xxhash;
+  rw_ops::barrier_fn* barrier = fence ? &rw_ops::sfence_barrier : &rw_ops::no_barrier;
+  switch (persist_instruction) {
+#ifdef HAS_CLWB
+    case PersistInstruction::Cache:
+      return rmw_fn(addr, access_size, /*non_temporal=*/false, rw_ops::flush_clwb, barrier);
+#endif
+#ifdef HAS_CLFLUSHOPT
+    case PersistInstruction::CacheInvalidate:
+      return rmw_fn(addr, access_size, /*non_temporal=*/false, rw_ops::flush_clflushopt, barrier);
+#endif
+    case PersistInstruction::NoCache:
+      return rmw_fn(addr, access_size, /*non_temporal=*/true, rw_ops::no_flush, barrier);
+    case PersistInstruction::Fence:
+      return rmw_fn(addr, access_size, /*non_temporal=*/false, rw_ops::no_flush, barrier);
+    case PersistInstruction::None:
+      return rmw_fn(addr, access_size, /*non_temporal=*/false, rw_ops::no_flush, rw_ops::no_barrier);
+  }
+  return 0;
+}
+
+/**
+ * Writes a single access with the lines of a `WriteDataBuffer` and flushes it according to the persist instruction.
+ * Without `fence`, it does not issue the trailing fence, like `write_single_unfenced_access`.
+ */
+inline void write_single_pattern_access(char* addr, const size_t access_size,
+                                        const PersistInstruction persist_instruction, const char* data,
+                                        const size_t data_stride, const bool fence) {
+  rw_ops::barrier_fn* barrier = fence ? &rw_ops::sfence_barrier : &rw_ops::no_barrier;
+  switch (persist_instruction) {
+#ifdef HAS_CLWB
+    case PersistInstruction::Cache:
+      return rw_ops::simd_write_lines(addr, access_size, data, data_stride, rw_ops::flush_clwb, barrier);
+#endif
+#ifdef HAS_CLFLUSHOPT
+    case PersistInstruction::CacheInvalidate:
+      return rw_ops::simd_write_lines(addr, access_size, data, data_stride, rw_ops::flush_clflushopt, barrier);
+#endif
+    case PersistInstruction::NoCache:
+      return rw_ops::simd_write_nt_lines(addr, access_size, data, data_stride, barrier);
+    case PersistInstruction::Fence:
+      return rw_ops::simd_write_lines(addr, access_size, data, data_stride, rw_ops::no_flush, barrier);
+    case PersistInstruction::None:
+      return rw_ops::simd_write_lines(addr, access_size, data, data_stride, rw_ops::no_flush, rw_ops::no_barrier);
+  }
+}
+
+/** Same as `write_single_unfenced_access` for read-modify-writes. */
+inline void read_modify_write_single_unfenced_access(char* addr, const size_t access_size,
+                                                     const PersistInstruction persist_instruction) {
+  switch (persist_instruction) {
+#ifdef HAS_CLWB
+    case PersistInstruction::Cache:
+      return rw_ops::simd_rmw_unaligned(addr, access_size, rw_ops::flush_clwb, rw_ops::no_barrier);
+#endif
+#ifdef HAS_CLFLUSHOPT
+    case PersistInstruction::CacheInvalidate:
+      return rw_ops::simd_rmw_unaligned(addr, access_size, rw_ops::flush_clflushopt, rw_ops::no_barrier);
+#endif
+    case PersistInstruction::NoCache:
+      return rw_ops::simd_rmw_nt_unaligned(addr, access_size, rw_ops::no_barrier);
+    case PersistInstruction::Fence:
+    case PersistInstruction::None:
+      return rw_ops::simd_rmw_unaligned(addr, access_size, rw_ops::no_flush, rw_ops::no_barrier);
+  }
+}
+#endif
+
 class IoOperation {
   friend class Benchmark;
 
@@ -30,7 +395,16 @@ class IoOperation {
   IoOperation& operator=(IoOperation&&) = default;
   ~IoOperation() = default;
 
-  inline void run() {
+  // Writes store the data of `write_data` if it is set, i.e., if the benchmark has a data pattern other than constant.
+  // If the `schedule` is set, each access waits for its intended start and its latency is added to `latencies` if it is
+  // not null.
+  inline void run(WriteDataBuffer* write_data = nullptr, ArrivalSchedule* schedule = nullptr,
+                  std::vector<uint64_t>* latencies = nullptr) {
+    if (!op_sizes_.empty() || !op_types_.empty() || fence_every_ > 1 || prefetch_distance_ > 0 ||
+        checksum_ != Checksum::None || write_data != nullptr || schedule != nullptr) {
+      return run_per_access(write_data, schedule, latencies);
+    }
+
     switch (op_type_) {
       case Operation::Read: {
         return run_read();
@@ -38,6 +412,9 @@ class IoOperation {
       case Operation::Write: {
         return run_write();
       }
+      case Operation::ReadModifyWrite: {
+        return run_read_modify_write();
+      }
       default: {
         spdlog::critical("Invalid operation: {}", op_type_);
         utils::crash_exit();
@@ -47,10 +424,35 @@ class IoOperation {
 
   inline bool is_read() const { return op_type_ == Operation::Read; }
   inline bool is_write() const { return op_type_ == Operation::Write; }
+  inline bool is_read_modify_write() const { return op_type_ == Operation::ReadModifyWrite; }
+
+  // All addresses in a chunk have the same alignment, as they are all based on the same partition start and offset.
+  inline bool is_aligned_access() const {
+    return op_addresses_.empty() || rw_ops::is_aligned_access(op_addresses_[0], access_size_);
+  }
+
+  inline uint64_t total_size() const {
+    return op_sizes_.empty() ? op_addresses_.size() * access_size_ : size_bucket_counters_.total_bytes();
+  }
+
+  inline uint64_t read_size() const {
+    if (!op_types_.empty()) {
+      return mixed_read_size_;
+    }
+    return is_read() ? total_size() : 0;
+  }
 
  private:
   void run_read() {
 #ifdef HAS_AVX
+    if (!is_aligned_access()) {
+      return rw_ops::simd_read_unaligned(op_addresses_, access_size_);
+    }
+
+    if (read_instruction_ == ReadInstruction::Stream) {
+      return run_stream_read();
+    }
+
     switch (access_size_) {
       case 64:
         return rw_ops::simd_read_64(op_addresses_);
@@ -66,8 +468,29 @@ class IoOperation {
 #endif
   }
 
+  void run_stream_read() {
+#ifdef HAS_AVX
+    switch (access_size_) {
+      case 64:
+        return rw_ops::simd_read_nt_64(op_addresses_);
+      case 128:
+        return rw_ops::simd_read_nt_128(op_addresses_);
+      case 256:
+        return rw_ops::simd_read_nt_256(op_addresses_);
+      case 512:
+        return rw_ops::simd_read_nt_512(op_addresses_);
+      default:
+        return rw_ops::simd_read_nt(op_addresses_, access_size_);
+    }
+#endif
+  }
+
   void run_write() {
 #ifdef HAS_AVX
+    if (!is_aligned_access()) {
+      return run_unaligned_write();
+    }
+
     switch (persist_instruction_) {
 #ifdef HAS_CLWB
       case PersistInstruction::Cache: {
@@ -101,6 +524,20 @@ class IoOperation {
         }
       }
 #endif
+      case PersistInstruction::Fence: {
+        switch (access_size_) {
+          case 64:
+            return rw_ops::simd_write_fence_64(op_addresses_);
+          case 128:
+            return rw_ops::simd_write_fence_128(op_addresses_);
+          case 256:
+            return rw_ops::simd_write_fence_256(op_addresses_);
+          case 512:
+            return rw_ops::simd_write_fence_512(op_addresses_);
+          default:
+            return rw_ops::simd_write_fence(op_addresses_, access_size_);
+        }
+      }
       case PersistInstruction::NoCache: {
         switch (access_size_) {
           case 64:
@@ -133,30 +570,291 @@ class IoOperation {
 #endif
   }
 
+  void run_unaligned_write() {
+#ifdef HAS_AVX
+    switch (persist_instruction_) {
+#ifdef HAS_CLWB
+      case PersistInstruction::Cache:
+        return rw_ops::simd_write_clwb_unaligned(op_addresses_, access_size_);
+#endif
+#ifdef HAS_CLFLUSHOPT
+      case PersistInstruction::CacheInvalidate:
+        return rw_ops::simd_write_clflushopt_unaligned(op_addresses_, access_size_);
+#endif
+      case PersistInstruction::Fence:
+        return rw_ops::simd_write_fence_unaligned(op_addresses_, access_size_);
+      case PersistInstruction::NoCache:
+        return rw_ops::simd_write_nt_unaligned(op_addresses_, access_size_);
+      case PersistInstruction::None:
+        return rw_ops::simd_write_none_unaligned(op_addresses_, access_size_);
+    }
+#endif
+  }
+
+  void run_read_modify_write() {
+#ifdef HAS_AVX
+    if (!is_aligned_access()) {
+      return run_unaligned_read_modify_write();
+    }
+
+    switch (persist_instruction_) {
+#ifdef HAS_CLWB
+      case PersistInstruction::Cache: {
+        switch (access_size_) {
+          case 64:
+            return rw_ops::simd_rmw_clwb_64(op_addresses_);
+          case 128:
+            return rw_ops::simd_rmw_clwb_128(op_addresses_);
+          case 256:
+            return rw_ops::simd_rmw_clwb_256(op_addresses_);
+          case 512:
+            return rw_ops::simd_rmw_clwb_512(op_addresses_);
+          default:
+            return rw_ops::simd_rmw_clwb(op_addresses_, access_size_);
+        }
+      }
+#endif
+#ifdef HAS_CLFLUSHOPT
+      case PersistInstruction::CacheInvalidate: {
+        switch (access_size_) {
+          case 64:
+            return rw_ops::simd_rmw_clflushopt_64(op_addresses_);
+          case 128:
+            return rw_ops::simd_rmw_clflushopt_128(op_addresses_);
+          case 256:
+            return rw_ops::simd_rmw_clflushopt_256(op_addresses_);
+          case 512:
+            return rw_ops::simd_rmw_clflushopt_512(op_addresses_);
+          default:
+            return rw_ops::simd_rmw_clflushopt(op_addresses_, access_size_);
+        }
+      }
+#endif
+      case PersistInstruction::Fence: {
+        switch (access_size_) {
+          case 64:
+            return rw_ops::simd_rmw_fence_64(op_addresses_);
+          case 128:
+            return rw_ops::simd_rmw_fence_128(op_addresses_);
+          case 256:
+            return rw_ops::simd_rmw_fence_256(op_addresses_);
+          case 512:
+            return rw_ops::simd_rmw_fence_512(op_addresses_);
+          default:
+            return rw_ops::simd_rmw_fence(op_addresses_, access_size_);
+        }
+      }
+      case PersistInstruction::NoCache: {
+        switch (access_size_) {
+          case 64:
+            return rw_ops::simd_rmw_nt_64(op_addresses_);
+          case 128:
+            return rw_ops::simd_rmw_nt_128(op_addresses_);
+          case 256:
+            return rw_ops::simd_rmw_nt_256(op_addresses_);
+          case 512:
+            return rw_ops::simd_rmw_nt_512(op_addresses_);
+          default:
+            return rw_ops::simd_rmw_nt(op_addresses_, access_size_);
+        }
+      }
+      case PersistInstruction::None: {
+        switch (access_size_) {
+          case 64:
+            return rw_ops::simd_rmw_none_64(op_addresses_);
+          case 128:
+            return rw_ops::simd_rmw_none_128(op_addresses_);
+          case 256:
+            return rw_ops::simd_rmw_none_256(op_addresses_);
+          case 512:
+            return rw_ops::simd_rmw_none_512(op_addresses_);
+          default:
+            return rw_ops::simd_rmw_none(op_addresses_, access_size_);
+        }
+      }
+    }
+#endif
+  }
+
+  void run_unaligned_read_modify_write() {
+#ifdef HAS_AVX
+    switch (persist_instruction_) {
+#ifdef HAS_CLWB
+      case PersistInstruction::Cache:
+        return rw_ops::simd_rmw_clwb_unaligned(op_addresses_, access_size_);
+#endif
+#ifdef HAS_CLFLUSHOPT
+      case PersistInstruction::CacheInvalidate:
+        return rw_ops::simd_rmw_clflushopt_unaligned(op_addresses_, access_size_);
+#endif
+      case PersistInstruction::Fence:
+        return rw_ops::simd_rmw_fence_unaligned(op_addresses_, access_size_);
+      case PersistInstruction::NoCache:
+        return rw_ops::simd_rmw_nt_unaligned(op_addresses_, access_size_);
+      case PersistInstruction::None:
+        return rw_ops::simd_rmw_none_unaligned(op_addresses_, access_size_);
+    }
+#endif
+  }
+
+  inline size_t access_size_at(const size_t op_num) const {
+    return op_sizes_.empty() ? access_size_ : op_sizes_[op_num];
+  }
+
+  // Each access has its own size and/or operation type, the writes share fences, we prefetch future accesses, we
+  // checksum the data, the writes store a data pattern, or the accesses are rate-limited, so we dispatch the kernel for
+  // each access individually.
+  void run_per_access(WriteDataBuffer* write_data, ArrivalSchedule* schedule, std::vector<uint64_t>* latencies) {
+#ifdef HAS_AVX
+    __m512i read_value = _mm512_setzero_si512();
+    uint64_t checksum = 0;
+    const bool batch_fences = fence_every_ > 1;
+    const bool use_stream_reads = read_instruction_ == ReadInstruction::Stream;
+    const bool use_checksums = checksum_ != Checksum::None;
+    uint32_t num_unfenced_writes = 0;
+    const size_t num_ops = op_addresses_.size();
+    for (size_t i = 0; i < num_ops; ++i) {
+      if (schedule != nullptr) {
+        // The previous access ends where the next one begins to wait, which avoids a branch at each `continue`.
+        if (i > 0 && latencies != nullptr) {
+          latencies->emplace_back(schedule->latency_ns());
+        }
+        schedule->wait_for_next_op();
+      }
+
+      const size_t prefetch_op_num = i + prefetch_distance_;
+      if (prefetch_distance_ > 0 && prefetch_op_num < num_ops) {
+        rw_ops::prefetch_t0(op_addresses_[prefetch_op_num], access_size_at(prefetch_op_num));
+      }
+
+      const size_t access_size = access_size_at(i);
+      const Operation op_type = op_types_.empty() ? op_type_ : op_types_[i];
+      if (op_type == Operation::Read) {
+        if (use_checksums) {
+          checksum ^= checksum_read_single_access(op_addresses_[i], access_size, checksum_);
+          continue;
+        }
+        read_value = use_stream_reads ? stream_read_single_access(op_addresses_[i], access_size)
+                                      : read_single_access(op_addresses_[i], access_size);
+        continue;
+      }
+
+      // Read-modify-writes store the modified loaded data, so only plain writes use the data pattern.
+      const bool use_data_pattern = write_data != nullptr && op_type == Operation::Write;
+      const char* data = use_data_pattern ? write_data->next(access_size) : rw_ops::WRITE_DATA;
+      const size_t data_stride = use_data_pattern ? write_data->line_stride() : 0;
+
+      if (use_checksums && op_type == Operation::Write) {
+        checksum ^= checksum_write_data(access_size, checksum_, data, data_stride);
+      }
+
+      if (use_checksums && op_type == Operation::ReadModifyWrite) {
+        // A read-modify-write computes the checksum of the old and the modified data while it loads and stores them.
+        checksum ^= checksum_read_modify_write_single_access(op_addresses_[i], access_size, persist_instruction_,
+                                                             checksum_, !batch_fences);
+      } else if (use_data_pattern) {
+        write_single_pattern_access(op_addresses_[i], access_size, persist_instruction_, data, data_stride,
+                                    !batch_fences);
+      } else if (!batch_fences) {
+        if (op_type == Operation::ReadModifyWrite) {
+          read_modify_write_single_access(op_addresses_[i], access_size, persist_instruction_);
+        } else {
+          write_single_access(op_addresses_[i], access_size, persist_instruction_);
+        }
+      } else if (op_type == Operation::ReadModifyWrite) {
+        read_modify_write_single_unfenced_access(op_addresses_[i], access_size, persist_instruction_);
+      } else {
+        write_single_unfenced_access(op_addresses_[i], access_size, persist_instruction_);
+      }
+
+      if (batch_fences && ++num_unfenced_writes == fence_every_) {
+        rw_ops::sfence_barrier();
+        num_unfenced_writes = 0;
+      }
+    }
+
+    // All writes of a chunk must be fenced before it is considered done.
+    if (num_unfenced_writes > 0) {
+      rw_ops::sfence_barrier();
+    }
+    if (schedule != nullptr && latencies != nullptr && num_ops > 0) {
+      latencies->emplace_back(schedule->latency_ns());
+    }
+    KEEP(&read_value);
+    KEEP(&checksum);
+#endif
+  }
+
   std::vector<char*> op_addresses_;
   uint32_t access_size_;
   Operation op_type_;
   PersistInstruction persist_instruction_;
+
+  // Only set if the access sizes are drawn from a size distribution. Then, op_sizes_[i] is the size of the i-th access
+  // and the counters hold the breakdown of this chunk by size.
+  std::vector<uint32_t> op_sizes_;
+  SizeBucketCounters size_bucket_counters_;
+
+  // Only set for mixed read/write workloads. Then, op_types_[i] is the operation of the i-th access and op_type_ is
+  // ignored.
+  std::vector<Operation> op_types_;
+  uint64_t mixed_read_size_ = 0;
+
+  // Number of writes after which a single fence is issued. If greater than 1, the writes only flush individually.
+  uint32_t fence_every_ = 1;
+
+  ReadInstruction read_instruction_ = ReadInstruction::Load;
+
+  // Number of accesses that the software prefetches run ahead of the current access. 0 disables prefetching.
+  uint32_t prefetch_distance_ = 0;
+
+  Checksum checksum_ = Checksum::None;
 };
 
 class ChainedOperation {
  public:
-  ChainedOperation(const CustomOp& op, char* range_start, const size_t range_size)
+  // Variable-sized operations need a size sampler to draw the sizes from and counters to record them in. If the chain
+  // contains explicit fence operations, its writes only flush and leave the fencing to them. Random reads in a region
+  // with a Zipf distribution draw their access slot from the `zipf_generator` instead of uniformly. Compute ops do not
+  // access the range. Writes store the data of `write_data` if it is set.
+  ChainedOperation(const CustomOp& op, char* range_start, const size_t range_size,
+                   const AccessSizeSampler* size_sampler = nullptr, SizeBucketCounters* size_bucket_counters = nullptr,
+                   const bool has_explicit_fences = false, const utils::ZipfGenerator* zipf_generator = nullptr,
+                   WriteDataBuffer* write_data = nullptr)
       : range_start_(range_start),
-        access_size_(op.size),
+        // Variable-sized accesses start at a random cache line.
+        access_size_(op.has_variable_size ? rw_ops::CACHE_LINE_SIZE : op.size),
         range_size_(range_size),
         align_(-access_size_),
+        is_power_of_two_((access_size_ & (access_size_ - 1)) == 0),
         type_(op.type),
         persist_instruction_(op.persist),
-        offset_(op.offset) {}
+        read_instruction_(op.read_instruction),
+        prefetch_hint_(op.prefetch_hint),
+        read_pattern_(op.read_pattern),
+        checksum_(op.checksum),
+        offset_(op.offset),
+        size_sampler_(op.has_variable_size ? size_sampler : nullptr),
+        size_bucket_counters_(size_bucket_counters),
+        has_explicit_fences_(has_explicit_fences),
+        zipf_generator_(zipf_generator),
+        write_data_(op.type == Operation::Write ? write_data : nullptr),
+        compute_iterations_(op.type == Operation::Compute ? utils::spin_iterations_for(op.size) : op.size) {}
 
   inline void run(char* current_addr, char* dependent_addr) {
     if (type_ == Operation::Read) {
-      current_addr = get_random_address(dependent_addr);
-      dependent_addr = run_read(current_addr);
+      current_addr = get_read_address(current_addr, dependent_addr);
+      dependent_addr = run_read(current_addr, next_access_size());
+    } else if (type_ == Operation::Fence) {
+      rw_ops::sfence_barrier();
+    } else if (type_ == Operation::Prefetch) {
+      // Prefetches do not move the current address, so that following writes are still relative to the last access.
+      run_prefetch(current_addr + offset_);
+    } else if (type_ == Operation::Compute || type_ == Operation::Hash) {
+      dependent_addr = run_compute(dependent_addr);
     } else {
       current_addr += offset_;
-      run_write(current_addr);
+      run_write(current_addr, next_access_size());
     }
 
     if (next_) {
@@ -167,34 +865,106 @@ class ChainedOperation {
   inline char* get_random_address(char* addr) {
     const uint64_t base = (uint64_t)addr;
     const uint64_t random_offset = base + lehmer64();
+    if (zipf_generator_ != nullptr) {
+      // The random bits still depend on the previous read, so that the accesses of a chain are not independent.
+      return range_start_ + (zipf_generator_->sample(random_offset) * access_size_);
+    }
     const uint64_t offset_in_range = random_offset % range_size_;
-    const uint64_t aligned_offset = offset_in_range & align_;
+    // Arbitrary-sized accesses are laid out back-to-back, i.e., they are aligned to a multiple of their size.
+    const uint64_t aligned_offset =
+        is_power_of_two_ ? (offset_in_range & align_) : offset_in_range - (offset_in_range % access_size_);
     return range_start_ + aligned_offset;
   }
 
+  inline char* get_read_address(char* current_addr, char* dependent_addr) {
+    switch (read_pattern_) {
+      case ReadPattern::Random:
+        return get_random_address(dependent_addr);
+      case ReadPattern::Relative:
+        return current_addr + offset_;
+      case ReadPattern::Sequential:
+        return get_sequential_address();
+    }
+    return current_addr;
+  }
+
+  // Returns the cursor position and advances it by one access. The cursor wraps around at the end of the range.
+  inline char* get_sequential_address() {
+    if (sequential_offset_ >= range_size_) {
+      sequential_offset_ = 0;
+    }
+    char* addr = range_start_ + sequential_offset_;
+    sequential_offset_ += access_size_;
+    return addr;
+  }
+
   void set_next(ChainedOperation* next) { next_ = next; }
 
+  /** Returns the address that this operation accesses when the previous operation of the chain accessed
+   * `current_addr` and the last read returned `dependent_addr`. Used to run single steps of interleaved chains. */
+  inline char* get_target_address(char* current_addr, char* dependent_addr) {
+    if (type_ == Operation::Read) {
+      return get_read_address(current_addr, dependent_addr);
+    }
+    if (type_ == Operation::Fence || type_ == Operation::Compute || type_ == Operation::Hash) {
+      return current_addr;
+    }
+    return current_addr + offset_;
+  }
+
+  /** Prefetches the data that this operation will access at `target_addr` into the cache. */
+  inline void prefetch_target(char* target_addr) {
+    if (type_ == Operation::Read || type_ == Operation::Write) {
+      rw_ops::prefetch_t0(target_addr, access_size_);
+    }
+  }
+
+  /** Runs only this operation and not the rest of the chain. Returns the address for the next dependent read. */
+  inline char* run_step(char* target_addr, char* dependent_addr) {
+    if (type_ == Operation::Read) {
+      return run_read(target_addr, next_access_size());
+    }
+    if (type_ == Operation::Compute || type_ == Operation::Hash) {
+      return run_compute(dependent_addr);
+    }
+
+    if (type_ == Operation::Fence) {
+      rw_ops::sfence_barrier();
+    } else if (type_ == Operation::Prefetch) {
+      run_prefetch(target_addr);
+    } else {
+      run_write(target_addr, next_access_size());
+    }
+    return dependent_addr;
+  }
+
+  /** Prefetches, fences, and compute ops do not move the current address of the chain. */
+  inline bool moves_current_address() const { return type_ == Operation::Read || type_ == Operation::Write; }
+
+  int64_t offset() const { return offset_; }
+
+  /** Whether this write stores the data of a `WriteDataBuffer` instead of WRITE_DATA. */
+  bool has_write_data() const { return write_data_ != nullptr; }
+
  private:
-  inline char* run_read(char* addr) {
-#ifdef HAS_AVX
-    __m512i read_value;
-    switch (access_size_) {
-      case 64:
-        read_value = rw_ops::simd_read_64(addr);
-        break;
-      case 128:
-        read_value = rw_ops::simd_read_128(addr);
-        break;
-      case 256:
-        read_value = rw_ops::simd_read_256(addr);
-        break;
-      case 512:
-        read_value = rw_ops::simd_read_512(addr);
-        break;
-      default:
-        read_value = rw_ops::simd_read(addr, access_size_);
+  inline size_t next_access_size() {
+    if (size_sampler_ == nullptr) {
+      return access_size_;
     }
 
+    const uint32_t access_size = size_sampler_->sample();
+    size_bucket_counters_->add(access_size);
+    return access_size;
+  }
+
+  inline char* run_read(char* addr, const size_t access_size) {
+#ifdef HAS_AVX
+    if (checksum_ != Checksum::None) {
+      // The next dependent read can only start once the checksum over all loaded data is computed.
+      return (char*)checksum_read_single_access(addr, access_size, checksum_);
+    }
+    __m512i read_value = read_instruction_ == ReadInstruction::Stream ? stream_read_single_access(addr, access_size)
+                                                                      : read_single_access(addr, access_size);
     // Make sure the compiler does not optimize the load away.
     KEEP(&read_value);
     return (char*)read_value[0];
@@ -204,70 +974,41 @@ class ChainedOperation {
 #endif
   }
 
-  inline void run_write(char* addr) {
+  inline void run_prefetch(char* addr) {
+    if (prefetch_hint_ == PrefetchHint::NTA) {
+      return rw_ops::prefetch_nta(addr, access_size_);
+    }
+    rw_ops::prefetch_t0(addr, access_size_);
+  }
+
+  // Busy-waits independently of the loaded data or hashes it, so that the next dependent read waits for the hash.
+  inline char* run_compute(char* dependent_addr) const {
+    if (type_ == Operation::Compute) {
+      utils::spin(compute_iterations_);
+      return dependent_addr;
+    }
+    return (char*)utils::hash_rounds((uint64_t)dependent_addr, compute_iterations_);
+  }
+
+  inline void run_write(char* addr, const size_t access_size) {
 #ifdef HAS_AVX
-    switch (persist_instruction_) {
-#ifdef HAS_CLWB
-      case PersistInstruction::Cache: {
-        switch (access_size_) {
-          case 64:
-            return rw_ops::simd_write_clwb_64(addr);
-          case 128:
-            return rw_ops::simd_write_clwb_128(addr);
-          case 256:
-            return rw_ops::simd_write_clwb_256(addr);
-          case 512:
-            return rw_ops::simd_write_clwb_512(addr);
-          default:
-            return rw_ops::simd_write_clwb(addr, access_size_);
-        }
-      }
-#endif
-#ifdef HAS_CLFLUSHOPT
-      case PersistInstruction::CacheInvalidate: {
-        switch (access_size_) {
-          case 64:
-            return rw_ops::simd_write_clflushopt_64(addr);
-          case 128:
-            return rw_ops::simd_write_clflushopt_128(addr);
-          case 256:
-            return rw_ops::simd_write_clflushopt_256(addr);
-          case 512:
-            return rw_ops::simd_write_clflushopt_512(addr);
-          default:
-            return rw_ops::simd_write_clflushopt(addr, access_size_);
-        }
-      }
-#endif
-      case PersistInstruction::NoCache: {
-        switch (access_size_) {
-          case 64:
-            return rw_ops::simd_write_nt_64(addr);
-          case 128:
-            return rw_ops::simd_write_nt_128(addr);
-          case 256:
-            return rw_ops::simd_write_nt_256(addr);
-          case 512:
-            return rw_ops::simd_write_nt_512(addr);
-          default:
-            return rw_ops::simd_write_nt(addr, access_size_);
-        }
-      }
-      case PersistInstruction::None: {
-        switch (access_size_) {
-          case 64:
-            return rw_ops::simd_write_none_64(addr);
-          case 128:
-            return rw_ops::simd_write_none_128(addr);
-          case 256:
-            return rw_ops::simd_write_none_256(addr);
-          case 512:
-            return rw_ops::simd_write_none_512(addr);
-          default:
-            return rw_ops::simd_write_none(addr, access_size_);
-        }
+    if (write_data_ != nullptr) {
+      const char* data = write_data_->next(access_size);
+      if (checksum_ != Checksum::None) {
+        const uint64_t checksum = checksum_write_data(access_size, checksum_, data, write_data_->line_stride());
+        KEEP(&checksum);
       }
+      return write_single_pattern_access(addr, access_size, persist_instruction_, data, write_data_->line_stride(),
+                                         !has_explicit_fences_);
     }
+    if (checksum_ != Checksum::None) {
+      const uint64_t checksum = checksum_write_data(access_size, checksum_);
+      KEEP(&checksum);
+    }
+    if (has_explicit_fences_) {
+      return write_single_unfenced_access(addr, access_size, persist_instruction_);
+    }
+    write_single_access(addr, access_size, persist_instruction_);
 #endif
   }
 
@@ -276,10 +1017,88 @@ class ChainedOperation {
   const size_t access_size_;
   const size_t range_size_;
   const size_t align_;
+  const bool is_power_of_two_;
   ChainedOperation* next_ = nullptr;
   const Operation type_;
   const PersistInstruction persist_instruction_;
+  const ReadInstruction read_instruction_;
+  const PrefetchHint prefetch_hint_;
+  const ReadPattern read_pattern_;
+  const Checksum checksum_;
   const int64_t offset_;
+  const AccessSizeSampler* const size_sampler_;
+  SizeBucketCounters* const size_bucket_counters_;
+  const bool has_explicit_fences_;
+  const utils::ZipfGenerator* const zipf_generator_;
+  WriteDataBuffer* const write_data_;
+  // Number of spin iterations for busy-waits and number of rounds for hashes.
+  const uint64_t compute_iterations_;
+  // Position of the next sequential read, relative to the range start. Each thread has its own operation chain.
+  size_t sequential_offset_ = 0;
+};
+
+/**
+ * Runs multiple independent instances of an operation chain in a single thread to increase its memory-level
+ * parallelism, similar to asynchronous memory access chaining (AMAC). After each operation of an instance, we compute
+ * the address of the instance's next operation, prefetch it, and switch to the next instance. When we come back to the
+ * instance, its data is ideally already in the cache, so the cache misses of all instances overlap instead of each
+ * chain waiting for one miss at a time.
+ */
+class InterleavedChains {
+ public:
+  InterleavedChains(std::vector<ChainedOperation>& operation_chain, const size_t width, char* start_addr)
+      : operation_chain_(operation_chain), start_addr_(start_addr) {
+    ChainedOperation& start_op = operation_chain_[0];
+    instances_.resize(width, ChainState{0, nullptr, start_addr_, start_addr_});
+    for (ChainState& instance : instances_) {
+      // All instances start with different random addresses, as each call advances the random number generator.
+      instance.target_addr = start_op.get_target_address(start_addr_, start_addr_);
+      start_op.prefetch_target(instance.target_addr);
+    }
+  }
+
+  /** Runs the interleaved instances until `num_chains` chains completed. Instances keep their state across calls. */
+  inline void run(const uint64_t num_chains) {
+    uint64_t num_completed_chains = 0;
+    const size_t num_ops = operation_chain_.size();
+    while (true) {
+      for (ChainState& instance : instances_) {
+        ChainedOperation& op = operation_chain_[instance.op_idx];
+        instance.dependent_addr = op.run_step(instance.target_addr, instance.dependent_addr);
+        if (op.moves_current_address()) {
+          instance.current_addr = instance.target_addr;
+        }
+
+        if (++instance.op_idx == num_ops) {
+          // Start a new chain in this instance.
+          instance.op_idx = 0;
+          instance.current_addr = start_addr_;
+          instance.dependent_addr = start_addr_;
+          num_completed_chains++;
+        }
+
+        ChainedOperation& next_op = operation_chain_[instance.op_idx];
+        instance.target_addr = next_op.get_target_address(instance.current_addr, instance.dependent_addr);
+        next_op.prefetch_target(instance.target_addr);
+
+        if (num_completed_chains == num_chains) {
+          return;
+        }
+      }
+    }
+  }
+
+ private:
+  struct ChainState {
+    size_t op_idx;
+    char* target_addr;
+    char* current_addr;
+    char* dependent_addr;
+  };
+
+  std::vector<ChainedOperation>& operation_chain_;
+  std::vector<ChainState> instances_;
+  char* const start_addr_;
 };
 
 }  // namespace perma
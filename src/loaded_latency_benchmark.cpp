@@ -0,0 +1,118 @@
+#include "loaded_latency_benchmark.hpp"
+
+namespace {
+
+// Each step runs the latency config and one of the bandwidth configs, so both alternate.
+std::vector<perma::BenchmarkConfig> interleave_step_configs(
+    const perma::BenchmarkConfig& latency_config, const std::vector<perma::BenchmarkConfig>& bandwidth_step_configs) {
+  std::vector<perma::BenchmarkConfig> configs;
+  configs.reserve(2 * bandwidth_step_configs.size());
+  for (const perma::BenchmarkConfig& bandwidth_config : bandwidth_step_configs) {
+    configs.push_back(latency_config);
+    configs.push_back(bandwidth_config);
+  }
+  return configs;
+}
+
+}  // namespace
+
+namespace perma {
+
+bool LoadedLatencyBenchmark::run() {
+  for (size_t step = 0; step < num_steps(); ++step) {
+    const size_t latency_idx = 2 * step;
+    const size_t bandwidth_idx = latency_idx + 1;
+    BenchmarkExecution* bandwidth_execution = executions_[bandwidth_idx].get();
+    start_step(bandwidth_idx);
+
+    // The latency threads only start once all bandwidth threads generated their addresses and load the memory.
+    wait_for_execution_start(bandwidth_execution, configs_[bandwidth_idx].number_threads);
+    start_step(latency_idx);
+    if (!finish_step(latency_idx)) {
+      return false;
+    }
+
+    bandwidth_execution->is_stopped = true;
+    if (!finish_step(bandwidth_idx)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void LoadedLatencyBenchmark::create_data_files() {
+  pmem_data_.push_back(create_pmem_data_file(configs_[0], memory_regions_[0], configs_[0].memory_range));
+  pmem_data_.push_back(create_pmem_data_file(configs_[1], memory_regions_[1], configs_[1].memory_range));
+
+  dram_data_.push_back(create_dram_data(configs_[0], configs_[0].dram_memory_range));
+  dram_data_.push_back(create_dram_data(configs_[1], configs_[1].dram_memory_range));
+
+  custom_region_files_.resize(2);
+  custom_region_data_.push_back(create_custom_region_data(configs_[0], &custom_region_files_[0]));
+  custom_region_data_.push_back(create_custom_region_data(configs_[1], &custom_region_files_[1]));
+}
+
+void LoadedLatencyBenchmark::set_up() {
+  // The bandwidth executions must be marked before their set up, which does not record their latencies.
+  for (size_t config_idx = 1; config_idx < configs_.size(); config_idx += 2) {
+    executions_[config_idx]->run_until_stopped = true;
+  }
+  // The data of the latency benchmark is at index 0 and the data of the bandwidth benchmark at index 1.
+  set_up_steps(2);
+}
+
+nlohmann::json LoadedLatencyBenchmark::get_result_as_json() {
+  // The bandwidth configs only differ in their target bandwidth, which is listed as injection rates instead.
+  nlohmann::json bandwidth_config = get_json_config(1);
+  bandwidth_config.erase("target_bandwidth");
+  bandwidth_config.erase("arrival_pattern");
+  nlohmann::json injection_rates = nlohmann::json::array();
+
+  nlohmann::json steps = nlohmann::json::array();
+  for (size_t step = 0; step < num_steps(); ++step) {
+    const nlohmann::json latency_results = results_[2 * step]->get_result_as_json()["results"];
+    const nlohmann::json bandwidth_results = results_[(2 * step) + 1]->get_result_as_json()["results"];
+    const uint64_t injection_rate = configs_[(2 * step) + 1].target_bandwidth;
+    injection_rates.push_back(injection_rate);
+
+    nlohmann::json step_result;
+    step_result["injection_rate"] = injection_rate;
+    step_result["bandwidth"] = bandwidth_results["bandwidth"];
+    step_result["latency"] = latency_results["latency"];
+    step_result["results"][latency_benchmark_name_] = latency_results;
+    step_result["results"][bandwidth_benchmark_name_] = bandwidth_results;
+    steps.emplace_back(std::move(step_result));
+  }
+  bandwidth_config["injection_rates"] = injection_rates;
+
+  nlohmann::json result;
+  result["config"][latency_benchmark_name_] = get_json_config(0);
+  result["config"][bandwidth_benchmark_name_] = bandwidth_config;
+  result["results"]["steps"] = steps;
+  return result;
+}
+
+LoadedLatencyBenchmark::LoadedLatencyBenchmark(const std::string& benchmark_name, std::string latency_benchmark_name,
+                                               std::string bandwidth_benchmark_name,
+                                               const BenchmarkConfig& latency_config,
+                                               const std::vector<BenchmarkConfig>& bandwidth_step_configs,
+                                               std::vector<std::unique_ptr<BenchmarkExecution>>&& executions,
+                                               std::vector<std::unique_ptr<BenchmarkResult>>&& results)
+    : Benchmark(benchmark_name, BenchmarkType::LoadedLatency,
+                std::vector<MemoryRegion>{{utils::generate_random_file_name(latency_config.pmem_directory), true,
+                                           latency_config.is_hybrid},
+                                          {utils::generate_random_file_name(bandwidth_step_configs[0].pmem_directory),
+                                           true, bandwidth_step_configs[0].is_hybrid}},
+                interleave_step_configs(latency_config, bandwidth_step_configs), std::move(executions),
+                std::move(results)),
+      latency_benchmark_name_{std::move(latency_benchmark_name)},
+      bandwidth_benchmark_name_{std::move(bandwidth_benchmark_name)} {}
+
+const std::string& LoadedLatencyBenchmark::get_latency_benchmark_name() const { return latency_benchmark_name_; }
+
+const std::string& LoadedLatencyBenchmark::get_bandwidth_benchmark_name() const { return bandwidth_benchmark_name_; }
+
+size_t LoadedLatencyBenchmark::num_steps() const { return configs_.size() / 2; }
+
+}  // namespace perma
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <string>
+
+#include "benchmark.hpp"
+
+namespace perma {
+
+/**
+ * Measures the latency of a latency benchmark, e.g., a pointer chase, while the threads of a bandwidth benchmark load
+ * the memory at increasing injection rates, like Intel MLC's loaded-latency test. Each step runs the latency threads
+ * once while the bandwidth threads run at the `target_bandwidth` of the step's bandwidth config. The bandwidth threads
+ * start first and run until the latency threads are done, so that the latency is always measured under load. The
+ * result is a curve of the achieved bandwidth and the latency of each step.
+ */
+class LoadedLatencyBenchmark : public Benchmark {
+ public:
+  /**
+   * The bandwidth benchmark has one config per step, which only differ in their `target_bandwidth`. The executions and
+   * results hold one entry per config in the order latency, bandwidth of the first step, latency, bandwidth of the
+   * second step, and so on.
+   */
+  LoadedLatencyBenchmark(const std::string& benchmark_name, std::string latency_benchmark_name,
+                         std::string bandwidth_benchmark_name, const BenchmarkConfig& latency_config,
+                         const std::vector<BenchmarkConfig>& bandwidth_step_configs,
+                         std::vector<std::unique_ptr<BenchmarkExecution>>&& executions,
+                         std::vector<std::unique_ptr<BenchmarkResult>>&& results);
+
+  LoadedLatencyBenchmark(LoadedLatencyBenchmark&& other) = default;
+  LoadedLatencyBenchmark(const LoadedLatencyBenchmark& other) = delete;
+  LoadedLatencyBenchmark& operator=(const LoadedLatencyBenchmark& other) = delete;
+  LoadedLatencyBenchmark& operator=(LoadedLatencyBenchmark&& other) = delete;
+
+  /** Main run method which executes the benchmark. `setup()` should be called before this. */
+  bool run() override;
+
+  /**
+   * Generates the data needed for the benchmark. All steps share the data of the latency and the bandwidth benchmark.
+   */
+  void create_data_files() override;
+
+  /** Create all the IO addresses ahead of time to avoid unnecessary ops during the actual benchmark. */
+  void set_up() override;
+
+  /** Return the results as a JSON to be exported to the user and visualization. */
+  nlohmann::json get_result_as_json() override;
+
+  const std::string& get_latency_benchmark_name() const;
+  const std::string& get_bandwidth_benchmark_name() const;
+  size_t num_steps() const;
+
+  ~LoadedLatencyBenchmark() { LoadedLatencyBenchmark::tear_down(false); }
+
+ private:
+  const std::string latency_benchmark_name_;
+  const std::string bandwidth_benchmark_name_;
+};
+
+}  // namespace perma
@@ -0,0 +1,230 @@
+#include "matrix_search_benchmark.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <numeric>
+#include <random>
+#include <set>
+
+#include "single_benchmark.hpp"
+
+namespace {
+
+// The samples only need to be reproducible, not different across runs.
+constexpr uint64_t LATIN_HYPERCUBE_SEED = 42;
+
+double get_throughput(const nlohmann::json& results) {
+  if (results.contains("bandwidth")) {
+    return results["bandwidth"];
+  }
+  return results.value("ops_per_second", 0.0);
+}
+
+}  // namespace
+
+namespace perma {
+
+const std::unordered_map<std::string, MatrixSearchStrategy> MatrixSearchConfig::str_to_strategy{
+    {"latin_hypercube", MatrixSearchStrategy::LatinHypercube}, {"adaptive", MatrixSearchStrategy::Adaptive}};
+
+nlohmann::json MatrixSearchConfig::as_json() const {
+  nlohmann::json config;
+  config["strategy"] = utils::get_enum_as_string(str_to_strategy, strategy);
+  if (strategy == MatrixSearchStrategy::LatinHypercube) {
+    config["samples"] = samples;
+  } else {
+    config["refine_threshold"] = refine_threshold;
+  }
+  config["max_runs"] = max_runs;
+  return config;
+}
+
+bool MatrixSearchBenchmark::run() {
+  const bool success = search_config_.strategy == MatrixSearchStrategy::LatinHypercube ? run_latin_hypercube()
+                                                                                       : run_adaptive();
+
+  // All points with read-only configs share the data file, which is not needed after the search.
+  remove_shared_file(configs_[0], memory_regions_[0].pmem_file);
+  return success;
+}
+
+bool MatrixSearchBenchmark::run_latin_hypercube() {
+  for (const size_t config_idx : latin_hypercube_sample(dimensions_, search_config_.samples, LATIN_HYPERCUBE_SEED)) {
+    if (points_.size() >= search_config_.max_runs) {
+      break;
+    }
+    if (!run_point(config_idx)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool MatrixSearchBenchmark::run_adaptive() {
+  // Start with a coarse grid of the first, middle, and last value of each dimension.
+  std::vector<size_t> coordinates(dimensions_.size(), 0);
+  std::set<size_t> next_points{};
+  std::function<void(size_t)> add_coarse_grid = [&](const size_t dim_idx) {
+    if (dim_idx == dimensions_.size()) {
+      next_points.insert(to_config_idx(coordinates));
+      return;
+    }
+    const size_t last_value = dimensions_[dim_idx].num_values - 1;
+    for (const size_t value : {size_t{0}, last_value / 2, last_value}) {
+      coordinates[dim_idx] = value;
+      add_coarse_grid(dim_idx + 1);
+    }
+  };
+  add_coarse_grid(0);
+
+  std::map<size_t, double> throughputs{};
+  while (!next_points.empty()) {
+    for (const size_t config_idx : next_points) {
+      if (points_.size() >= search_config_.max_runs) {
+        spdlog::info("Matrix search {} stopped after the maximum of {} runs.", benchmark_name_, points_.size());
+        return true;
+      }
+      if (!run_point(config_idx)) {
+        return false;
+      }
+      throughputs[config_idx] = points_.back().throughput;
+    }
+
+    // Refine between each point and its next measured neighbor in each dimension if the throughput changes sharply.
+    next_points.clear();
+    for (const auto& [config_idx, throughput] : throughputs) {
+      const std::vector<size_t> point = to_coordinates(config_idx);
+      for (size_t dim_idx = 0; dim_idx < dimensions_.size(); ++dim_idx) {
+        std::vector<size_t> neighbor = point;
+        auto neighbor_it = throughputs.end();
+        while (neighbor_it == throughputs.end() && ++neighbor[dim_idx] < dimensions_[dim_idx].num_values) {
+          neighbor_it = throughputs.find(to_config_idx(neighbor));
+        }
+        if (neighbor_it == throughputs.end() || neighbor[dim_idx] - point[dim_idx] < 2) {
+          continue;
+        }
+
+        const double max_throughput = std::max(throughput, neighbor_it->second);
+        const double change = max_throughput > 0 ? std::abs(neighbor_it->second - throughput) / max_throughput : 0;
+        if (change > search_config_.refine_threshold) {
+          std::vector<size_t> middle = point;
+          middle[dim_idx] = (point[dim_idx] + neighbor[dim_idx]) / 2;
+          next_points.insert(to_config_idx(middle));
+        }
+      }
+    }
+  }
+  return true;
+}
+
+bool MatrixSearchBenchmark::run_point(const size_t config_idx) {
+  const std::unique_ptr<SingleBenchmark> point = run_single_config(configs_[config_idx], memory_regions_[0].pmem_file);
+  if (point == nullptr) {
+    return false;
+  }
+
+  nlohmann::json point_results = point->get_result_as_json()["results"];
+  const double throughput = get_throughput(point_results);
+  spdlog::info("Matrix search run #{}: point {}/{} with throughput {:.2f}.", points_.size() + 1, config_idx + 1,
+               configs_.size(), throughput);
+  points_.push_back(MatrixSearchPoint{config_idx, throughput, std::move(point_results)});
+  return true;
+}
+
+std::vector<size_t> MatrixSearchBenchmark::latin_hypercube_sample(const std::vector<MatrixDimension>& dimensions,
+                                                                  const uint32_t samples, const uint64_t seed) {
+  // Each dimension is split into `samples` strata, which are assigned to the samples in random order. This covers all
+  // values of a dimension evenly, independent of the other dimensions.
+  std::mt19937_64 generator{seed};
+  std::vector<size_t> config_indices(samples, 0);
+  std::vector<size_t> strata(samples);
+  for (const MatrixDimension& dimension : dimensions) {
+    std::iota(strata.begin(), strata.end(), 0);
+    std::shuffle(strata.begin(), strata.end(), generator);
+    for (size_t sample = 0; sample < samples; ++sample) {
+      config_indices[sample] = config_indices[sample] * dimension.num_values +
+                               (strata[sample] * dimension.num_values / samples);
+    }
+  }
+
+  // Small dimensions have fewer values than samples, so some samples may hit the same config.
+  std::sort(config_indices.begin(), config_indices.end());
+  config_indices.erase(std::unique(config_indices.begin(), config_indices.end()), config_indices.end());
+  return config_indices;
+}
+
+std::vector<size_t> MatrixSearchBenchmark::to_coordinates(size_t config_idx) const {
+  std::vector<size_t> coordinates(dimensions_.size());
+  for (size_t dim_idx = dimensions_.size(); dim_idx > 0; --dim_idx) {
+    coordinates[dim_idx - 1] = config_idx % dimensions_[dim_idx - 1].num_values;
+    config_idx /= dimensions_[dim_idx - 1].num_values;
+  }
+  return coordinates;
+}
+
+size_t MatrixSearchBenchmark::to_config_idx(const std::vector<size_t>& coordinates) const {
+  size_t config_idx = 0;
+  for (size_t dim_idx = 0; dim_idx < dimensions_.size(); ++dim_idx) {
+    config_idx = config_idx * dimensions_[dim_idx].num_values + coordinates[dim_idx];
+  }
+  return config_idx;
+}
+
+void MatrixSearchBenchmark::create_data_files() {}
+
+void MatrixSearchBenchmark::set_up() {}
+
+nlohmann::json MatrixSearchBenchmark::get_result_as_json() {
+  // Report the points in the order of the matrix instead of the order in which they ran.
+  std::vector<const MatrixSearchPoint*> sorted_points{};
+  sorted_points.reserve(points_.size());
+  for (const MatrixSearchPoint& point : points_) {
+    sorted_points.push_back(&point);
+  }
+  std::sort(sorted_points.begin(), sorted_points.end(), [](const MatrixSearchPoint* lhs, const MatrixSearchPoint* rhs) {
+    return lhs->config_idx < rhs->config_idx;
+  });
+
+  nlohmann::json points_json = nlohmann::json::array();
+  for (const MatrixSearchPoint* point : sorted_points) {
+    const nlohmann::json point_config = configs_[point->config_idx].as_json();
+    nlohmann::json point_json;
+    for (const std::string& arg_name : configs_[point->config_idx].matrix_args) {
+      point_json[arg_name] = point_config.contains(arg_name) ? point_config[arg_name] : nullptr;
+    }
+    point_json["throughput"] = point->throughput;
+    point_json["results"] = point->results;
+    points_json.push_back(point_json);
+  }
+
+  nlohmann::json result;
+  result["config"] = get_json_config(0);
+  result["config"]["matrix_search"] = search_config_.as_json();
+  result["results"]["matrix_size"] = configs_.size();
+  result["results"]["num_runs"] = points_.size();
+  result["results"]["points"] = points_json;
+  return result;
+}
+
+MatrixSearchBenchmark::MatrixSearchBenchmark(const std::string& benchmark_name,
+                                             const std::vector<BenchmarkConfig>& matrix_configs,
+                                             std::vector<MatrixDimension> dimensions,
+                                             const MatrixSearchConfig& search_config)
+    : Benchmark(benchmark_name, BenchmarkType::MatrixSearch,
+                std::vector<MemoryRegion>{{utils::generate_random_file_name(matrix_configs[0].pmem_directory), true,
+                                           matrix_configs[0].is_hybrid}},
+                matrix_configs, {}, {}),
+      dimensions_{std::move(dimensions)},
+      search_config_{search_config} {}
+
+const MatrixSearchConfig& MatrixSearchBenchmark::get_search_config() const { return search_config_; }
+
+const std::vector<MatrixDimension>& MatrixSearchBenchmark::get_dimensions() const { return dimensions_; }
+
+const std::vector<MatrixSearchPoint>& MatrixSearchBenchmark::get_points() const { return points_; }
+
+}  // namespace perma
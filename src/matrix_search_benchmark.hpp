@@ -0,0 +1,93 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include "benchmark.hpp"
+
+namespace perma {
+
+enum class MatrixSearchStrategy : uint8_t { LatinHypercube, Adaptive };
+
+struct MatrixSearchConfig {
+  static const std::unordered_map<std::string, MatrixSearchStrategy> str_to_strategy;
+
+  /**
+   * `latin_hypercube` runs `samples` points of the matrix, so that each dimension's values are covered evenly.
+   * `adaptive` starts with the first, middle, and last value of each dimension and then runs the points between two
+   * neighbors whose bandwidth differs by more than `refine_threshold`, e.g., to find the knee along `number_threads`.
+   */
+  MatrixSearchStrategy strategy = MatrixSearchStrategy::Adaptive;
+  uint32_t samples = 0;
+  double refine_threshold = 0.1;
+
+  /** Upper bound of benchmark runs of the search. */
+  uint32_t max_runs = 32;
+
+  nlohmann::json as_json() const;
+};
+
+// A dimension of the matrix with the number of its values. The configs of the matrix iterate the last dimension first.
+// The args of a `zip` group form a single dimension, whose name joins their names with '+'.
+struct MatrixDimension {
+  std::string name;
+  size_t num_values;
+};
+
+// One run of the search at a point of the matrix.
+struct MatrixSearchPoint {
+  size_t config_idx;
+  // Bandwidth of the run or, for custom operations without accesses, its ops/s.
+  double throughput;
+  nlohmann::json results;
+};
+
+/**
+ * Runs a subset of a benchmark matrix instead of all its configs, i.e., the cartesian product of all values. Each point
+ * runs as a single benchmark. The result contains all points that the search ran, ordered like the matrix.
+ */
+class MatrixSearchBenchmark : public Benchmark {
+ public:
+  MatrixSearchBenchmark(const std::string& benchmark_name, const std::vector<BenchmarkConfig>& matrix_configs,
+                        std::vector<MatrixDimension> dimensions, const MatrixSearchConfig& search_config);
+
+  MatrixSearchBenchmark(MatrixSearchBenchmark&& other) = default;
+  MatrixSearchBenchmark(const MatrixSearchBenchmark& other) = delete;
+  MatrixSearchBenchmark& operator=(const MatrixSearchBenchmark& other) = delete;
+  MatrixSearchBenchmark& operator=(MatrixSearchBenchmark&& other) = delete;
+
+  /** Runs the points of the search one after another. */
+  bool run() override;
+
+  /** Each point creates its own data, so there is nothing to do here. */
+  void create_data_files() override;
+
+  /** Each point sets up its own threads, so there is nothing to do here. */
+  void set_up() override;
+
+  /** Return the results as a JSON to be exported to the user and visualization. */
+  nlohmann::json get_result_as_json() override;
+
+  const MatrixSearchConfig& get_search_config() const;
+  const std::vector<MatrixDimension>& get_dimensions() const;
+  const std::vector<MatrixSearchPoint>& get_points() const;
+
+  // Returns the indices of the configs that a Latin hypercube sample of the matrix covers, in ascending order.
+  static std::vector<size_t> latin_hypercube_sample(const std::vector<MatrixDimension>& dimensions, uint32_t samples,
+                                                    uint64_t seed);
+
+ private:
+  bool run_latin_hypercube();
+  bool run_adaptive();
+  // Runs the config at `config_idx` and adds the point's result.
+  bool run_point(size_t config_idx);
+
+  std::vector<size_t> to_coordinates(size_t config_idx) const;
+  size_t to_config_idx(const std::vector<size_t>& coordinates) const;
+
+  const std::vector<MatrixDimension> dimensions_;
+  const MatrixSearchConfig search_config_;
+  std::vector<MatrixSearchPoint> points_;
+};
+
+}  // namespace perma
@@ -2,6 +2,8 @@
 
 #include <spdlog/spdlog.h>
 
+#include <cstring>
+
 #include "read_write_ops.hpp"
 #include "utils.hpp"
 
@@ -209,4 +211,26 @@ bool has_far_numa_nodes() {
 #endif
 }
 
+void bind_to_numa_node(char* addr, const size_t length, const uint16_t numa_node) {
+#ifndef HAS_NUMA
+  spdlog::critical("Cannot bind memory to NUMA node {} without NUMA support.", numa_node);
+  utils::crash_exit();
+#else
+  const size_t num_numa_nodes = numa_num_configured_nodes();
+  if (numa_node >= num_numa_nodes) {
+    spdlog::critical("Given numa node too large! (given: {}, max: {})", numa_node, num_numa_nodes - 1);
+    utils::crash_exit();
+  }
+
+  bitmask* numa_nodes = numa_bitmask_alloc(num_numa_nodes);
+  numa_bitmask_setbit(numa_nodes, numa_node);
+  const long bind_result = mbind(addr, length, MPOL_BIND, numa_nodes->maskp, numa_nodes->size + 1, 0);
+  numa_free_nodemask(numa_nodes);
+  if (bind_result != 0) {
+    spdlog::critical("Could not bind memory to NUMA node {}. Error: {}", numa_node, std::strerror(errno));
+    utils::crash_exit();
+  }
+#endif
+}
+
 }  // namespace perma
@@ -12,4 +12,7 @@ void set_to_far_cpus();
 
 bool has_far_numa_nodes();
 
+/** Binds the pages of the given memory range to a NUMA node. Must be called before the pages are first accessed. */
+void bind_to_numa_node(char* addr, size_t length, uint16_t numa_node);
+
 }  // namespace perma
@@ -1,12 +1,40 @@
 #include "parallel_benchmark.hpp"
 
+#include <spdlog/spdlog.h>
+#include <sys/mman.h>
+
+#include <algorithm>
 #include <csignal>
+#include <numeric>
+
+#include "dirty_line_counter.hpp"
 
 namespace {
 
 volatile sig_atomic_t thread_error;
 void thread_error_handler(int) { thread_error = 1; }
 
+// Sub-benchmarks with a reused PMem file do not own it. All others generate their own file. In a shared region, the
+// first sub-benchmark owns the file of all sub-benchmarks.
+std::vector<perma::MemoryRegion> create_memory_regions(const std::vector<perma::BenchmarkConfig>& configs,
+                                                       const std::vector<std::filesystem::path>& reused_pmem_files,
+                                                       const bool shared_region) {
+  std::vector<perma::MemoryRegion> memory_regions{};
+  memory_regions.reserve(configs.size());
+  for (size_t bm_num = 0; bm_num < configs.size(); ++bm_num) {
+    const perma::BenchmarkConfig& config = configs[bm_num];
+    if (shared_region && bm_num > 0) {
+      memory_regions.emplace_back(memory_regions[0].pmem_file, false, config.is_hybrid);
+    } else if (reused_pmem_files[bm_num].empty()) {
+      memory_regions.emplace_back(perma::utils::generate_random_file_name(config.pmem_directory), true,
+                                  config.is_hybrid);
+    } else {
+      memory_regions.emplace_back(reused_pmem_files[bm_num], false, config.is_hybrid);
+    }
+  }
+  return memory_regions;
+}
+
 }  // namespace
 
 namespace perma {
@@ -35,43 +63,101 @@ bool ParallelBenchmark::run() {
 }
 
 void ParallelBenchmark::create_data_files() {
-  pmem_data_.push_back(create_pmem_data_file(configs_[0], memory_regions_[0]));
-  pmem_data_.push_back(create_pmem_data_file(configs_[1], memory_regions_[1]));
+  char* shared_region_data = nullptr;
+  if (shared_region_) {
+    // The data of the shared region is prepared like the data of the first sub-benchmark.
+    BenchmarkConfig region_config = configs_[0];
+    region_config.memory_range = get_shared_region_size(configs_);
+    shared_region_data = create_pmem_data_file(region_config, memory_regions_[0], region_config.memory_range);
+  }
 
-  dram_data_.push_back(create_dram_data(configs_[0], configs_[0].dram_memory_range));
-  dram_data_.push_back(create_dram_data(configs_[1], configs_[1].dram_memory_range));
+  custom_region_files_.resize(configs_.size());
+  for (size_t bm_num = 0; bm_num < configs_.size(); ++bm_num) {
+    const BenchmarkConfig& config = configs_[bm_num];
+    pmem_data_.push_back(shared_region_ ? shared_region_data + config.region_offset
+                                        : create_pmem_data_file(config, memory_regions_[bm_num], config.memory_range));
+    dram_data_.push_back(create_dram_data(config, config.dram_memory_range));
+    custom_region_data_.push_back(create_custom_region_data(config, &custom_region_files_[bm_num]));
+  }
 }
 
 void ParallelBenchmark::set_up() {
-  pools_.resize(2);
-  thread_configs_.resize(2);
-  single_set_up(configs_[0], pmem_data_[0], dram_data_[0], executions_[0].get(), results_[0].get(), &pools_[0],
-                &thread_configs_[0]);
-  single_set_up(configs_[1], pmem_data_[1], dram_data_[1], executions_[1].get(), results_[1].get(), &pools_[1],
-                &thread_configs_[1]);
+  pools_.resize(configs_.size());
+  thread_configs_.resize(configs_.size());
+  parallel_sync_ = std::make_unique<ParallelSync>();
+  if (shared_region_) {
+    parallel_sync_->count_dirty_line_hits = DirtyLineCounter::is_supported();
+    if (!parallel_sync_->count_dirty_line_hits) {
+      spdlog::warn("Cannot count dirty-line hits in the shared region of {} without HITM perf events.",
+                   benchmark_name_);
+    }
+  }
+  for (size_t bm_num = 0; bm_num < configs_.size(); ++bm_num) {
+    parallel_sync_->threads_remaining += configs_[bm_num].number_threads;
+    executions_[bm_num]->parallel_sync = parallel_sync_.get();
+    single_set_up(configs_[bm_num], pmem_data_[bm_num], dram_data_[bm_num], custom_region_data_[bm_num],
+                  executions_[bm_num].get(), results_[bm_num].get(), &pools_[bm_num], &thread_configs_[bm_num]);
+  }
 }
 
 nlohmann::json ParallelBenchmark::get_result_as_json() {
+  // The overlap begins once the last thread of any sub-benchmark started its measurement.
+  std::chrono::steady_clock::time_point overlap_begin{};
+  for (const std::unique_ptr<BenchmarkResult>& bm_result : results_) {
+    for (const ExecutionDuration& thread_duration : bm_result->total_operation_durations) {
+      overlap_begin = std::max(overlap_begin, thread_duration.begin);
+    }
+  }
+
   nlohmann::json result;
-  result["config"][benchmark_name_one_] = get_json_config(0);
-  result["config"][benchmark_name_two_] = get_json_config(1);
-  result["results"][benchmark_name_one_].update(results_[0]->get_result_as_json());
-  result["results"][benchmark_name_two_].update(results_[1]->get_result_as_json());
+  for (size_t bm_num = 0; bm_num < configs_.size(); ++bm_num) {
+    const std::string& sub_benchmark_name = sub_benchmark_names_[bm_num];
+    result["config"][sub_benchmark_name] = get_json_config(bm_num);
+    result["results"][sub_benchmark_name].update(results_[bm_num]->get_result_as_json());
+    result["results"][sub_benchmark_name]["results"].update(
+        results_[bm_num]->get_overlap_as_json(overlap_begin, parallel_sync_->overlap_end));
+
+    // Without perf events, we cannot tell how often the sub-benchmarks hit each other's modified lines.
+    if (shared_region_) {
+      const std::vector<uint64_t>& dirty_line_hits = results_[bm_num]->dirty_line_hits;
+      result["results"][sub_benchmark_name]["results"]["dirty_line_hits"] =
+          parallel_sync_->count_dirty_line_hits
+              ? nlohmann::json(std::accumulate(dirty_line_hits.begin(), dirty_line_hits.end(), uint64_t{0}))
+              : nlohmann::json(nullptr);
+    }
+  }
   return result;
 }
 
+void ParallelBenchmark::tear_down(const bool force) {
+  // All sub-benchmarks access the same mapping, which the base clean up would unmap per sub-benchmark range.
+  if (shared_region_ && !pmem_data_.empty() && pmem_data_[0] != nullptr) {
+    munmap(pmem_data_[0] - configs_[0].region_offset, get_shared_region_size(configs_));
+    std::fill(pmem_data_.begin(), pmem_data_.end(), nullptr);
+  }
+  Benchmark::tear_down(force);
+}
+
+ParallelBenchmark::ParallelBenchmark(const std::string& benchmark_name, std::vector<std::string> sub_benchmark_names,
+                                     const std::vector<BenchmarkConfig>& configs,
+                                     std::vector<std::unique_ptr<BenchmarkExecution>>&& executions,
+                                     std::vector<std::unique_ptr<BenchmarkResult>>&& results,
+                                     const std::vector<std::filesystem::path>& reused_pmem_files,
+                                     const bool shared_region)
+    : Benchmark(benchmark_name, BenchmarkType::Parallel,
+                create_memory_regions(configs, reused_pmem_files, shared_region), configs, std::move(executions),
+                std::move(results)),
+      sub_benchmark_names_{std::move(sub_benchmark_names)},
+      shared_region_{shared_region} {}
+
 ParallelBenchmark::ParallelBenchmark(const std::string& benchmark_name, std::string first_benchmark_name,
                                      std::string second_benchmark_name, const BenchmarkConfig& first_config,
                                      const BenchmarkConfig& second_config,
                                      std::vector<std::unique_ptr<BenchmarkExecution>>&& executions,
                                      std::vector<std::unique_ptr<BenchmarkResult>>&& results)
-    : Benchmark(benchmark_name, BenchmarkType::Parallel,
-                std::vector<MemoryRegion>{
-                    {utils::generate_random_file_name(first_config.pmem_directory), true, first_config.is_hybrid},
-                    {utils::generate_random_file_name(second_config.pmem_directory), true, second_config.is_hybrid}},
-                std::vector<BenchmarkConfig>{first_config, second_config}, std::move(executions), std::move(results)),
-      benchmark_name_one_{std::move(first_benchmark_name)},
-      benchmark_name_two_{std::move(second_benchmark_name)} {}
+    : ParallelBenchmark(benchmark_name, {std::move(first_benchmark_name), std::move(second_benchmark_name)},
+                        {first_config, second_config}, std::move(executions), std::move(results),
+                        std::vector<std::filesystem::path>(2)) {}
 
 ParallelBenchmark::ParallelBenchmark(const std::string& benchmark_name, std::string first_benchmark_name,
                                      std::string second_benchmark_name, const BenchmarkConfig& first_config,
@@ -79,13 +165,9 @@ ParallelBenchmark::ParallelBenchmark(const std::string& benchmark_name, std::str
                                      std::vector<std::unique_ptr<BenchmarkExecution>>&& executions,
                                      std::vector<std::unique_ptr<BenchmarkResult>>&& results,
                                      std::filesystem::path pmem_file_first)
-    : Benchmark(benchmark_name, BenchmarkType::Parallel,
-                std::vector<MemoryRegion>{
-                    {{std::move(pmem_file_first), false, first_config.is_hybrid},
-                     {utils::generate_random_file_name(second_config.pmem_directory), true, second_config.is_hybrid}}},
-                std::vector<BenchmarkConfig>{first_config, second_config}, std::move(executions), std::move(results)),
-      benchmark_name_one_{std::move(first_benchmark_name)},
-      benchmark_name_two_{std::move(second_benchmark_name)} {}
+    : ParallelBenchmark(benchmark_name, {std::move(first_benchmark_name), std::move(second_benchmark_name)},
+                        {first_config, second_config}, std::move(executions), std::move(results),
+                        {std::move(pmem_file_first), std::filesystem::path{}}) {}
 
 ParallelBenchmark::ParallelBenchmark(const std::string& benchmark_name, std::string first_benchmark_name,
                                      std::string second_benchmark_name, const BenchmarkConfig& first_config,
@@ -93,15 +175,26 @@ ParallelBenchmark::ParallelBenchmark(const std::string& benchmark_name, std::str
                                      std::vector<std::unique_ptr<BenchmarkExecution>>&& executions,
                                      std::vector<std::unique_ptr<BenchmarkResult>>&& results,
                                      std::filesystem::path pmem_file_first, std::filesystem::path pmem_file_second)
-    : Benchmark(benchmark_name, BenchmarkType::Parallel,
-                std::vector<MemoryRegion>{{{std::move(pmem_file_first), false, first_config.is_hybrid},
-                                           {std::move(pmem_file_second), false, second_config.is_hybrid}}},
-                std::vector<BenchmarkConfig>{first_config, second_config}, std::move(executions), std::move(results)),
-      benchmark_name_one_{std::move(first_benchmark_name)},
-      benchmark_name_two_{std::move(second_benchmark_name)} {}
+    : ParallelBenchmark(benchmark_name, {std::move(first_benchmark_name), std::move(second_benchmark_name)},
+                        {first_config, second_config}, std::move(executions), std::move(results),
+                        {std::move(pmem_file_first), std::move(pmem_file_second)}) {}
+
+const std::vector<std::string>& ParallelBenchmark::get_sub_benchmark_names() const { return sub_benchmark_names_; }
+
+const std::string& ParallelBenchmark::get_benchmark_name_one() const { return sub_benchmark_names_[0]; }
 
-const std::string& ParallelBenchmark::get_benchmark_name_one() const { return benchmark_name_one_; }
+const std::string& ParallelBenchmark::get_benchmark_name_two() const { return sub_benchmark_names_[1]; }
 
-const std::string& ParallelBenchmark::get_benchmark_name_two() const { return benchmark_name_two_; }
+size_t ParallelBenchmark::num_sub_benchmarks() const { return configs_.size(); }
+
+bool ParallelBenchmark::has_shared_region() const { return shared_region_; }
+
+uint64_t ParallelBenchmark::get_shared_region_size(const std::vector<BenchmarkConfig>& configs) {
+  uint64_t region_size = 0;
+  for (const BenchmarkConfig& config : configs) {
+    region_size = std::max(region_size, config.region_offset + config.memory_range);
+  }
+  return region_size;
+}
 
 }  // namespace perma
@@ -6,8 +6,29 @@
 
 namespace perma {
 
+/**
+ * Runs two or more sub-benchmarks at the same time, e.g., log writers, index updaters, and scanners of a database.
+ * Each sub-benchmark has its own config, data, and threads. All threads start their measurement together. Besides the
+ * full results, each sub-benchmark reports its results while all sub-benchmarks executed and in its solo tail after
+ * the first thread finished.
+ *
+ * With a shared region, all sub-benchmarks access the same PMem data instead of their own, each at the `region_offset`
+ * of its config. Their ranges may overlap fully or in parts, e.g., so that readers hit lines that writers just
+ * modified. The DRAM data and the named custom regions are not shared.
+ */
 class ParallelBenchmark : public Benchmark {
  public:
+  /**
+   * Constructor for any number of sub-benchmarks. Each sub-benchmark with a non-empty entry in `reused_pmem_files`
+   * reuses this existing file, e.g., read-only benchmarks in a matrix. All others get their own file. With
+   * `shared_region`, all sub-benchmarks share a new file instead.
+   */
+  ParallelBenchmark(const std::string& benchmark_name, std::vector<std::string> sub_benchmark_names,
+                    const std::vector<BenchmarkConfig>& configs,
+                    std::vector<std::unique_ptr<BenchmarkExecution>>&& executions,
+                    std::vector<std::unique_ptr<BenchmarkResult>>&& results,
+                    const std::vector<std::filesystem::path>& reused_pmem_files, bool shared_region = false);
+
   /**
    * Constructor for two writing benchmarks, i.e., no reusage of existing files.
    */
@@ -50,20 +71,33 @@ class ParallelBenchmark : public Benchmark {
    */
   void create_data_files() override;
 
-  /** Create all the IO addresses ahead of time to avoid unnecessary ops during the actual benchmark. */
+  /**
+   * Create all the IO addresses ahead of time to avoid unnecessary ops during the actual benchmark. This also connects
+   * all sub-benchmarks to the shared start barrier.
+   */
   void set_up() override;
 
   /** Return the results as a JSON to be exported to the user and visualization. */
   nlohmann::json get_result_as_json() override;
 
+  /** Unmaps the shared region once before the regular clean up. */
+  void tear_down(bool force) override;
+
+  const std::vector<std::string>& get_sub_benchmark_names() const;
   const std::string& get_benchmark_name_one() const;
   const std::string& get_benchmark_name_two() const;
+  size_t num_sub_benchmarks() const;
+  bool has_shared_region() const;
+
+  // Size of the shared region, which contains the ranges of all sub-benchmarks at their `region_offset`.
+  static uint64_t get_shared_region_size(const std::vector<BenchmarkConfig>& configs);
 
   ~ParallelBenchmark() { ParallelBenchmark::tear_down(false); }
 
  private:
-  const std::string benchmark_name_one_;
-  const std::string benchmark_name_two_;
+  const std::vector<std::string> sub_benchmark_names_;
+  const bool shared_region_;
+  std::unique_ptr<ParallelSync> parallel_sync_;
 };
 
 }  // namespace perma
@@ -0,0 +1,61 @@
+#include "phased_benchmark.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+namespace perma {
+
+bool PhasedBenchmark::run() {
+  return run_steps([&](const size_t phase) {
+    spdlog::debug("Finished phase {}/{}: {}.", phase + 1, num_phases(), phase_names_[phase]);
+  });
+}
+
+void PhasedBenchmark::create_data_files() {
+  // The data is created once for all phases. If a phase reads, the data is generated like for a read benchmark, even
+  // if earlier phases only write, so that no phase reads untouched pages.
+  const auto reading_phase = std::find_if(configs_.begin(), configs_.end(),
+                                          [](const BenchmarkConfig& config) { return config.contains_read_op(); });
+  const BenchmarkConfig& data_config = reading_phase != configs_.end() ? *reading_phase : configs_[0];
+
+  pmem_data_.push_back(create_pmem_data_file(data_config, memory_regions_[0], data_config.memory_range));
+  dram_data_.push_back(create_dram_data(data_config, data_config.dram_memory_range));
+
+  custom_region_files_.resize(1);
+  custom_region_data_.push_back(create_custom_region_data(data_config, &custom_region_files_[0]));
+}
+
+void PhasedBenchmark::set_up() { set_up_steps(1); }
+
+nlohmann::json PhasedBenchmark::get_result_as_json() {
+  nlohmann::json phases = nlohmann::json::array();
+  for (size_t phase = 0; phase < num_phases(); ++phase) {
+    nlohmann::json phase_result;
+    phase_result["name"] = phase_names_[phase];
+    phase_result["config"] = get_json_config(phase);
+    phase_result.update(results_[phase]->get_result_as_json());
+    phases.emplace_back(std::move(phase_result));
+  }
+
+  nlohmann::json result;
+  result["config"]["phases"] = phase_names_;
+  result["results"]["phases"] = phases;
+  return result;
+}
+
+PhasedBenchmark::PhasedBenchmark(const std::string& benchmark_name, std::vector<std::string> phase_names,
+                                 const std::vector<BenchmarkConfig>& phase_configs,
+                                 std::vector<std::unique_ptr<BenchmarkExecution>>&& executions,
+                                 std::vector<std::unique_ptr<BenchmarkResult>>&& results)
+    : Benchmark(benchmark_name, BenchmarkType::Phased,
+                std::vector<MemoryRegion>{{utils::generate_random_file_name(phase_configs[0].pmem_directory), true,
+                                           phase_configs[0].is_hybrid}},
+                phase_configs, std::move(executions), std::move(results)),
+      phase_names_{std::move(phase_names)} {}
+
+const std::vector<std::string>& PhasedBenchmark::get_phase_names() const { return phase_names_; }
+
+size_t PhasedBenchmark::num_phases() const { return configs_.size(); }
+
+}  // namespace perma
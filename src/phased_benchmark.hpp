@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+
+#include "benchmark.hpp"
+
+namespace perma {
+
+/**
+ * Runs a sequence of phases with different access patterns on the same data, e.g., a load phase of sequential writes,
+ * a steady phase of random mixed accesses, and a scan phase, to age the data like a database does. The memory region
+ * is only created and filled once and is not re-initialized between the phases, so each phase sees the data that the
+ * previous phases left behind. The result contains the results of each phase.
+ */
+class PhasedBenchmark : public Benchmark {
+ public:
+  /** The configs hold one entry per phase, which all access the same memory ranges. */
+  PhasedBenchmark(const std::string& benchmark_name, std::vector<std::string> phase_names,
+                  const std::vector<BenchmarkConfig>& phase_configs,
+                  std::vector<std::unique_ptr<BenchmarkExecution>>&& executions,
+                  std::vector<std::unique_ptr<BenchmarkResult>>&& results);
+
+  PhasedBenchmark(PhasedBenchmark&& other) = default;
+  PhasedBenchmark(const PhasedBenchmark& other) = delete;
+  PhasedBenchmark& operator=(const PhasedBenchmark& other) = delete;
+  PhasedBenchmark& operator=(PhasedBenchmark&& other) = delete;
+
+  /** Main run method which executes the benchmark. `setup()` should be called before this. */
+  bool run() override;
+
+  /** Generates the data needed for the benchmark. All phases share the same data. */
+  void create_data_files() override;
+
+  /** Create all the IO addresses ahead of time to avoid unnecessary ops during the actual benchmark. */
+  void set_up() override;
+
+  /** Return the results as a JSON to be exported to the user and visualization. */
+  nlohmann::json get_result_as_json() override;
+
+  const std::vector<std::string>& get_phase_names() const;
+  size_t num_phases() const;
+
+  ~PhasedBenchmark() { PhasedBenchmark::tear_down(false); }
+
+ private:
+  const std::vector<std::string> phase_names_;
+};
+
+}  // namespace perma
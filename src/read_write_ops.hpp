@@ -3,6 +3,7 @@
 #include <immintrin.h>
 #include <xmmintrin.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <vector>
@@ -22,6 +23,13 @@ namespace perma::rw_ops {
 #define WRITE_SIMD_512(mem_addr, offset, data) \
   _mm512_store_si512(reinterpret_cast<__m512i*>((mem_addr) + ((offset)*CACHE_LINE_SIZE)), data)
 
+#define READ_SIMD_NT_512(mem_addr, offset) _mm512_stream_load_si512((void*)((mem_addr) + ((offset)*CACHE_LINE_SIZE)))
+
+#define READ_SIMD_512_UNALIGNED(mem_addr, offset) _mm512_loadu_si512((void*)((mem_addr) + ((offset)*CACHE_LINE_SIZE)))
+
+#define WRITE_SIMD_512_UNALIGNED(mem_addr, offset, data) \
+  _mm512_storeu_si512(reinterpret_cast<__m512i*>((mem_addr) + ((offset)*CACHE_LINE_SIZE)), data)
+
 // Exactly 64 characters to write in one cache line.
 static const char WRITE_DATA[] __attribute__((aligned(64))) =
     "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+-";
@@ -33,11 +41,23 @@ static constexpr size_t CACHE_LINE_SIZE = 64;
 typedef void flush_fn(char*, const size_t);
 typedef void barrier_fn();
 
+/** Aligned accesses with a power-of-two size can use the unrolled kernels. All others use the masked kernels. */
+inline bool is_aligned_access(const char* addr, const size_t access_size) {
+  const bool is_power_of_two = (access_size & (access_size - 1)) == 0;
+  const bool is_cache_line_aligned = (reinterpret_cast<uintptr_t>(addr) % CACHE_LINE_SIZE) == 0;
+  return is_power_of_two && access_size >= CACHE_LINE_SIZE && is_cache_line_aligned;
+}
+
+/** Align an address down to the start of its cache line. */
+inline char* cache_line_start(char* addr) {
+  return reinterpret_cast<char*>(reinterpret_cast<uintptr_t>(addr) & ~(CACHE_LINE_SIZE - 1));
+}
+
 /** flush the cache line using clwb. */
 #ifdef HAS_CLWB
 inline void flush_clwb(char* addr, const size_t len) {
   const char* end_addr = addr + len;
-  for (char* current_cl = addr; current_cl < end_addr; current_cl += CACHE_LINE_SIZE) {
+  for (char* current_cl = cache_line_start(addr); current_cl < end_addr; current_cl += CACHE_LINE_SIZE) {
     _mm_clwb(current_cl);
   }
 }
@@ -47,7 +67,7 @@ inline void flush_clwb(char* addr, const size_t len) {
 #ifdef HAS_CLFLUSHOPT
 inline void flush_clflushopt(char* addr, const size_t len) {
   const char* end_addr = addr + len;
-  for (char* current_cl = addr; current_cl < end_addr; current_cl += CACHE_LINE_SIZE) {
+  for (char* current_cl = cache_line_start(addr); current_cl < end_addr; current_cl += CACHE_LINE_SIZE) {
     _mm_clflushopt(current_cl);
   }
 }
@@ -56,6 +76,55 @@ inline void flush_clflushopt(char* addr, const size_t len) {
 /** no explicit cache line flush is used. */
 inline void no_flush(char* addr, const size_t len) {}
 
+/** flush partially written cache lines of non-temporal writes with the best available instruction. */
+inline void flush_partial_line(char* addr, const size_t len) {
+#if defined(HAS_CLWB)
+  flush_clwb(addr, len);
+#elif defined(HAS_CLFLUSHOPT)
+  flush_clflushopt(addr, len);
+#endif
+}
+
+/** Prefetch all cache lines of the range into all cache levels. */
+inline void prefetch_t0(char* addr, const size_t len) {
+  const char* end_addr = addr + len;
+  for (char* current_cl = cache_line_start(addr); current_cl < end_addr; current_cl += CACHE_LINE_SIZE) {
+    _mm_prefetch(current_cl, _MM_HINT_T0);
+  }
+}
+
+/** Prefetch all cache lines of the range with minimal cache pollution, i.e., as non-temporal data. */
+inline void prefetch_nta(char* addr, const size_t len) {
+  const char* end_addr = addr + len;
+  for (char* current_cl = cache_line_start(addr); current_cl < end_addr; current_cl += CACHE_LINE_SIZE) {
+    _mm_prefetch(current_cl, _MM_HINT_NTA);
+  }
+}
+
+/** Evicts all cache lines of the range from all cache levels, writing back modified lines. */
+inline void evict_range(char* addr, const size_t len) {
+#ifdef HAS_CLFLUSHOPT
+  flush_clflushopt(addr, len);
+#else
+  const char* end_addr = addr + len;
+  for (char* current_cl = cache_line_start(addr); current_cl < end_addr; current_cl += CACHE_LINE_SIZE) {
+    _mm_clflush(current_cl);
+  }
+#endif
+  // clflushopt is only ordered by a fence, so the range is not guaranteed to be evicted before it.
+  _mm_sfence();
+}
+
+/** Loads each cache line of the range once, so that as much of the range as fits is cached afterwards. */
+inline void touch_range(char* addr, const size_t len) {
+  const char* end_addr = addr + len;
+  uint64_t sum = 0;
+  for (char* current_cl = cache_line_start(addr); current_cl < end_addr; current_cl += CACHE_LINE_SIZE) {
+    sum += *reinterpret_cast<volatile char*>(current_cl);
+  }
+  KEEP(&sum);
+}
+
 /** Use sfence to guarantee memory order on x86. Earlier store operations cannot be reordered beyond this point. */
 inline void sfence_barrier() { _mm_sfence(); }
 
@@ -285,6 +354,46 @@ inline void simd_write_none(const std::vector<char*>& addresses, const size_t ac
   simd_write(addresses, access_size, no_flush, no_barrier);
 }
 
+/**
+ * #####################################################
+ * STORE + FENCE OPERATIONS
+ * #####################################################
+ *
+ * With eADR, the caches are part of the persistence domain, so writes only need to be ordered but not flushed.
+ */
+
+inline void simd_write_fence_512(char* addr) { simd_write_512(addr, no_flush, sfence_barrier); }
+
+inline void simd_write_fence_256(char* addr) { simd_write_256(addr, no_flush, sfence_barrier); }
+
+inline void simd_write_fence_128(char* addr) { simd_write_128(addr, no_flush, sfence_barrier); }
+
+inline void simd_write_fence_64(char* addr) { simd_write_64(addr, no_flush, sfence_barrier); }
+
+inline void simd_write_fence(char* addr, const size_t access_size) {
+  simd_write(addr, access_size, no_flush, sfence_barrier);
+}
+
+inline void simd_write_fence_512(const std::vector<char*>& addresses) {
+  simd_write_512(addresses, no_flush, sfence_barrier);
+}
+
+inline void simd_write_fence_256(const std::vector<char*>& addresses) {
+  simd_write_256(addresses, no_flush, sfence_barrier);
+}
+
+inline void simd_write_fence_128(const std::vector<char*>& addresses) {
+  simd_write_128(addresses, no_flush, sfence_barrier);
+}
+
+inline void simd_write_fence_64(const std::vector<char*>& addresses) {
+  simd_write_64(addresses, no_flush, sfence_barrier);
+}
+
+inline void simd_write_fence(const std::vector<char*>& addresses, const size_t access_size) {
+  simd_write(addresses, access_size, no_flush, sfence_barrier);
+}
+
 /**
  * #####################################################
  * NON_TEMPORAL STORE OPERATIONS
@@ -418,14 +527,14 @@ inline __m512i simd_read(char* addr, const size_t access_size) {
   __m512i res0, res1, res2, res3, res4, res5, res6, res7;
   const char* access_end_addr = addr + access_size;
   for (const char* mem_addr = addr; mem_addr < access_end_addr; mem_addr += (8 * CACHE_LINE_SIZE)) {
-    res0 = READ_SIMD_512(addr, 0);
-    res1 = READ_SIMD_512(addr, 1);
-    res2 = READ_SIMD_512(addr, 2);
-    res3 = READ_SIMD_512(addr, 3);
-    res4 = READ_SIMD_512(addr, 4);
-    res5 = READ_SIMD_512(addr, 5);
-    res6 = READ_SIMD_512(addr, 6);
-    res7 = READ_SIMD_512(addr, 7);
+    res0 = READ_SIMD_512(mem_addr, 0);
+    res1 = READ_SIMD_512(mem_addr, 1);
+    res2 = READ_SIMD_512(mem_addr, 2);
+    res3 = READ_SIMD_512(mem_addr, 3);
+    res4 = READ_SIMD_512(mem_addr, 4);
+    res5 = READ_SIMD_512(mem_addr, 5);
+    res6 = READ_SIMD_512(mem_addr, 6);
+    res7 = READ_SIMD_512(mem_addr, 7);
   }
   return res0 + res1 + res2 + res3 + res4 + res5 + res6 + res7;
 }
@@ -525,6 +634,896 @@ inline void simd_read(const std::vector<char*>& addresses, const size_t access_s
   KEEP(&x);
 }
 
+/**
+ * #####################################################
+ * NON-TEMPORAL (STREAMING) READ OPERATIONS
+ * #####################################################
+ *
+ * These use streaming loads (movntdqa), which require cache line-aligned addresses. Depending on the CPU and the
+ * memory type, they can bypass the caches and avoid polluting them during scans.
+ */
+
+inline __m512i simd_read_nt_64(char* addr) { return READ_SIMD_NT_512(addr, 0); }
+
+inline __m512i simd_read_nt_128(char* addr) {
+  __m512i res0, res1;
+  res0 = READ_SIMD_NT_512(addr, 0);
+  res1 = READ_SIMD_NT_512(addr, 1);
+  return res0 + res1;
+}
+
+inline __m512i simd_read_nt_256(char* addr) {
+  __m512i res0, res1, res2, res3;
+  res0 = READ_SIMD_NT_512(addr, 0);
+  res1 = READ_SIMD_NT_512(addr, 1);
+  res2 = READ_SIMD_NT_512(addr, 2);
+  res3 = READ_SIMD_NT_512(addr, 3);
+  return res0 + res1 + res2 + res3;
+}
+
+inline __m512i simd_read_nt_512(char* addr) {
+  __m512i res0, res1, res2, res3, res4, res5, res6, res7;
+  res0 = READ_SIMD_NT_512(addr, 0);
+  res1 = READ_SIMD_NT_512(addr, 1);
+  res2 = READ_SIMD_NT_512(addr, 2);
+  res3 = READ_SIMD_NT_512(addr, 3);
+  res4 = READ_SIMD_NT_512(addr, 4);
+  res5 = READ_SIMD_NT_512(addr, 5);
+  res6 = READ_SIMD_NT_512(addr, 6);
+  res7 = READ_SIMD_NT_512(addr, 7);
+  return res0 + res1 + res2 + res3 + res4 + res5 + res6 + res7;
+}
+
+inline __m512i simd_read_nt(char* addr, const size_t access_size) {
+  __m512i res0, res1, res2, res3, res4, res5, res6, res7;
+  const char* access_end_addr = addr + access_size;
+  for (const char* mem_addr = addr; mem_addr < access_end_addr; mem_addr += (8 * CACHE_LINE_SIZE)) {
+    res0 = READ_SIMD_NT_512(mem_addr, 0);
+    res1 = READ_SIMD_NT_512(mem_addr, 1);
+    res2 = READ_SIMD_NT_512(mem_addr, 2);
+    res3 = READ_SIMD_NT_512(mem_addr, 3);
+    res4 = READ_SIMD_NT_512(mem_addr, 4);
+    res5 = READ_SIMD_NT_512(mem_addr, 5);
+    res6 = READ_SIMD_NT_512(mem_addr, 6);
+    res7 = READ_SIMD_NT_512(mem_addr, 7);
+  }
+  return res0 + res1 + res2 + res3 + res4 + res5 + res6 + res7;
+}
+
+inline void simd_read_nt_64(const std::vector<char*>& addresses) {
+  __m512i res;
+  auto simd_fn = [&]() {
+    for (char* addr : addresses) {
+      res = simd_read_nt_64(addr);
+    }
+    return res;
+  };
+  // Do a single copy of the last read value to the stack from a zmm register. See `simd_read_64` for details.
+  __m512i x = simd_fn();
+  KEEP(&x);
+}
+
+inline void simd_read_nt_128(const std::vector<char*>& addresses) {
+  __m512i res;
+  auto simd_fn = [&]() {
+    for (char* addr : addresses) {
+      res = simd_read_nt_128(addr);
+    }
+    return res;
+  };
+  __m512i x = simd_fn();
+  KEEP(&x);
+}
+
+inline void simd_read_nt_256(const std::vector<char*>& addresses) {
+  __m512i res;
+  auto simd_fn = [&]() {
+    for (char* addr : addresses) {
+      res = simd_read_nt_256(addr);
+    }
+    return res;
+  };
+  __m512i x = simd_fn();
+  KEEP(&x);
+}
+
+inline void simd_read_nt_512(const std::vector<char*>& addresses) {
+  __m512i res;
+  auto simd_fn = [&]() {
+    for (char* addr : addresses) {
+      res = simd_read_nt_512(addr);
+    }
+    return res;
+  };
+  __m512i x = simd_fn();
+  KEEP(&x);
+}
+
+inline void simd_read_nt(const std::vector<char*>& addresses, const size_t access_size) {
+  __m512i res;
+  auto simd_fn = [&]() {
+    for (char* addr : addresses) {
+      res = simd_read_nt(addr, access_size);
+    }
+    return res;
+  };
+  __m512i x = simd_fn();
+  KEEP(&x);
+}
+
+/**
+ * #####################################################
+ * READ-MODIFY-WRITE OPERATIONS
+ * #####################################################
+ *
+ * These operations load each cache line, increment all of its 64 Bit words, and write it back to the same address,
+ * e.g., for counter updates or row-status flips. As each store depends on its load, the loads cannot be optimized
+ * away and we do not need to KEEP any value. All loads of an access are issued before its stores.
+ */
+
+#define MODIFY_SIMD_512(value) _mm512_add_epi64(value, _mm512_set1_epi64(1))
+
+inline void simd_rmw_64(char* addr, flush_fn flush, barrier_fn barrier) {
+  // Read, modify, and write 512 Bit (64 Byte)
+  const __m512i res0 = READ_SIMD_512(addr, 0);
+  WRITE_SIMD_512(addr, 0, MODIFY_SIMD_512(res0));
+  flush(addr, 64);
+  barrier();
+}
+
+inline void simd_rmw_128(char* addr, flush_fn flush, barrier_fn barrier) {
+  // Read, modify, and write 128 Byte
+  const __m512i res0 = READ_SIMD_512(addr, 0);
+  const __m512i res1 = READ_SIMD_512(addr, 1);
+  WRITE_SIMD_512(addr, 0, MODIFY_SIMD_512(res0));
+  WRITE_SIMD_512(addr, 1, MODIFY_SIMD_512(res1));
+  flush(addr, 128);
+  barrier();
+}
+
+inline void simd_rmw_256(char* addr, flush_fn flush, barrier_fn barrier) {
+  // Read, modify, and write 256 Byte
+  const __m512i res0 = READ_SIMD_512(addr, 0);
+  const __m512i res1 = READ_SIMD_512(addr, 1);
+  const __m512i res2 = READ_SIMD_512(addr, 2);
+  const __m512i res3 = READ_SIMD_512(addr, 3);
+  WRITE_SIMD_512(addr, 0, MODIFY_SIMD_512(res0));
+  WRITE_SIMD_512(addr, 1, MODIFY_SIMD_512(res1));
+  WRITE_SIMD_512(addr, 2, MODIFY_SIMD_512(res2));
+  WRITE_SIMD_512(addr, 3, MODIFY_SIMD_512(res3));
+  flush(addr, 256);
+  barrier();
+}
+
+inline void simd_rmw_8_lines(char* addr) {
+  const __m512i res0 = READ_SIMD_512(addr, 0);
+  const __m512i res1 = READ_SIMD_512(addr, 1);
+  const __m512i res2 = READ_SIMD_512(addr, 2);
+  const __m512i res3 = READ_SIMD_512(addr, 3);
+  const __m512i res4 = READ_SIMD_512(addr, 4);
+  const __m512i res5 = READ_SIMD_512(addr, 5);
+  const __m512i res6 = READ_SIMD_512(addr, 6);
+  const __m512i res7 = READ_SIMD_512(addr, 7);
+  WRITE_SIMD_512(addr, 0, MODIFY_SIMD_512(res0));
+  WRITE_SIMD_512(addr, 1, MODIFY_SIMD_512(res1));
+  WRITE_SIMD_512(addr, 2, MODIFY_SIMD_512(res2));
+  WRITE_SIMD_512(addr, 3, MODIFY_SIMD_512(res3));
+  WRITE_SIMD_512(addr, 4, MODIFY_SIMD_512(res4));
+  WRITE_SIMD_512(addr, 5, MODIFY_SIMD_512(res5));
+  WRITE_SIMD_512(addr, 6, MODIFY_SIMD_512(res6));
+  WRITE_SIMD_512(addr, 7, MODIFY_SIMD_512(res7));
+}
+
+inline void simd_rmw_512(char* addr, flush_fn flush, barrier_fn barrier) {
+  // Read, modify, and write 512 Byte
+  simd_rmw_8_lines(addr);
+  flush(addr, 512);
+  barrier();
+}
+
+inline void simd_rmw(char* addr, const size_t access_size, flush_fn flush, barrier_fn barrier) {
+  const char* access_end_addr = addr + access_size;
+  for (char* mem_addr = addr; mem_addr < access_end_addr; mem_addr += (8 * CACHE_LINE_SIZE)) {
+    // Read, modify, and write 512 Byte
+    simd_rmw_8_lines(mem_addr);
+  }
+  flush(addr, access_size);
+  barrier();
+}
+
+inline void simd_rmw_64(const std::vector<char*>& addresses, flush_fn flush, barrier_fn barrier) {
+  for (char* addr : addresses) {
+    simd_rmw_64(addr, flush, barrier);
+  }
+}
+
+inline void simd_rmw_128(const std::vector<char*>& addresses, flush_fn flush, barrier_fn barrier) {
+  for (char* addr : addresses) {
+    simd_rmw_128(addr, flush, barrier);
+  }
+}
+
+inline void simd_rmw_256(const std::vector<char*>& addresses, flush_fn flush, barrier_fn barrier) {
+  for (char* addr : addresses) {
+    simd_rmw_256(addr, flush, barrier);
+  }
+}
+
+inline void simd_rmw_512(const std::vector<char*>& addresses, flush_fn flush, barrier_fn barrier) {
+  for (char* addr : addresses) {
+    simd_rmw_512(addr, flush, barrier);
+  }
+}
+
+inline void simd_rmw(const std::vector<char*>& addresses, const size_t access_size, flush_fn flush,
+                     barrier_fn barrier) {
+  for (char* addr : addresses) {
+    simd_rmw(addr, access_size, flush, barrier);
+  }
+}
+
+#ifdef HAS_CLWB
+inline void simd_rmw_clwb_512(char* addr) { simd_rmw_512(addr, flush_clwb, sfence_barrier); }
+
+inline void simd_rmw_clwb_256(char* addr) { simd_rmw_256(addr, flush_clwb, sfence_barrier); }
+
+inline void simd_rmw_clwb_128(char* addr) { simd_rmw_128(addr, flush_clwb, sfence_barrier); }
+
+inline void simd_rmw_clwb_64(char* addr) { simd_rmw_64(addr, flush_clwb, sfence_barrier); }
+
+inline void simd_rmw_clwb(char* addr, const size_t access_size) {
+  simd_rmw(addr, access_size, flush_clwb, sfence_barrier);
+}
+
+inline void simd_rmw_clwb_512(const std::vector<char*>& addresses) {
+  simd_rmw_512(addresses, flush_clwb, sfence_barrier);
+}
+
+inline void simd_rmw_clwb_256(const std::vector<char*>& addresses) {
+  simd_rmw_256(addresses, flush_clwb, sfence_barrier);
+}
+
+inline void simd_rmw_clwb_128(const std::vector<char*>& addresses) {
+  simd_rmw_128(addresses, flush_clwb, sfence_barrier);
+}
+
+inline void simd_rmw_clwb_64(const std::vector<char*>& addresses) {
+  simd_rmw_64(addresses, flush_clwb, sfence_barrier);
+}
+
+inline void simd_rmw_clwb(const std::vector<char*>& addresses, const size_t access_size) {
+  simd_rmw(addresses, access_size, flush_clwb, sfence_barrier);
+}
+#endif
+
+#ifdef HAS_CLFLUSHOPT
+inline void simd_rmw_clflushopt_512(char* addr) { simd_rmw_512(addr, flush_clflushopt, sfence_barrier); }
+
+inline void simd_rmw_clflushopt_256(char* addr) { simd_rmw_256(addr, flush_clflushopt, sfence_barrier); }
+
+inline void simd_rmw_clflushopt_128(char* addr) { simd_rmw_128(addr, flush_clflushopt, sfence_barrier); }
+
+inline void simd_rmw_clflushopt_64(char* addr) { simd_rmw_64(addr, flush_clflushopt, sfence_barrier); }
+
+inline void simd_rmw_clflushopt(char* addr, const size_t access_size) {
+  simd_rmw(addr, access_size, flush_clflushopt, sfence_barrier);
+}
+
+inline void simd_rmw_clflushopt_512(const std::vector<char*>& addresses) {
+  simd_rmw_512(addresses, flush_clflushopt, sfence_barrier);
+}
+
+inline void simd_rmw_clflushopt_256(const std::vector<char*>& addresses) {
+  simd_rmw_256(addresses, flush_clflushopt, sfence_barrier);
+}
+
+inline void simd_rmw_clflushopt_128(const std::vector<char*>& addresses) {
+  simd_rmw_128(addresses, flush_clflushopt, sfence_barrier);
+}
+
+inline void simd_rmw_clflushopt_64(const std::vector<char*>& addresses) {
+  simd_rmw_64(addresses, flush_clflushopt, sfence_barrier);
+}
+
+inline void simd_rmw_clflushopt(const std::vector<char*>& addresses, const size_t access_size) {
+  simd_rmw(addresses, access_size, flush_clflushopt, sfence_barrier);
+}
+#endif
+
+inline void simd_rmw_none_512(char* addr) { simd_rmw_512(addr, no_flush, no_barrier); }
+
+inline void simd_rmw_none_256(char* addr) { simd_rmw_256(addr, no_flush, no_barrier); }
+
+inline void simd_rmw_none_128(char* addr) { simd_rmw_128(addr, no_flush, no_barrier); }
+
+inline void simd_rmw_none_64(char* addr) { simd_rmw_64(addr, no_flush, no_barrier); }
+
+inline void simd_rmw_none(char* addr, const size_t access_size) { simd_rmw(addr, access_size, no_flush, no_barrier); }
+
+inline void simd_rmw_none_512(const std::vector<char*>& addresses) { simd_rmw_512(addresses, no_flush, no_barrier); }
+
+inline void simd_rmw_none_256(const std::vector<char*>& addresses) { simd_rmw_256(addresses, no_flush, no_barrier); }
+
+inline void simd_rmw_none_128(const std::vector<char*>& addresses) { simd_rmw_128(addresses, no_flush, no_barrier); }
+
+inline void simd_rmw_none_64(const std::vector<char*>& addresses) { simd_rmw_64(addresses, no_flush, no_barrier); }
+
+inline void simd_rmw_none(const std::vector<char*>& addresses, const size_t access_size) {
+  simd_rmw(addresses, access_size, no_flush, no_barrier);
+}
+
+inline void simd_rmw_fence_512(char* addr) { simd_rmw_512(addr, no_flush, sfence_barrier); }
+
+inline void simd_rmw_fence_256(char* addr) { simd_rmw_256(addr, no_flush, sfence_barrier); }
+
+inline void simd_rmw_fence_128(char* addr) { simd_rmw_128(addr, no_flush, sfence_barrier); }
+
+inline void simd_rmw_fence_64(char* addr) { simd_rmw_64(addr, no_flush, sfence_barrier); }
+
+inline void simd_rmw_fence(char* addr, const size_t access_size) {
+  simd_rmw(addr, access_size, no_flush, sfence_barrier);
+}
+
+inline void simd_rmw_fence_512(const std::vector<char*>& addresses) {
+  simd_rmw_512(addresses, no_flush, sfence_barrier);
+}
+
+inline void simd_rmw_fence_256(const std::vector<char*>& addresses) {
+  simd_rmw_256(addresses, no_flush, sfence_barrier);
+}
+
+inline void simd_rmw_fence_128(const std::vector<char*>& addresses) {
+  simd_rmw_128(addresses, no_flush, sfence_barrier);
+}
+
+inline void simd_rmw_fence_64(const std::vector<char*>& addresses) { simd_rmw_64(addresses, no_flush, sfence_barrier); }
+
+inline void simd_rmw_fence(const std::vector<char*>& addresses, const size_t access_size) {
+  simd_rmw(addresses, access_size, no_flush, sfence_barrier);
+}
+
+inline void simd_rmw_nt_8_lines(char* addr) {
+  const __m512i res0 = READ_SIMD_512(addr, 0);
+  const __m512i res1 = READ_SIMD_512(addr, 1);
+  const __m512i res2 = READ_SIMD_512(addr, 2);
+  const __m512i res3 = READ_SIMD_512(addr, 3);
+  const __m512i res4 = READ_SIMD_512(addr, 4);
+  const __m512i res5 = READ_SIMD_512(addr, 5);
+  const __m512i res6 = READ_SIMD_512(addr, 6);
+  const __m512i res7 = READ_SIMD_512(addr, 7);
+  WRITE_SIMD_NT_512(addr, 0, MODIFY_SIMD_512(res0));
+  WRITE_SIMD_NT_512(addr, 1, MODIFY_SIMD_512(res1));
+  WRITE_SIMD_NT_512(addr, 2, MODIFY_SIMD_512(res2));
+  WRITE_SIMD_NT_512(addr, 3, MODIFY_SIMD_512(res3));
+  WRITE_SIMD_NT_512(addr, 4, MODIFY_SIMD_512(res4));
+  WRITE_SIMD_NT_512(addr, 5, MODIFY_SIMD_512(res5));
+  WRITE_SIMD_NT_512(addr, 6, MODIFY_SIMD_512(res6));
+  WRITE_SIMD_NT_512(addr, 7, MODIFY_SIMD_512(res7));
+}
+
+inline void simd_rmw_nt_64(char* addr) {
+  // Read, modify, and write 512 Bit (64 Byte)
+  const __m512i res0 = READ_SIMD_512(addr, 0);
+  WRITE_SIMD_NT_512(addr, 0, MODIFY_SIMD_512(res0));
+  sfence_barrier();
+}
+
+inline void simd_rmw_nt_128(char* addr) {
+  // Read, modify, and write 128 Byte
+  const __m512i res0 = READ_SIMD_512(addr, 0);
+  const __m512i res1 = READ_SIMD_512(addr, 1);
+  WRITE_SIMD_NT_512(addr, 0, MODIFY_SIMD_512(res0));
+  WRITE_SIMD_NT_512(addr, 1, MODIFY_SIMD_512(res1));
+  sfence_barrier();
+}
+
+inline void simd_rmw_nt_256(char* addr) {
+  // Read, modify, and write 256 Byte
+  const __m512i res0 = READ_SIMD_512(addr, 0);
+  const __m512i res1 = READ_SIMD_512(addr, 1);
+  const __m512i res2 = READ_SIMD_512(addr, 2);
+  const __m512i res3 = READ_SIMD_512(addr, 3);
+  WRITE_SIMD_NT_512(addr, 0, MODIFY_SIMD_512(res0));
+  WRITE_SIMD_NT_512(addr, 1, MODIFY_SIMD_512(res1));
+  WRITE_SIMD_NT_512(addr, 2, MODIFY_SIMD_512(res2));
+  WRITE_SIMD_NT_512(addr, 3, MODIFY_SIMD_512(res3));
+  sfence_barrier();
+}
+
+inline void simd_rmw_nt_512(char* addr) {
+  // Read, modify, and write 512 Byte
+  simd_rmw_nt_8_lines(addr);
+  sfence_barrier();
+}
+
+inline void simd_rmw_nt(char* addr, const size_t access_size) {
+  const char* access_end_addr = addr + access_size;
+  for (char* mem_addr = addr; mem_addr < access_end_addr; mem_addr += (8 * CACHE_LINE_SIZE)) {
+    // Read, modify, and write 512 Byte
+    simd_rmw_nt_8_lines(mem_addr);
+  }
+  sfence_barrier();
+}
+
+inline void simd_rmw_nt_64(const std::vector<char*>& addresses) {
+  for (char* addr : addresses) {
+    simd_rmw_nt_64(addr);
+  }
+}
+
+inline void simd_rmw_nt_128(const std::vector<char*>& addresses) {
+  for (char* addr : addresses) {
+    simd_rmw_nt_128(addr);
+  }
+}
+
+inline void simd_rmw_nt_256(const std::vector<char*>& addresses) {
+  for (char* addr : addresses) {
+    simd_rmw_nt_256(addr);
+  }
+}
+
+inline void simd_rmw_nt_512(const std::vector<char*>& addresses) {
+  for (char* addr : addresses) {
+    simd_rmw_nt_512(addr);
+  }
+}
+
+inline void simd_rmw_nt(const std::vector<char*>& addresses, const size_t access_size) {
+  for (char* addr : addresses) {
+    simd_rmw_nt(addr, access_size);
+  }
+}
+
+/**
+ * #####################################################
+ * ARBITRARY-SIZED AND UNALIGNED OPERATIONS
+ * #####################################################
+ *
+ * These operations support access sizes that are not a power of two and start addresses that are not cache line
+ * aligned, e.g., 100 Byte records that straddle cache lines. All full 64 Byte blocks are accessed with unaligned
+ * loads/stores and the remaining tail of the access is accessed with a masked load/store, so that we never touch
+ * any byte outside of the access.
+ */
+
+/** Returns the byte mask for a partial 64 Byte access of `num_bytes`. */
+inline __mmask64 tail_mask(const size_t num_bytes) {
+  return num_bytes >= CACHE_LINE_SIZE ? ~__mmask64{0} : (__mmask64{1} << num_bytes) - 1;
+}
+
+inline void simd_write_unaligned(char* addr, const size_t access_size, flush_fn flush, barrier_fn barrier) {
+  __m512i* data = (__m512i*)(WRITE_DATA);
+  const char* access_end_addr = addr + access_size;
+  char* mem_addr = addr;
+  for (; mem_addr + CACHE_LINE_SIZE <= access_end_addr; mem_addr += CACHE_LINE_SIZE) {
+    WRITE_SIMD_512_UNALIGNED(mem_addr, 0, *data);
+  }
+
+  const size_t tail_size = access_end_addr - mem_addr;
+  if (tail_size > 0) {
+    _mm512_mask_storeu_epi8(mem_addr, tail_mask(tail_size), *data);
+  }
+  flush(addr, access_size);
+  barrier();
+}
+
+inline void simd_write_unaligned(const std::vector<char*>& addresses, const size_t access_size, flush_fn flush,
+                                 barrier_fn barrier) {
+  for (char* addr : addresses) {
+    simd_write_unaligned(addr, access_size, flush, barrier);
+  }
+}
+
+#ifdef HAS_CLWB
+inline void simd_write_clwb_unaligned(char* addr, const size_t access_size) {
+  simd_write_unaligned(addr, access_size, flush_clwb, sfence_barrier);
+}
+
+inline void simd_write_clwb_unaligned(const std::vector<char*>& addresses, const size_t access_size) {
+  simd_write_unaligned(addresses, access_size, flush_clwb, sfence_barrier);
+}
+#endif
+
+#ifdef HAS_CLFLUSHOPT
+inline void simd_write_clflushopt_unaligned(char* addr, const size_t access_size) {
+  simd_write_unaligned(addr, access_size, flush_clflushopt, sfence_barrier);
+}
+
+inline void simd_write_clflushopt_unaligned(const std::vector<char*>& addresses, const size_t access_size) {
+  simd_write_unaligned(addresses, access_size, flush_clflushopt, sfence_barrier);
+}
+#endif
+
+inline void simd_write_none_unaligned(char* addr, const size_t access_size) {
+  simd_write_unaligned(addr, access_size, no_flush, no_barrier);
+}
+
+inline void simd_write_none_unaligned(const std::vector<char*>& addresses, const size_t access_size) {
+  simd_write_unaligned(addresses, access_size, no_flush, no_barrier);
+}
+
+inline void simd_write_fence_unaligned(char* addr, const size_t access_size) {
+  simd_write_unaligned(addr, access_size, no_flush, sfence_barrier);
+}
+
+inline void simd_write_fence_unaligned(const std::vector<char*>& addresses, const size_t access_size) {
+  simd_write_unaligned(addresses, access_size, no_flush, sfence_barrier);
+}
+
+inline void simd_write_nt_unaligned(char* addr, const size_t access_size, barrier_fn barrier) {
+  // Non-temporal stores require 64 Byte alignment. Similar to PMDK's non-temporal memcpy, we write the partial cache
+  // lines at the beginning and the end of the access with regular (masked) stores and flush them explicitly.
+  __m512i* data = (__m512i*)(WRITE_DATA);
+  char* access_end_addr = addr + access_size;
+  const size_t misalignment = reinterpret_cast<uintptr_t>(addr) % CACHE_LINE_SIZE;
+  const size_t head_size = std::min(access_size, (CACHE_LINE_SIZE - misalignment) % CACHE_LINE_SIZE);
+  if (head_size > 0) {
+    _mm512_mask_storeu_epi8(addr, tail_mask(head_size), *data);
+    flush_partial_line(addr, head_size);
+  }
+
+  char* mem_addr = addr + head_size;
+  for (; mem_addr + CACHE_LINE_SIZE <= access_end_addr; mem_addr += CACHE_LINE_SIZE) {
+    WRITE_SIMD_NT_512(mem_addr, 0, *data);
+  }
+
+  const size_t tail_size = access_end_addr - mem_addr;
+  if (tail_size > 0) {
+    _mm512_mask_storeu_epi8(mem_addr, tail_mask(tail_size), *data);
+    flush_partial_line(mem_addr, tail_size);
+  }
+  barrier();
+}
+
+inline void simd_write_nt_unaligned(char* addr, const size_t access_size) {
+  simd_write_nt_unaligned(addr, access_size, sfence_barrier);
+}
+
+inline void simd_write_nt_unaligned(const std::vector<char*>& addresses, const size_t access_size) {
+  for (char* addr : addresses) {
+    simd_write_nt_unaligned(addr, access_size);
+  }
+}
+
+inline __m512i simd_read_unaligned(char* addr, const size_t access_size) {
+  __m512i res = _mm512_setzero_si512();
+  const char* access_end_addr = addr + access_size;
+  const char* mem_addr = addr;
+  for (; mem_addr + CACHE_LINE_SIZE <= access_end_addr; mem_addr += CACHE_LINE_SIZE) {
+    res += READ_SIMD_512_UNALIGNED(mem_addr, 0);
+  }
+
+  const size_t tail_size = access_end_addr - mem_addr;
+  if (tail_size > 0) {
+    res += _mm512_maskz_loadu_epi8(tail_mask(tail_size), mem_addr);
+  }
+  return res;
+}
+
+inline void simd_read_unaligned(const std::vector<char*>& addresses, const size_t access_size) {
+  __m512i res;
+  auto simd_fn = [&]() {
+    for (char* addr : addresses) {
+      res = simd_read_unaligned(addr, access_size);
+    }
+    return res;
+  };
+  // Do a single copy of the last read value to the stack from a zmm register. Otherwise, KEEP copies on each
+  // invocation if we have KEEP in the loop because it cannot be sure how KEEP modifies the current zmm register.
+  __m512i x = simd_fn();
+  KEEP(&x);
+}
+
+inline void simd_rmw_unaligned(char* addr, const size_t access_size, flush_fn flush, barrier_fn barrier) {
+  const char* access_end_addr = addr + access_size;
+  char* mem_addr = addr;
+  for (; mem_addr + CACHE_LINE_SIZE <= access_end_addr; mem_addr += CACHE_LINE_SIZE) {
+    const __m512i res = READ_SIMD_512_UNALIGNED(mem_addr, 0);
+    WRITE_SIMD_512_UNALIGNED(mem_addr, 0, MODIFY_SIMD_512(res));
+  }
+
+  const size_t tail_size = access_end_addr - mem_addr;
+  if (tail_size > 0) {
+    const __mmask64 mask = tail_mask(tail_size);
+    const __m512i res = _mm512_maskz_loadu_epi8(mask, mem_addr);
+    _mm512_mask_storeu_epi8(mem_addr, mask, MODIFY_SIMD_512(res));
+  }
+  flush(addr, access_size);
+  barrier();
+}
+
+inline void simd_rmw_unaligned(const std::vector<char*>& addresses, const size_t access_size, flush_fn flush,
+                               barrier_fn barrier) {
+  for (char* addr : addresses) {
+    simd_rmw_unaligned(addr, access_size, flush, barrier);
+  }
+}
+
+#ifdef HAS_CLWB
+inline void simd_rmw_clwb_unaligned(char* addr, const size_t access_size) {
+  simd_rmw_unaligned(addr, access_size, flush_clwb, sfence_barrier);
+}
+
+inline void simd_rmw_clwb_unaligned(const std::vector<char*>& addresses, const size_t access_size) {
+  simd_rmw_unaligned(addresses, access_size, flush_clwb, sfence_barrier);
+}
+#endif
+
+#ifdef HAS_CLFLUSHOPT
+inline void simd_rmw_clflushopt_unaligned(char* addr, const size_t access_size) {
+  simd_rmw_unaligned(addr, access_size, flush_clflushopt, sfence_barrier);
+}
+
+inline void simd_rmw_clflushopt_unaligned(const std::vector<char*>& addresses, const size_t access_size) {
+  simd_rmw_unaligned(addresses, access_size, flush_clflushopt, sfence_barrier);
+}
+#endif
+
+inline void simd_rmw_none_unaligned(char* addr, const size_t access_size) {
+  simd_rmw_unaligned(addr, access_size, no_flush, no_barrier);
+}
+
+inline void simd_rmw_none_unaligned(const std::vector<char*>& addresses, const size_t access_size) {
+  simd_rmw_unaligned(addresses, access_size, no_flush, no_barrier);
+}
+
+inline void simd_rmw_fence_unaligned(char* addr, const size_t access_size) {
+  simd_rmw_unaligned(addr, access_size, no_flush, sfence_barrier);
+}
+
+inline void simd_rmw_fence_unaligned(const std::vector<char*>& addresses, const size_t access_size) {
+  simd_rmw_unaligned(addresses, access_size, no_flush, sfence_barrier);
+}
+
+inline void simd_rmw_nt_unaligned(char* addr, const size_t access_size, barrier_fn barrier) {
+  // Same as for non-temporal writes, the partial cache lines at the beginning and the end of the access use regular
+  // (masked) stores and are flushed explicitly.
+  char* access_end_addr = addr + access_size;
+  const size_t misalignment = reinterpret_cast<uintptr_t>(addr) % CACHE_LINE_SIZE;
+  const size_t head_size = std::min(access_size, (CACHE_LINE_SIZE - misalignment) % CACHE_LINE_SIZE);
+  if (head_size > 0) {
+    const __mmask64 mask = tail_mask(head_size);
+    const __m512i res = _mm512_maskz_loadu_epi8(mask, addr);
+    _mm512_mask_storeu_epi8(addr, mask, MODIFY_SIMD_512(res));
+    flush_partial_line(addr, head_size);
+  }
+
+  char* mem_addr = addr + head_size;
+  for (; mem_addr + CACHE_LINE_SIZE <= access_end_addr; mem_addr += CACHE_LINE_SIZE) {
+    const __m512i res = READ_SIMD_512(mem_addr, 0);
+    WRITE_SIMD_NT_512(mem_addr, 0, MODIFY_SIMD_512(res));
+  }
+
+  const size_t tail_size = access_end_addr - mem_addr;
+  if (tail_size > 0) {
+    const __mmask64 mask = tail_mask(tail_size);
+    const __m512i res = _mm512_maskz_loadu_epi8(mask, mem_addr);
+    _mm512_mask_storeu_epi8(mem_addr, mask, MODIFY_SIMD_512(res));
+    flush_partial_line(mem_addr, tail_size);
+  }
+  barrier();
+}
+
+inline void simd_rmw_nt_unaligned(char* addr, const size_t access_size) {
+  simd_rmw_nt_unaligned(addr, access_size, sfence_barrier);
+}
+
+inline void simd_rmw_nt_unaligned(const std::vector<char*>& addresses, const size_t access_size) {
+  for (char* addr : addresses) {
+    simd_rmw_nt_unaligned(addr, access_size);
+  }
+}
+
+/**
+ * #####################################################
+ * DATA PATTERN STORE OPERATIONS
+ * #####################################################
+ *
+ * Writes with a `data_pattern` other than constant store the data of a per-thread `WriteDataBuffer` instead of
+ * WRITE_DATA. The i-th cache line of the access stores the line at `data + i * data_stride`, i.e., a stride of 0 stores
+ * the same line everywhere and a stride of 64 stores consecutive lines of the buffer. `data` must be 64 Byte aligned.
+ * Like the unaligned kernels, these support arbitrary sizes and addresses.
+ */
+
+inline void simd_write_lines(char* addr, const size_t access_size, const char* data, const size_t data_stride,
+                             flush_fn flush, barrier_fn barrier) {
+  const char* access_end_addr = addr + access_size;
+  char* mem_addr = addr;
+  for (; mem_addr + CACHE_LINE_SIZE <= access_end_addr; mem_addr += CACHE_LINE_SIZE, data += data_stride) {
+    WRITE_SIMD_512_UNALIGNED(mem_addr, 0, _mm512_load_si512(data));
+  }
+
+  const size_t tail_size = access_end_addr - mem_addr;
+  if (tail_size > 0) {
+    _mm512_mask_storeu_epi8(mem_addr, tail_mask(tail_size), _mm512_load_si512(data));
+  }
+  flush(addr, access_size);
+  barrier();
+}
+
+inline void simd_write_nt_lines(char* addr, const size_t access_size, const char* data, const size_t data_stride,
+                                barrier_fn barrier) {
+  // Same split into a partial head, full non-temporal lines, and a partial tail as `simd_write_nt_unaligned`.
+  char* access_end_addr = addr + access_size;
+  const size_t misalignment = reinterpret_cast<uintptr_t>(addr) % CACHE_LINE_SIZE;
+  const size_t head_size = std::min(access_size, (CACHE_LINE_SIZE - misalignment) % CACHE_LINE_SIZE);
+  if (head_size > 0) {
+    _mm512_mask_storeu_epi8(addr, tail_mask(head_size), _mm512_load_si512(data));
+    flush_partial_line(addr, head_size);
+    data += data_stride;
+  }
+
+  char* mem_addr = addr + head_size;
+  for (; mem_addr + CACHE_LINE_SIZE <= access_end_addr; mem_addr += CACHE_LINE_SIZE, data += data_stride) {
+    WRITE_SIMD_NT_512(mem_addr, 0, _mm512_load_si512(data));
+  }
+
+  const size_t tail_size = access_end_addr - mem_addr;
+  if (tail_size > 0) {
+    _mm512_mask_storeu_epi8(mem_addr, tail_mask(tail_size), _mm512_load_si512(data));
+    flush_partial_line(mem_addr, tail_size);
+  }
+  barrier();
+}
+
+/**
+ * #####################################################
+ * CHECKSUM OPERATIONS
+ * #####################################################
+ *
+ * Storage engines verify a checksum over each page they read and compute one over each page they write. The checksum
+ * reads load the data only as input of the checksum, so the checksum is on the critical path of the read. The write
+ * checksums cover the data that the write kernels store, i.e., WRITE_DATA repeated for the size of the access or the
+ * lines of a data pattern with the same stride as the data pattern store operations. The read-modify-write checksums
+ * load each line once and cover both the loaded and the modified data that they store. All support arbitrary sizes and
+ * unaligned addresses.
+ *
+ * CRC32C uses the SSE4.2 crc32 instruction on 8 Byte words. xxhash uses the AVX-512 accumulation loop of XXH3 on 64
+ * Byte stripes, but without the per-block scrambling and with a fixed key, so it is not bit-compatible with XXH3.
+ */
+
+static constexpr uint64_t CRC32C_SEED = 0xFFFFFFFF;
+
+// First 64 Byte of the default XXH3 secret.
+static const uint8_t XXHASH_KEY[] __attribute__((aligned(64))) = {
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c};
+
+inline uint64_t crc32c_range(const char* addr, size_t num_bytes, uint64_t crc) {
+  for (; num_bytes >= sizeof(uint64_t); num_bytes -= sizeof(uint64_t), addr += sizeof(uint64_t)) {
+    uint64_t word;
+    std::memcpy(&word, addr, sizeof(uint64_t));
+    crc = _mm_crc32_u64(crc, word);
+  }
+  for (; num_bytes > 0; --num_bytes, ++addr) {
+    crc = _mm_crc32_u8(crc, *addr);
+  }
+  return crc;
+}
+
+inline __m512i xxhash_accumulate(const __m512i acc, const __m512i data) {
+  const __m512i data_key = _mm512_xor_si512(data, _mm512_load_si512(XXHASH_KEY));
+  const __m512i data_key_lo = _mm512_shuffle_epi32(data_key, (_MM_PERM_ENUM)_MM_SHUFFLE(0, 3, 0, 1));
+  const __m512i product = _mm512_mul_epu32(data_key, data_key_lo);
+  const __m512i data_swap = _mm512_shuffle_epi32(data, (_MM_PERM_ENUM)_MM_SHUFFLE(1, 0, 3, 2));
+  return _mm512_add_epi64(product, _mm512_add_epi64(acc, data_swap));
+}
+
+inline uint64_t xxhash_finalize(const __m512i acc, const size_t access_size) {
+  uint64_t hash = _mm512_reduce_add_epi64(acc) + (access_size * 0x9E3779B185EBCA87ul);
+  hash ^= hash >> 37;
+  hash *= 0x165667919E3779F9ul;
+  return hash ^ (hash >> 32);
+}
+
+inline uint64_t simd_read_crc32c(char* addr, const size_t access_size) {
+  return crc32c_range(addr, access_size, CRC32C_SEED);
+}
+
+inline uint64_t simd_read_xxhash(char* addr, const size_t access_size) {
+  __m512i acc = _mm512_setzero_si512();
+  const char* access_end_addr = addr + access_size;
+  const char* mem_addr = addr;
+  for (; mem_addr + CACHE_LINE_SIZE <= access_end_addr; mem_addr += CACHE_LINE_SIZE) {
+    acc = xxhash_accumulate(acc, READ_SIMD_512_UNALIGNED(mem_addr, 0));
+  }
+
+  const size_t tail_size = access_end_addr - mem_addr;
+  if (tail_size > 0) {
+    acc = xxhash_accumulate(acc, _mm512_maskz_loadu_epi8(tail_mask(tail_size), mem_addr));
+  }
+  return xxhash_finalize(acc, access_size);
+}
+
+inline uint64_t crc32c_write_data(const size_t access_size, const char* data = WRITE_DATA,
+                                  const size_t data_stride = 0) {
+  uint64_t crc = CRC32C_SEED;
+  for (size_t offset = 0; offset < access_size; offset += CACHE_LINE_SIZE, data += data_stride) {
+    const char* line = data;
+    // Hide the data from the compiler, so that it cannot compute the checksum of the constant at compile time.
+    asm volatile("" : "+r"(line));
+    crc = crc32c_range(line, std::min(CACHE_LINE_SIZE, access_size - offset), crc);
+  }
+  return crc;
+}
+
+inline uint64_t xxhash_write_data(const size_t access_size, const char* data = WRITE_DATA,
+                                  const size_t data_stride = 0) {
+  __m512i acc = _mm512_setzero_si512();
+  for (size_t offset = 0; offset < access_size; offset += CACHE_LINE_SIZE, data += data_stride) {
+    __m512i line = _mm512_maskz_loadu_epi8(tail_mask(access_size - offset), data);
+    asm volatile("" : "+v"(line));
+    acc = xxhash_accumulate(acc, line);
+  }
+  return xxhash_finalize(acc, access_size);
+}
+
+inline uint64_t crc32c_line(const __m512i line, const size_t num_bytes, const uint64_t crc) {
+  char bytes[CACHE_LINE_SIZE] __attribute__((aligned(64)));
+  _mm512_store_si512(bytes, line);
+  return crc32c_range(bytes, num_bytes, crc);
+}
+
+/**
+ * Reads, modifies, and writes each line of the access like `simd_rmw_unaligned` and passes the loaded and the modified
+ * line to `checksum_lines`. With `non_temporal`, full cache lines are written with non-temporal stores and partial ones
+ * are flushed, like `simd_rmw_nt_unaligned`.
+ */
+template <typename ChecksumFn>
+inline void simd_rmw_checksum(char* addr, const size_t access_size, const bool non_temporal, flush_fn flush,
+                              barrier_fn barrier, ChecksumFn&& checksum_lines) {
+  const char* access_end_addr = addr + access_size;
+  for (char* mem_addr = addr; mem_addr < access_end_addr; mem_addr += CACHE_LINE_SIZE) {
+    const size_t line_size = std::min(CACHE_LINE_SIZE, static_cast<size_t>(access_end_addr - mem_addr));
+    const __mmask64 mask = tail_mask(line_size);
+    const __m512i loaded_line = _mm512_maskz_loadu_epi8(mask, mem_addr);
+    // Zero the bytes behind a partial line, so that they do not change the checksum.
+    const __m512i modified_line = _mm512_maskz_mov_epi8(mask, MODIFY_SIMD_512(loaded_line));
+    checksum_lines(loaded_line, modified_line, line_size);
+
+    const bool is_full_line =
+        line_size == CACHE_LINE_SIZE && reinterpret_cast<uintptr_t>(mem_addr) % CACHE_LINE_SIZE == 0;
+    if (non_temporal && is_full_line) {
+      WRITE_SIMD_NT_512(mem_addr, 0, modified_line);
+      continue;
+    }
+    _mm512_mask_storeu_epi8(mem_addr, mask, modified_line);
+    if (non_temporal) {
+      flush_partial_line(mem_addr, line_size);
+    }
+  }
+  flush(addr, access_size);
+  barrier();
+}
+
+/** Returns the combined CRC32C checksums of the loaded and the modified data of a read-modify-write. */
+inline uint64_t simd_rmw_crc32c(char* addr, const size_t access_size, const bool non_temporal, flush_fn flush,
+                                barrier_fn barrier) {
+  uint64_t loaded_crc = CRC32C_SEED;
+  uint64_t modified_crc = CRC32C_SEED;
+  simd_rmw_checksum(addr, access_size, non_temporal, flush, barrier,
+                    [&](const __m512i loaded_line, const __m512i modified_line, const size_t line_size) {
+                      loaded_crc = crc32c_line(loaded_line, line_size, loaded_crc);
+                      modified_crc = crc32c_line(modified_line, line_size, modified_crc);
+                    });
+  return loaded_crc ^ modified_crc;
+}
+
+/** Returns the combined xxhash checksums of the loaded and the modified data of a read-modify-write. */
+inline uint64_t simd_rmw_xxhash(char* addr, const size_t access_size, const bool non_temporal, flush_fn flush,
+                                barrier_fn barrier) {
+  __m512i loaded_acc = _mm512_setzero_si512();
+  __m512i modified_acc = _mm512_setzero_si512();
+  simd_rmw_checksum(addr, access_size, non_temporal, flush, barrier,
+                    [&](const __m512i loaded_line, const __m512i modified_line, const size_t /*line_size*/) {
+                      loaded_acc = xxhash_accumulate(loaded_acc, loaded_line);
+                      modified_acc = xxhash_accumulate(modified_acc, modified_line);
+                    });
+  return xxhash_finalize(loaded_acc, access_size) ^ xxhash_finalize(modified_acc, access_size);
+}
+
 #endif
 
 inline void write_data(char* from, const char* to) {
@@ -33,15 +33,18 @@ bool SingleBenchmark::run() {
 }
 
 void SingleBenchmark::create_data_files() {
-  pmem_data_.push_back(create_pmem_data_file(configs_[0], memory_regions_[0]));
+  pmem_data_.push_back(create_pmem_data_file(configs_[0], memory_regions_[0], configs_[0].memory_range));
   dram_data_.push_back(create_dram_data(configs_[0], configs_[0].dram_memory_range));
+
+  custom_region_files_.resize(1);
+  custom_region_data_.push_back(create_custom_region_data(configs_[0], &custom_region_files_[0]));
 }
 
 void SingleBenchmark::set_up() {
   pools_.resize(1);
   thread_configs_.resize(1);
-  single_set_up(configs_[0], pmem_data_[0], dram_data_[0], executions_[0].get(), results_[0].get(), &pools_[0],
-                &thread_configs_[0]);
+  single_set_up(configs_[0], pmem_data_[0], dram_data_[0], custom_region_data_[0], executions_[0].get(),
+                results_[0].get(), &pools_[0], &thread_configs_[0]);
 }
 
 nlohmann::json SingleBenchmark::get_result_as_json() {
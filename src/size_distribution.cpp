@@ -0,0 +1,140 @@
+#include "size_distribution.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <sstream>
+
+#include "utils.hpp"
+
+namespace {
+
+// Use a fixed seed so that all benchmarks with the same distribution access the same sizes.
+constexpr uint64_t SIZE_SAMPLER_SEED = 42;
+
+}  // namespace
+
+namespace perma {
+
+void SizeBucketCounters::add(const SizeBucketCounters& other) {
+  for (size_t bucket = 0; bucket < NUM_SIZE_BUCKETS; ++bucket) {
+    num_operations[bucket] += other.num_operations[bucket];
+    accessed_bytes[bucket] += other.accessed_bytes[bucket];
+  }
+}
+
+uint64_t SizeBucketCounters::total_operations() const {
+  return std::accumulate(num_operations.begin(), num_operations.end(), 0ul);
+}
+
+uint64_t SizeBucketCounters::total_bytes() const {
+  return std::accumulate(accessed_bytes.begin(), accessed_bytes.end(), 0ul);
+}
+
+nlohmann::json SizeBucketCounters::as_json(const std::vector<SizeBucketCounters>& counters, const double duration_s) {
+  SizeBucketCounters total{};
+  for (const SizeBucketCounters& thread_counters : counters) {
+    total.add(thread_counters);
+  }
+
+  nlohmann::json buckets = nlohmann::json::array();
+  for (size_t bucket = 0; bucket < NUM_SIZE_BUCKETS; ++bucket) {
+    const uint64_t num_ops = total.num_operations[bucket];
+    if (num_ops == 0) {
+      continue;
+    }
+
+    const uint64_t num_bytes = total.accessed_bytes[bucket];
+    nlohmann::json bucket_result;
+    bucket_result["min_size"] = 1ul << bucket;
+    bucket_result["max_size"] = (1ul << (bucket + 1)) - 1;
+    bucket_result["num_operations"] = num_ops;
+    bucket_result["accessed_bytes"] = num_bytes;
+    // The buckets share the execution time, so these are the bucket's contribution to the total throughput.
+    bucket_result["ops_per_second"] = static_cast<double>(num_ops) / duration_s;
+    bucket_result["bandwidth"] = (static_cast<double>(num_bytes) / BYTES_IN_GIGABYTE) / duration_s;
+    buckets.emplace_back(std::move(bucket_result));
+  }
+  return buckets;
+}
+
+AccessSizeSampler::AccessSizeSampler(const BenchmarkConfig& config) : sizes_(NUM_SAMPLED_SIZES) {
+  std::mt19937_64 generator{SIZE_SAMPLER_SEED};
+  const uint32_t min_size = config.min_access_size;
+  const uint32_t max_size = config.max_access_size;
+
+  switch (config.access_size_distribution) {
+    case SizeDistribution::Uniform: {
+      std::uniform_int_distribution<uint32_t> distribution{min_size, max_size};
+      std::generate(sizes_.begin(), sizes_.end(), [&] { return distribution(generator); });
+      break;
+    }
+    case SizeDistribution::LogNormal: {
+      std::lognormal_distribution<double> distribution{config.lognormal_mu, config.lognormal_sigma};
+      std::generate(sizes_.begin(), sizes_.end(), [&] {
+        const double size = std::round(distribution(generator));
+        return static_cast<uint32_t>(std::clamp(size, static_cast<double>(min_size), static_cast<double>(max_size)));
+      });
+      break;
+    }
+    case SizeDistribution::Histogram: {
+      const std::vector<std::pair<uint32_t, double>> histogram = read_histogram(config.access_size_histogram_file);
+      std::vector<double> weights(histogram.size());
+      std::transform(histogram.begin(), histogram.end(), weights.begin(),
+                     [](const auto& entry) { return entry.second; });
+      std::discrete_distribution<size_t> distribution{weights.begin(), weights.end()};
+      std::generate(sizes_.begin(), sizes_.end(), [&] { return histogram[distribution(generator)].first; });
+      break;
+    }
+    case SizeDistribution::Fixed: {
+      std::fill(sizes_.begin(), sizes_.end(), config.access_size);
+      break;
+    }
+  }
+
+  max_size_ = *std::max_element(sizes_.begin(), sizes_.end());
+  average_size_ = static_cast<double>(std::accumulate(sizes_.begin(), sizes_.end(), 0ul)) / NUM_SAMPLED_SIZES;
+}
+
+std::vector<std::pair<uint32_t, double>> AccessSizeSampler::read_histogram(
+    const std::filesystem::path& histogram_file) {
+  std::ifstream histogram_stream{histogram_file};
+  if (!histogram_stream.is_open()) {
+    spdlog::error("Could not open access size histogram file: {}", histogram_file.string());
+    utils::crash_exit();
+  }
+
+  std::vector<std::pair<uint32_t, double>> histogram;
+  std::string line;
+  while (std::getline(histogram_stream, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+
+    std::stringstream line_stream{line};
+    uint32_t size = 0;
+    double weight = -1;
+    line_stream >> size >> weight;
+    if (line_stream.fail() || size == 0 || weight < 0) {
+      spdlog::error("Invalid line in access size histogram. Expected '<size> <weight>' with size > 0. Got: '{}'", line);
+      utils::crash_exit();
+    }
+    histogram.emplace_back(size, weight);
+  }
+
+  const bool has_positive_weight =
+      std::any_of(histogram.begin(), histogram.end(), [](const auto& entry) { return entry.second > 0; });
+  if (!has_positive_weight) {
+    spdlog::error("Access size histogram must contain at least one size with a positive weight: {}",
+                  histogram_file.string());
+    utils::crash_exit();
+  }
+
+  return histogram;
+}
+
+}  // namespace perma
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <json.hpp>
+#include <utility>
+#include <vector>
+
+#include "benchmark_config.hpp"
+#include "fast_random.hpp"
+
+namespace perma {
+
+// Access sizes are grouped into power-of-two buckets, i.e., bucket i contains all sizes in [2^i, 2^(i+1)).
+static constexpr size_t NUM_SIZE_BUCKETS = 32;
+
+inline size_t get_size_bucket(const uint64_t size) { return 63 - __builtin_clzll(size); }
+
+/** Number of operations and accessed bytes per size bucket. */
+struct SizeBucketCounters {
+  std::array<uint64_t, NUM_SIZE_BUCKETS> num_operations{};
+  std::array<uint64_t, NUM_SIZE_BUCKETS> accessed_bytes{};
+
+  inline void add(const uint64_t size) {
+    const size_t bucket = get_size_bucket(size);
+    num_operations[bucket]++;
+    accessed_bytes[bucket] += size;
+  }
+
+  void add(const SizeBucketCounters& other);
+
+  uint64_t total_operations() const;
+  uint64_t total_bytes() const;
+
+  /** Returns one entry per non-empty bucket with the bucket bounds, counts, and throughput over `duration_s`. */
+  static nlohmann::json as_json(const std::vector<SizeBucketCounters>& counters, double duration_s);
+};
+
+/**
+ * Draws access sizes from the `access_size_distribution` of a benchmark. Sampling from a log-normal or an empirical
+ * distribution is too expensive to do on every access, so we draw a table of sizes once during the set up. Each access
+ * then picks a random entry of the table, which only costs a single random number.
+ */
+class AccessSizeSampler {
+ public:
+  explicit AccessSizeSampler(const BenchmarkConfig& config);
+
+  inline uint32_t sample() const { return sizes_[lehmer64() & (NUM_SAMPLED_SIZES - 1)]; }
+
+  uint32_t max_size() const { return max_size_; }
+  double average_size() const { return average_size_; }
+
+  /** Reads a histogram file with one `<size> <weight>` pair per line. Skips empty lines and lines starting with #. */
+  static std::vector<std::pair<uint32_t, double>> read_histogram(const std::filesystem::path& histogram_file);
+
+ private:
+  // Must be a power of two.
+  static constexpr size_t NUM_SAMPLED_SIZES = 64 * 1024;
+
+  std::vector<uint32_t> sizes_;
+  uint32_t max_size_ = 0;
+  double average_size_ = 0;
+};
+
+}  // namespace perma
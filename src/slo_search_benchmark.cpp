@@ -0,0 +1,168 @@
+#include "slo_search_benchmark.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <cmath>
+
+#include "single_benchmark.hpp"
+
+namespace {
+
+// The rate search stops once the range is narrower than this share of its lower end.
+constexpr double RATE_SEARCH_PRECISION = 0.01;
+
+}  // namespace
+
+namespace perma {
+
+const std::unordered_map<std::string, SloSearchParameter> SloSearchConfig::str_to_search_parameter{
+    {"target_ops_per_second", SloSearchParameter::TargetOpsPerSecond},
+    {"number_threads", SloSearchParameter::NumberThreads}};
+
+nlohmann::json SloSearchConfig::as_json() const {
+  nlohmann::json config;
+  config["parameter"] = utils::get_enum_as_string(str_to_search_parameter, parameter);
+  config["min"] = min;
+  config["max"] = max;
+  config["latency_percentile"] = latency_percentile;
+  config["max_latency_ns"] = max_latency_ns;
+  config["max_probes"] = max_probes;
+  return config;
+}
+
+bool SloSearchBenchmark::run() {
+  const bool success = search();
+
+  // All probes with read-only configs share the data file, which is not needed after the search.
+  remove_shared_file(configs_[0], memory_regions_[0].pmem_file);
+  return success;
+}
+
+bool SloSearchBenchmark::search() {
+  double lower = search_config_.min;
+  double upper = search_config_.max;
+
+  // If the lower end misses the SLO, no value in the range meets it. If the upper end meets it, there is nothing to
+  // search.
+  if (!run_probe(lower)) {
+    return false;
+  }
+  if (!probes_.back().meets_slo) {
+    return true;
+  }
+  if (!run_probe(upper)) {
+    return false;
+  }
+  if (probes_.back().meets_slo) {
+    return true;
+  }
+
+  // From here on, the lower end always meets the SLO and the upper end misses it.
+  while (probes_.size() < search_config_.max_probes && !is_converged(lower, upper)) {
+    const double value = search_config_.parameter == SloSearchParameter::NumberThreads
+                             ? std::floor((lower + upper) / 2)
+                             : (lower + upper) / 2;
+    if (!run_probe(value)) {
+      return false;
+    }
+    (probes_.back().meets_slo ? lower : upper) = value;
+  }
+  return true;
+}
+
+bool SloSearchBenchmark::run_probe(const double value) {
+  BenchmarkConfig probe_config = configs_[0];
+  if (search_config_.parameter == SloSearchParameter::NumberThreads) {
+    probe_config.number_threads = static_cast<uint16_t>(value);
+  } else {
+    probe_config.target_ops_per_second = value;
+  }
+
+  const std::unique_ptr<SingleBenchmark> probe = run_single_config(probe_config, memory_regions_[0].pmem_file);
+  if (probe == nullptr) {
+    return false;
+  }
+
+  // Creating the JSON records all latencies in the histogram of the result, so we read the percentile afterwards.
+  nlohmann::json probe_results = probe->get_result_as_json()["results"];
+  const int64_t latency =
+      hdr_value_at_percentile(probe->get_benchmark_results()[0]->latency_hdr, search_config_.latency_percentile);
+  const bool meets_slo = static_cast<uint64_t>(latency) <= search_config_.max_latency_ns;
+  const double ops_per_second = probe_results["ops_per_second"];
+
+  spdlog::info("SLO search probe #{}: {} = {} -> p{} latency {} ns at {:.0f} ops/s ({}).", probes_.size() + 1,
+               utils::get_enum_as_string(SloSearchConfig::str_to_search_parameter, search_config_.parameter), value,
+               search_config_.latency_percentile, latency, ops_per_second, meets_slo ? "meets SLO" : "misses SLO");
+  probes_.push_back(SloProbe{value, ops_per_second, static_cast<uint64_t>(latency), meets_slo, probe_results});
+  return true;
+}
+
+bool SloSearchBenchmark::is_converged(const double lower, const double upper) const {
+  if (search_config_.parameter == SloSearchParameter::NumberThreads) {
+    return upper - lower <= 1;
+  }
+  return upper - lower <= lower * RATE_SEARCH_PRECISION;
+}
+
+void SloSearchBenchmark::create_data_files() {}
+
+void SloSearchBenchmark::set_up() {}
+
+nlohmann::json SloSearchBenchmark::get_result_as_json() {
+  nlohmann::json config = get_json_config(0);
+  config["slo_search"] = search_config_.as_json();
+  if (search_config_.parameter == SloSearchParameter::NumberThreads) {
+    // The search sets the number of threads of each probe.
+    config.erase("number_threads");
+  }
+
+  const std::string parameter =
+      utils::get_enum_as_string(SloSearchConfig::str_to_search_parameter, search_config_.parameter);
+  nlohmann::json probes = nlohmann::json::array();
+  for (const SloProbe& probe : probes_) {
+    probes.push_back({{parameter, probe.value},
+                      {"ops_per_second", probe.ops_per_second},
+                      {"latency", probe.latency},
+                      {"meets_slo", probe.meets_slo},
+                      {"results", probe.results}});
+  }
+
+  nlohmann::json result;
+  result["config"] = config;
+  result["results"]["probes"] = probes;
+
+  const SloProbe* operating_point = get_operating_point();
+  if (operating_point == nullptr) {
+    spdlog::warn("SLO search {} found no {} that meets the SLO.", benchmark_name_, parameter);
+    result["results"]["operating_point"] = nullptr;
+  } else {
+    result["results"]["operating_point"] = {{parameter, operating_point->value},
+                                            {"ops_per_second", operating_point->ops_per_second},
+                                            {"latency", operating_point->latency}};
+  }
+  return result;
+}
+
+SloSearchBenchmark::SloSearchBenchmark(const std::string& benchmark_name, const BenchmarkConfig& config,
+                                       const SloSearchConfig& search_config)
+    : Benchmark(
+          benchmark_name, BenchmarkType::SloSearch,
+          std::vector<MemoryRegion>{{utils::generate_random_file_name(config.pmem_directory), true, config.is_hybrid}},
+          std::vector<BenchmarkConfig>{config}, {}, {}),
+      search_config_{search_config} {}
+
+const SloSearchConfig& SloSearchBenchmark::get_search_config() const { return search_config_; }
+
+const std::vector<SloProbe>& SloSearchBenchmark::get_probes() const { return probes_; }
+
+const SloProbe* SloSearchBenchmark::get_operating_point() const {
+  const SloProbe* operating_point = nullptr;
+  for (const SloProbe& probe : probes_) {
+    if (probe.meets_slo && (operating_point == nullptr || probe.value > operating_point->value)) {
+      operating_point = &probe;
+    }
+  }
+  return operating_point;
+}
+
+}  // namespace perma
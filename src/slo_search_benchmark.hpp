@@ -0,0 +1,88 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include "benchmark.hpp"
+
+namespace perma {
+
+enum class SloSearchParameter : uint8_t { TargetOpsPerSecond, NumberThreads };
+
+struct SloSearchConfig {
+  static const std::unordered_map<std::string, SloSearchParameter> str_to_search_parameter;
+
+  /** The parameter that the search adjusts, i.e., the offered load or the number of threads. */
+  SloSearchParameter parameter = SloSearchParameter::TargetOpsPerSecond;
+
+  /** The range of the parameter to search in. The search assumes that the latency grows with the parameter. */
+  double min = 0;
+  double max = 0;
+
+  /** The SLO: the `latency_percentile` of the operation latencies must not exceed `max_latency_ns`. */
+  double latency_percentile = 99.0;
+  uint64_t max_latency_ns = 0;
+
+  /** Upper bound of benchmark runs, including the runs at `min` and `max`. */
+  uint32_t max_probes = 10;
+
+  nlohmann::json as_json() const;
+};
+
+// One run of the search at a single value of the search parameter.
+struct SloProbe {
+  double value;
+  double ops_per_second;
+  uint64_t latency;
+  bool meets_slo;
+  nlohmann::json results;
+};
+
+/**
+ * Searches the highest value of the offered load or the number of threads at which a benchmark still meets a latency
+ * SLO, e.g., "max throughput such that p99 < 2 us". Each probe runs the benchmark as a single benchmark with the
+ * probed value. After checking both ends of the range, the search bisects it until it converges or runs out of
+ * probes. The result contains the trace of all probes and the final operating point.
+ */
+class SloSearchBenchmark : public Benchmark {
+ public:
+  SloSearchBenchmark(const std::string& benchmark_name, const BenchmarkConfig& config,
+                     const SloSearchConfig& search_config);
+
+  SloSearchBenchmark(SloSearchBenchmark&& other) = default;
+  SloSearchBenchmark(const SloSearchBenchmark& other) = delete;
+  SloSearchBenchmark& operator=(const SloSearchBenchmark& other) = delete;
+  SloSearchBenchmark& operator=(SloSearchBenchmark&& other) = delete;
+
+  /** Runs the probes of the search one after another. */
+  bool run() override;
+
+  /** Each probe creates its own data, so there is nothing to do here. */
+  void create_data_files() override;
+
+  /** Each probe sets up its own threads, so there is nothing to do here. */
+  void set_up() override;
+
+  /** Return the results as a JSON to be exported to the user and visualization. */
+  nlohmann::json get_result_as_json() override;
+
+  const SloSearchConfig& get_search_config() const;
+  const std::vector<SloProbe>& get_probes() const;
+
+  // Returns the passing probe with the highest value or null if no probe met the SLO.
+  const SloProbe* get_operating_point() const;
+
+ protected:
+  // Runs the benchmark with the search parameter set to `value` and adds the probe's result.
+  virtual bool run_probe(double value);
+
+  std::vector<SloProbe> probes_;
+
+ private:
+  bool search();
+  bool is_converged(double lower, double upper) const;
+
+  const SloSearchConfig search_config_;
+};
+
+}  // namespace perma
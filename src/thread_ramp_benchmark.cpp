@@ -0,0 +1,100 @@
+#include "thread_ramp_benchmark.hpp"
+
+#include <spdlog/spdlog.h>
+
+namespace perma {
+
+const std::unordered_map<std::string, ThreadRampMode> ThreadRampConfig::str_to_mode{
+    {"linear", ThreadRampMode::Linear}, {"doubling", ThreadRampMode::Doubling}};
+
+std::vector<uint16_t> ThreadRampConfig::get_step_threads() const {
+  std::vector<uint16_t> step_threads_per_step{1};
+  uint32_t number_threads = mode == ThreadRampMode::Doubling ? 2 : step_threads;
+  while (number_threads < max_threads) {
+    if (number_threads > step_threads_per_step.back()) {
+      step_threads_per_step.push_back(static_cast<uint16_t>(number_threads));
+    }
+    number_threads = mode == ThreadRampMode::Doubling ? 2 * number_threads : number_threads + step_threads;
+  }
+  if (max_threads > step_threads_per_step.back()) {
+    step_threads_per_step.push_back(max_threads);
+  }
+  return step_threads_per_step;
+}
+
+nlohmann::json ThreadRampConfig::as_json() const {
+  nlohmann::json config;
+  config["mode"] = utils::get_enum_as_string(str_to_mode, mode);
+  config["max_threads"] = max_threads;
+  if (mode == ThreadRampMode::Linear) {
+    config["step_threads"] = step_threads;
+  }
+  return config;
+}
+
+bool ThreadRampBenchmark::run() {
+  return run_steps([&](const size_t step) {
+    const uint16_t number_threads = configs_[step].number_threads;
+    spdlog::debug("Finished thread ramp step {}/{} with {} thread{}.", step + 1, num_steps(), number_threads,
+                  number_threads != 1 ? "s" : "");
+  });
+}
+
+void ThreadRampBenchmark::create_data_files() {
+  pmem_data_.push_back(create_pmem_data_file(configs_[0], memory_regions_[0], configs_[0].memory_range));
+  dram_data_.push_back(create_dram_data(configs_[0], configs_[0].dram_memory_range));
+
+  custom_region_files_.resize(1);
+  custom_region_data_.push_back(create_custom_region_data(configs_[0], &custom_region_files_[0]));
+}
+
+void ThreadRampBenchmark::set_up() { set_up_steps(1); }
+
+nlohmann::json ThreadRampBenchmark::get_result_as_json() {
+  // The steps only differ in their number of threads, which is part of the step results instead.
+  nlohmann::json config = get_json_config(0);
+  config.erase("number_threads");
+  config["thread_ramp"] = ramp_config_.as_json();
+
+  nlohmann::json steps = nlohmann::json::array();
+  size_t peak_step = 0;
+  double peak_bandwidth = 0;
+  for (size_t step = 0; step < num_steps(); ++step) {
+    const nlohmann::json step_results = results_[step]->get_result_as_json()["results"];
+    const double bandwidth = step_results["bandwidth"];
+    if (bandwidth > peak_bandwidth) {
+      peak_step = step;
+      peak_bandwidth = bandwidth;
+    }
+
+    nlohmann::json step_result;
+    step_result["number_threads"] = configs_[step].number_threads;
+    step_result["bandwidth"] = bandwidth;
+    step_result["results"] = step_results;
+    steps.emplace_back(std::move(step_result));
+  }
+
+  nlohmann::json result;
+  result["config"] = config;
+  result["results"]["steps"] = steps;
+  result["results"]["peak"] = {{"number_threads", configs_[peak_step].number_threads},
+                               {"bandwidth", peak_bandwidth}};
+  return result;
+}
+
+ThreadRampBenchmark::ThreadRampBenchmark(const std::string& benchmark_name,
+                                         const std::vector<BenchmarkConfig>& step_configs,
+                                         const ThreadRampConfig& ramp_config,
+                                         std::vector<std::unique_ptr<BenchmarkExecution>>&& executions,
+                                         std::vector<std::unique_ptr<BenchmarkResult>>&& results)
+    : Benchmark(benchmark_name, BenchmarkType::ThreadRamp,
+                std::vector<MemoryRegion>{{utils::generate_random_file_name(step_configs[0].pmem_directory), true,
+                                           step_configs[0].is_hybrid}},
+                step_configs, std::move(executions), std::move(results)),
+      ramp_config_{ramp_config} {}
+
+const ThreadRampConfig& ThreadRampBenchmark::get_ramp_config() const { return ramp_config_; }
+
+size_t ThreadRampBenchmark::num_steps() const { return configs_.size(); }
+
+}  // namespace perma
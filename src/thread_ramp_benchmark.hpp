@@ -0,0 +1,69 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include "benchmark.hpp"
+
+namespace perma {
+
+enum class ThreadRampMode : uint8_t { Linear, Doubling };
+
+struct ThreadRampConfig {
+  static const std::unordered_map<std::string, ThreadRampMode> str_to_mode;
+
+  /**
+   * `doubling` doubles the number of threads in each step, i.e., 1, 2, 4, ... threads. `linear` adds `step_threads`
+   * threads in each step, i.e., 1, `step_threads`, 2 * `step_threads`, ... threads. Both end with `max_threads`.
+   */
+  ThreadRampMode mode = ThreadRampMode::Doubling;
+  uint16_t max_threads = 0;
+  uint16_t step_threads = 1;
+
+  // Returns the number of threads of each step.
+  std::vector<uint16_t> get_step_threads() const;
+
+  nlohmann::json as_json() const;
+};
+
+/**
+ * Runs a sequential or random benchmark with a growing number of threads to get its thread-scaling curve in a single
+ * setup. All steps access the same memory region, which is only created, filled, and removed once. Each step runs its
+ * threads for the `run_time` of the config. The result contains the bandwidth of each step and the peak step, at which
+ * the bandwidth saturates.
+ */
+class ThreadRampBenchmark : public Benchmark {
+ public:
+  /** The configs hold one entry per step, which only differ in their `number_threads`. */
+  ThreadRampBenchmark(const std::string& benchmark_name, const std::vector<BenchmarkConfig>& step_configs,
+                      const ThreadRampConfig& ramp_config,
+                      std::vector<std::unique_ptr<BenchmarkExecution>>&& executions,
+                      std::vector<std::unique_ptr<BenchmarkResult>>&& results);
+
+  ThreadRampBenchmark(ThreadRampBenchmark&& other) = default;
+  ThreadRampBenchmark(const ThreadRampBenchmark& other) = delete;
+  ThreadRampBenchmark& operator=(const ThreadRampBenchmark& other) = delete;
+  ThreadRampBenchmark& operator=(ThreadRampBenchmark&& other) = delete;
+
+  /** Main run method which executes the benchmark. `setup()` should be called before this. */
+  bool run() override;
+
+  /** Generates the data needed for the benchmark. All steps share the same data. */
+  void create_data_files() override;
+
+  /** Create all the IO addresses ahead of time to avoid unnecessary ops during the actual benchmark. */
+  void set_up() override;
+
+  /** Return the results as a JSON to be exported to the user and visualization. */
+  nlohmann::json get_result_as_json() override;
+
+  const ThreadRampConfig& get_ramp_config() const;
+  size_t num_steps() const;
+
+  ~ThreadRampBenchmark() { ThreadRampBenchmark::tear_down(false); }
+
+ private:
+  const ThreadRampConfig ramp_config_;
+};
+
+}  // namespace perma
@@ -5,11 +5,14 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <iomanip>
+#include <limits>
 #include <random>
 #include <thread>
 
+#include "fast_random.hpp"
 #include "json.hpp"
 #include "read_write_ops.hpp"
 
@@ -212,6 +215,74 @@ double rand_val() {
   return ((double)x / m);
 }
 
+namespace {
+
+// log(1 + x) / x, which is stable for x close to 0.
+double log1p_div_x(const double x) {
+  if (std::abs(x) > 1e-8) {
+    return std::log1p(x) / x;
+  }
+  return 1.0 - x * (0.5 - x * (1.0 / 3.0 - 0.25 * x));
+}
+
+// (exp(x) - 1) / x, which is stable for x close to 0.
+double expm1_div_x(const double x) {
+  if (std::abs(x) > 1e-8) {
+    return std::expm1(x) / x;
+  }
+  return 1.0 + x * 0.5 * (1.0 + x * (1.0 / 3.0) * (1.0 + 0.25 * x));
+}
+
+}  // namespace
+
+ZipfGenerator::ZipfGenerator(const double alpha, const uint64_t n) : alpha_{alpha}, n_{n} {
+  h_integral_x1_ = h_integral(1.5) - 1.0;
+  h_integral_n_ = h_integral(static_cast<double>(n_) + 0.5);
+  s_ = 2.0 - h_integral_inverse(h_integral(2.5) - h(2.0));
+}
+
+uint64_t ZipfGenerator::sample(uint64_t random_bits) const {
+  while (true) {
+    // Use the upper 53 bits for a uniform double in [0, 1).
+    const double uniform = static_cast<double>(random_bits >> 11) * 0x1.0p-53;
+    const double u = h_integral_n_ + uniform * (h_integral_x1_ - h_integral_n_);
+    const double x = h_integral_inverse(u);
+    const auto k = static_cast<uint64_t>(std::clamp(x + 0.5, 1.0, static_cast<double>(n_)));
+    if (static_cast<double>(k) - x <= s_ || u >= h_integral(static_cast<double>(k) + 0.5) - h(static_cast<double>(k))) {
+      return k - 1;
+    }
+    random_bits = lehmer64();
+  }
+}
+
+uint64_t spin_iterations_for(const uint64_t duration_ns) {
+  static const double iterations_per_ns = []() {
+    constexpr uint64_t num_calibration_iterations = 1ul << 22;
+    // Take the fastest of a few runs, so that a single interruption does not skew the calibration.
+    uint64_t min_duration_ns = std::numeric_limits<uint64_t>::max();
+    for (size_t run = 0; run < 3; ++run) {
+      const auto start = std::chrono::steady_clock::now();
+      spin(num_calibration_iterations);
+      const auto end = std::chrono::steady_clock::now();
+      min_duration_ns = std::min(min_duration_ns, duration_to_nanoseconds(end - start));
+    }
+    return static_cast<double>(num_calibration_iterations) / std::max<uint64_t>(min_duration_ns, 1);
+  }();
+  return std::max<uint64_t>(1, std::llround(duration_ns * iterations_per_ns));
+}
+
+double ZipfGenerator::h(const double x) const { return std::exp(-alpha_ * std::log(x)); }
+
+double ZipfGenerator::h_integral(const double x) const {
+  const double log_x = std::log(x);
+  return expm1_div_x((1.0 - alpha_) * log_x) * log_x;
+}
+
+double ZipfGenerator::h_integral_inverse(const double x) const {
+  const double t = std::max(x * (1.0 - alpha_), -1.0);
+  return std::exp(log1p_div_x(t) * x);
+}
+
 void crash_exit() { throw PermaException(); }
 
 std::string get_time_string() {
@@ -45,6 +45,54 @@ uint64_t duration_to_nanoseconds(std::chrono::steady_clock::duration duration);
 uint64_t zipf(double alpha, uint64_t n);
 double rand_val();
 
+/**
+ * Draws Zipf random variables in [0, n) without a table of all n probabilities, so that it also works for ranges with
+ * billions of values. Based on the rejection-inversion method by W. Hörmann and G. Derflinger, "Rejection-inversion to
+ * generate variates from monotone discrete distributions", ACM TOMACS 6.3 (1996).
+ */
+class ZipfGenerator {
+ public:
+  ZipfGenerator(double alpha, uint64_t n);
+
+  /** Uses `random_bits` for the first attempt and lehmer64() for rare rejected attempts. */
+  uint64_t sample(uint64_t random_bits) const;
+
+ private:
+  double h(double x) const;
+  double h_integral(double x) const;
+  double h_integral_inverse(double x) const;
+
+  const double alpha_;
+  const uint64_t n_;
+  double h_integral_x1_;
+  double h_integral_n_;
+  double s_;
+};
+
+/** Busy-waits for `iterations` rounds of a dependent multiply-add, which the compiler cannot remove. */
+inline void spin(const uint64_t iterations) {
+  uint64_t value = iterations;
+  for (uint64_t i = 0; i < iterations; ++i) {
+    value = value * 6364136223846793005ul + 1442695040888963407ul;
+    asm volatile("" : "+r"(value));
+  }
+}
+
+/** Returns the number of `spin` iterations that take `duration_ns` on this CPU. Calibrates the spin loop once. */
+uint64_t spin_iterations_for(uint64_t duration_ns);
+
+/** Applies `rounds` rounds of the 64-bit finalizer of MurmurHash3 to `value`. */
+inline uint64_t hash_rounds(uint64_t value, const uint64_t rounds) {
+  for (uint64_t round = 0; round < rounds; ++round) {
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdul;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ul;
+    value ^= value >> 33;
+  }
+  return value;
+}
+
 void crash_exit();
 void print_segfault_error();
 
@@ -5,9 +5,14 @@
 
 #include "gmock/gmock-matchers.h"
 #include "gtest/gtest.h"
+#include "loaded_latency_benchmark.hpp"
+#include "matrix_search_benchmark.hpp"
 #include "parallel_benchmark.hpp"
+#include "phased_benchmark.hpp"
 #include "single_benchmark.hpp"
+#include "slo_search_benchmark.hpp"
 #include "test_utils.hpp"
+#include "thread_ramp_benchmark.hpp"
 
 namespace perma {
 
@@ -319,6 +324,36 @@ TEST_F(BenchmarkTest, SetUpMultiThreadCustomPartition) {
   bm.get_benchmark_results()[0]->config.validate();
 }
 
+TEST_F(BenchmarkTest, SetUpMultiThreadColdCacheRanges) {
+  const size_t num_threads = 4;
+  base_config_.number_threads = num_threads;
+  base_config_.number_partitions = 2;
+  base_config_.access_size = 512;
+  base_config_.cache_state = CacheState::Cold;
+  base_executions_.reserve(1);
+  base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+  base_results_.reserve(1);
+  base_results_.push_back(std::make_unique<BenchmarkResult>(base_config_));
+  SingleBenchmark bm{bm_name_, base_config_, std::move(base_executions_), std::move(base_results_)};
+  bm.create_data_files();
+  bm.set_up();
+
+  // The two threads of each partition evict one half of it each.
+  const size_t share_size = TEST_FILE_SIZE / num_threads;
+  const std::vector<ThreadRunConfig>& thread_configs = bm.get_thread_configs()[0];
+  ASSERT_EQ(thread_configs.size(), num_threads);
+  const std::vector<std::chrono::steady_clock::duration>& durations =
+      bm.get_benchmark_results()[0]->cache_state_durations;
+  ASSERT_EQ(durations.size(), num_threads);
+  for (size_t thread_num = 0; thread_num < num_threads; ++thread_num) {
+    const ThreadRunConfig& thread_config = thread_configs[thread_num];
+    ASSERT_EQ(thread_config.cache_state_ranges.size(), 1);
+    EXPECT_EQ(thread_config.cache_state_ranges[0].start_addr, bm.get_pmem_data()[0] + (thread_num * share_size));
+    EXPECT_EQ(thread_config.cache_state_ranges[0].size, share_size);
+    EXPECT_EQ(thread_config.cache_state_duration, &durations[thread_num]);
+  }
+}
+
 TEST_F(BenchmarkTest, SetUpMultiThreadDefaultPartition) {
   const size_t num_threads = 4;
   base_config_.number_threads = num_threads;
@@ -468,6 +503,590 @@ TEST_F(BenchmarkTest, RunSingleThreadWrite) {
   check_file_written(bm.get_pmem_file(0), TEST_FILE_SIZE);
 }
 
+TEST_F(BenchmarkTest, RunSingleThreadReadModifyWrite) {
+  base_config_.number_threads = 1;
+  base_config_.access_size = 256;
+  base_config_.operation = Operation::ReadModifyWrite;
+  base_config_.persist_instruction = PersistInstruction::NoCache;
+  base_executions_.reserve(1);
+  base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+  base_results_.reserve(1);
+  base_results_.push_back(std::make_unique<BenchmarkResult>(base_config_));
+  SingleBenchmark bm{bm_name_, base_config_, std::move(base_executions_), std::move(base_results_)};
+
+  bm.create_data_files();
+  bm.set_up();
+
+  const auto* data = reinterpret_cast<const uint64_t*>(bm.get_pmem_data()[0]);
+  const size_t num_words = TEST_FILE_SIZE / sizeof(uint64_t);
+  const std::vector<uint64_t> original_data{data, data + num_words};
+
+  bm.run();
+
+  const std::vector<uint64_t>& op_sizes = bm.get_benchmark_results()[0]->total_operation_sizes;
+  EXPECT_THAT(op_sizes, ElementsAre(TEST_FILE_SIZE));
+
+  // Each word is read and incremented exactly once.
+  for (size_t word = 0; word < num_words; ++word) {
+    ASSERT_EQ(data[word], original_data[word] + 1) << "Wrong value at word " << word;
+  }
+}
+
+TEST_F(BenchmarkTest, RunSingleThreadReadModifyWriteChecksum) {
+  base_config_.number_threads = 1;
+  base_config_.access_size = 320;
+  base_config_.operation = Operation::ReadModifyWrite;
+  base_config_.persist_instruction = PersistInstruction::NoCache;
+  base_config_.checksum = Checksum::XxHash;
+  base_executions_.reserve(1);
+  base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+  base_results_.reserve(1);
+  base_results_.push_back(std::make_unique<BenchmarkResult>(base_config_));
+  SingleBenchmark bm{bm_name_, base_config_, std::move(base_executions_), std::move(base_results_)};
+
+  bm.create_data_files();
+  bm.set_up();
+
+  const auto* data = reinterpret_cast<const uint64_t*>(bm.get_pmem_data()[0]);
+  const size_t num_words = TEST_FILE_SIZE / sizeof(uint64_t);
+  const std::vector<uint64_t> original_data{data, data + num_words};
+
+  bm.run();
+
+  // The checksum kernel stores the modified data, so each accessed word is still incremented exactly once.
+  const size_t num_accessed_words = bm.get_benchmark_results()[0]->total_operation_sizes[0] / sizeof(uint64_t);
+  for (size_t word = 0; word < num_accessed_words; ++word) {
+    ASSERT_EQ(data[word], original_data[word] + 1) << "Wrong value at word " << word;
+  }
+}
+
+TEST_F(BenchmarkTest, RunSingleThreadStreamReadPrefetch) {
+  base_config_.number_threads = 1;
+  base_config_.access_size = 256;
+  base_config_.operation = Operation::Read;
+  base_config_.read_instruction = ReadInstruction::Stream;
+  base_config_.prefetch_distance = 8;
+  base_executions_.reserve(1);
+  base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+  base_results_.reserve(1);
+  base_results_.push_back(std::make_unique<BenchmarkResult>(base_config_));
+  SingleBenchmark bm{bm_name_, base_config_, std::move(base_executions_), std::move(base_results_)};
+
+  bm.create_data_files();
+  bm.set_up();
+  bm.run();
+
+  const std::vector<uint64_t>& op_sizes = bm.get_benchmark_results()[0]->total_operation_sizes;
+  EXPECT_THAT(op_sizes, ElementsAre(TEST_FILE_SIZE));
+}
+
+TEST_F(BenchmarkTest, RunSingleThreadMixedChecksum) {
+  base_config_.number_threads = 1;
+  base_config_.access_size = 4096;
+  base_config_.read_ratio = 0.5;
+  base_config_.persist_instruction = PersistInstruction::NoCache;
+  base_config_.checksum = Checksum::Crc32c;
+  base_executions_.reserve(1);
+  base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+  base_results_.reserve(1);
+  base_results_.push_back(std::make_unique<BenchmarkResult>(base_config_));
+  SingleBenchmark bm{bm_name_, base_config_, std::move(base_executions_), std::move(base_results_)};
+
+  bm.create_data_files();
+  bm.set_up();
+  bm.run();
+
+  const BenchmarkResult& result = *bm.get_benchmark_results()[0];
+  EXPECT_THAT(result.total_operation_sizes, ElementsAre(TEST_FILE_SIZE));
+  EXPECT_THAT(result.read_operation_sizes, ElementsAre(TEST_FILE_SIZE / 2));
+  EXPECT_EQ(result.config.as_json()["checksum"], "crc32c");
+}
+
+TEST_F(BenchmarkTest, RunSingleThreadWriteRandomLineData) {
+  base_config_.number_threads = 1;
+  base_config_.access_size = 512;
+  base_config_.operation = Operation::Write;
+  base_config_.memory_range = TEST_FILE_SIZE;
+  base_config_.data_pattern = DataPattern::RandomLine;
+  base_executions_.reserve(1);
+  base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+  base_results_.reserve(1);
+  base_results_.push_back(std::make_unique<BenchmarkResult>(base_config_));
+  SingleBenchmark bm{bm_name_, base_config_, std::move(base_executions_), std::move(base_results_)};
+
+  bm.create_data_files();
+  bm.set_up();
+  bm.run();
+
+  const BenchmarkResult& result = *bm.get_benchmark_results()[0];
+  EXPECT_THAT(result.total_operation_sizes, ElementsAre(TEST_FILE_SIZE));
+  EXPECT_EQ(result.config.as_json()["data_pattern"], "random_line");
+
+  // Each cache line of an access stores different random data instead of the constant WRITE_DATA.
+  const char* pmem_data = bm.get_pmem_data()[0];
+  EXPECT_NE(std::memcmp(pmem_data, rw_ops::WRITE_DATA, rw_ops::CACHE_LINE_SIZE), 0);
+  EXPECT_NE(std::memcmp(pmem_data, pmem_data + rw_ops::CACHE_LINE_SIZE, rw_ops::CACHE_LINE_SIZE), 0);
+}
+
+TEST_F(BenchmarkTest, RunSingleThreadCustomRandomOpData) {
+  const size_t num_chains = 4096;
+  base_config_.number_threads = 1;
+  base_config_.exec_mode = Mode::Custom;
+  base_config_.number_operations = num_chains;
+  base_config_.data_pattern = DataPattern::RandomOp;
+  base_config_.custom_operations = CustomOp::all_from_string("r_128,w_64_cache,w_256_nocache_crc32c");
+  base_executions_.reserve(1);
+  base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+  base_results_.reserve(1);
+  base_results_.push_back(std::make_unique<BenchmarkResult>(base_config_));
+  SingleBenchmark bm{bm_name_, base_config_, std::move(base_executions_), std::move(base_results_)};
+
+  bm.create_data_files();
+  bm.set_up();
+  bm.run();
+
+  const BenchmarkResult& result = *bm.get_benchmark_results()[0];
+  EXPECT_THAT(result.total_operation_sizes, ElementsAre(num_chains));
+}
+
+TEST_F(BenchmarkTest, RunSingleThreadRandomReadRateLimited) {
+  const size_t num_ops = 20000;
+  const double target_ops_per_second = 200000;
+  base_config_.number_threads = 1;
+  base_config_.exec_mode = Mode::Random;
+  base_config_.access_size = 256;
+  base_config_.number_operations = num_ops;
+  base_config_.target_ops_per_second = target_ops_per_second;
+  base_executions_.reserve(1);
+  base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+  base_results_.reserve(1);
+  base_results_.push_back(std::make_unique<BenchmarkResult>(base_config_));
+  SingleBenchmark bm{bm_name_, base_config_, std::move(base_executions_), std::move(base_results_)};
+
+  bm.create_data_files();
+  bm.set_up();
+  bm.run();
+
+  const BenchmarkResult& result = *bm.get_benchmark_results()[0];
+  ASSERT_EQ(result.operation_latencies.size(), 1);
+  const uint64_t num_run_ops = result.total_operation_sizes[0] / base_config_.access_size;
+  EXPECT_GE(num_run_ops, num_ops);
+  EXPECT_EQ(result.operation_latencies[0].size(), num_run_ops);
+
+  // The accesses start at their intended start, so the run takes at least as long as the schedule.
+  const nlohmann::json result_json = result.get_result_as_json()["results"];
+  EXPECT_GE(result_json["execution_time"].get<double>(), (num_ops - 1) / target_ops_per_second);
+  EXPECT_EQ(result_json["target_ops_per_second"], target_ops_per_second);
+  EXPECT_EQ(result_json["num_operations"], num_run_ops);
+  EXPECT_LE(result_json["ops_per_second"].get<double>(), target_ops_per_second * 1.01);
+  ASSERT_TRUE(result_json.contains("latency"));
+  EXPECT_GT(result_json["latency"]["max"].get<uint64_t>(), 0);
+}
+
+TEST_F(BenchmarkTest, RunMultiThreadCustomPoissonRateLimited) {
+  const size_t num_chains = 8192;
+  const size_t num_threads = 2;
+  base_config_.number_threads = num_threads;
+  base_config_.exec_mode = Mode::Custom;
+  base_config_.number_operations = num_chains;
+  base_config_.custom_operations = CustomOp::all_from_string("r_512,w_64_cache");
+  // 576 Byte per chain
+  base_config_.target_bandwidth = 576 * 100000;
+  base_config_.arrival_pattern = ArrivalPattern::Poisson;
+  base_executions_.reserve(1);
+  base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+  base_results_.reserve(1);
+  base_results_.push_back(std::make_unique<BenchmarkResult>(base_config_));
+  SingleBenchmark bm{bm_name_, base_config_, std::move(base_executions_), std::move(base_results_)};
+
+  bm.create_data_files();
+  bm.set_up();
+  bm.run();
+
+  const BenchmarkResult& result = *bm.get_benchmark_results()[0];
+  EXPECT_EQ(result.target_ops_per_second, 100000);
+  EXPECT_TRUE(result.operation_latencies.empty());
+  ASSERT_EQ(result.custom_operation_latencies.size(), num_threads);
+  EXPECT_EQ(result.custom_operation_latencies[0].size(), result.total_operation_sizes[0]);
+  EXPECT_EQ(result.custom_operation_latencies[1].size(), result.total_operation_sizes[1]);
+
+  const nlohmann::json result_json = result.get_result_as_json()["results"];
+  EXPECT_EQ(result_json["num_operations"], num_chains);
+  EXPECT_EQ(result_json["target_ops_per_second"], 100000);
+  ASSERT_TRUE(result_json.contains("latency"));
+
+  const nlohmann::json config_json = result.config.as_json();
+  EXPECT_EQ(config_json["target_bandwidth"], 576 * 100000);
+  EXPECT_EQ(config_json["arrival_pattern"], "poisson");
+}
+
+TEST_F(BenchmarkTest, RunMultiThreadReadColdCache) {
+  const size_t num_threads = 2;
+  base_config_.number_threads = num_threads;
+  base_config_.access_size = 1024;
+  base_config_.cache_state = CacheState::Cold;
+  base_executions_.reserve(1);
+  base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+  base_results_.reserve(1);
+  base_results_.push_back(std::make_unique<BenchmarkResult>(base_config_));
+  SingleBenchmark bm{bm_name_, base_config_, std::move(base_executions_), std::move(base_results_)};
+
+  bm.create_data_files();
+  bm.set_up();
+  bm.run();
+
+  const BenchmarkResult& result = *bm.get_benchmark_results()[0];
+  EXPECT_EQ(result.config.as_json()["cache_state"], "cold");
+
+  const nlohmann::json result_json = result.get_result_as_json()["results"];
+  EXPECT_EQ(result_json["accessed_bytes"], TEST_FILE_SIZE);
+  ASSERT_TRUE(result_json.contains("cache_state_time"));
+  EXPECT_GT(result_json["cache_state_time"].get<double>(), 0);
+  ASSERT_EQ(result_json["threads"].size(), num_threads);
+  EXPECT_LE(result_json["threads"][0]["cache_state_time"].get<double>(), result_json["cache_state_time"]);
+}
+
+TEST_F(BenchmarkTest, RunMultiThreadCustomWarmCache) {
+  const size_t num_chains = 4096;
+  const size_t num_threads = 2;
+  base_config_.number_threads = num_threads;
+  base_config_.exec_mode = Mode::Custom;
+  base_config_.number_operations = num_chains;
+  base_config_.custom_operations = CustomOp::all_from_string("r_512,w_64_cache");
+  base_config_.cache_state = CacheState::Warm;
+  base_executions_.reserve(1);
+  base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+  base_results_.reserve(1);
+  base_results_.push_back(std::make_unique<BenchmarkResult>(base_config_));
+  SingleBenchmark bm{bm_name_, base_config_, std::move(base_executions_), std::move(base_results_)};
+
+  bm.create_data_files();
+  bm.set_up();
+  bm.run();
+
+  const BenchmarkResult& result = *bm.get_benchmark_results()[0];
+  ASSERT_EQ(result.cache_state_durations.size(), num_threads);
+  const nlohmann::json result_json = result.get_result_as_json()["results"];
+  EXPECT_EQ(result_json["num_operations"], num_chains);
+  EXPECT_TRUE(result_json.contains("cache_state_time"));
+  EXPECT_TRUE(result_json["threads"][1].contains("cache_state_time"));
+}
+
+TEST_F(BenchmarkTest, RunSingleThreadWriteFenceBatching) {
+  base_config_.number_threads = 1;
+  base_config_.access_size = 64;
+  base_config_.operation = Operation::Write;
+  base_config_.persist_instruction = PersistInstruction::Cache;
+  base_config_.fence_every = 16;
+  base_executions_.reserve(1);
+  base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+  base_results_.reserve(1);
+  base_results_.push_back(std::make_unique<BenchmarkResult>(base_config_));
+  SingleBenchmark bm{bm_name_, base_config_, std::move(base_executions_), std::move(base_results_)};
+
+  bm.create_data_files();
+  bm.set_up();
+  bm.run();
+
+  const std::vector<uint64_t>& op_sizes = bm.get_benchmark_results()[0]->total_operation_sizes;
+  EXPECT_THAT(op_sizes, ElementsAre(TEST_FILE_SIZE));
+
+  check_file_written(bm.get_pmem_file(0), TEST_FILE_SIZE);
+}
+
+TEST_F(BenchmarkTest, RunSingleThreadWriteUnaligned) {
+  const size_t access_size = 320;
+  const size_t alignment_offset = 32;
+  base_config_.number_threads = 1;
+  base_config_.access_size = access_size;
+  base_config_.alignment_offset = alignment_offset;
+  base_config_.operation = Operation::Write;
+  base_config_.persist_instruction = PersistInstruction::NoCache;
+  base_executions_.reserve(1);
+  base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+  base_results_.reserve(1);
+  base_results_.push_back(std::make_unique<BenchmarkResult>(base_config_));
+  SingleBenchmark bm{bm_name_, base_config_, std::move(base_executions_), std::move(base_results_)};
+
+  bm.create_data_files();
+  bm.set_up();
+  bm.run();
+
+  // Only full accesses fit into a chunk: 409 ops per chunk and 8 full chunks in the shifted range.
+  const size_t ops_per_chunk = TEST_CHUNK_SIZE / access_size;
+  const size_t num_chunks = ((TEST_FILE_SIZE - alignment_offset) / access_size) / ops_per_chunk;
+  const size_t expected_size = num_chunks * ops_per_chunk * access_size;
+
+  const std::vector<uint64_t>& op_sizes = bm.get_benchmark_results()[0]->total_operation_sizes;
+  EXPECT_THAT(op_sizes, ElementsAre(expected_size));
+
+  check_range_written(bm.get_pmem_file(0), alignment_offset, expected_size);
+}
+
+TEST_F(BenchmarkTest, RunSingleThreadRandomWriteSizeDistribution) {
+  base_config_.number_threads = 1;
+  base_config_.exec_mode = Mode::Random;
+  base_config_.operation = Operation::Write;
+  base_config_.persist_instruction = PersistInstruction::NoCache;
+  base_config_.number_operations = 2048;
+  base_config_.access_size_distribution = SizeDistribution::Uniform;
+  base_config_.min_access_size = 64;
+  base_config_.max_access_size = 1023;
+  base_executions_.reserve(1);
+  base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+  base_results_.reserve(1);
+  base_results_.push_back(std::make_unique<BenchmarkResult>(base_config_));
+  SingleBenchmark bm{bm_name_, base_config_, std::move(base_executions_), std::move(base_results_)};
+
+  bm.create_data_files();
+  bm.set_up();
+  bm.run();
+
+  const BenchmarkResult& result = *bm.get_benchmark_results()[0];
+  const ThreadRunConfig& thread_config = bm.get_thread_configs()[0][0];
+  ASSERT_EQ(result.size_bucket_counters.size(), 1);
+  const SizeBucketCounters& counters = result.size_bucket_counters[0];
+  EXPECT_EQ(counters.total_operations(), thread_config.num_chunks * thread_config.num_ops_per_chunk);
+  EXPECT_THAT(result.total_operation_sizes, ElementsAre(counters.total_bytes()));
+
+  // All sizes are in [64, 1023], i.e., in the buckets 2^6 to 2^9.
+  for (size_t bucket = 0; bucket < NUM_SIZE_BUCKETS; ++bucket) {
+    if (bucket < 6 || bucket > 9) {
+      EXPECT_EQ(counters.num_operations[bucket], 0);
+    } else {
+      EXPECT_GT(counters.num_operations[bucket], 0);
+    }
+  }
+
+  const nlohmann::json result_json = result.get_result_as_json();
+  EXPECT_EQ(result_json["results"]["num_operations"], counters.total_operations());
+  EXPECT_EQ(result_json["results"]["size_buckets"].size(), 4);
+}
+
+TEST_F(BenchmarkTest, RunSingleThreadCustomVariableSize) {
+  const size_t num_chains = 4096;
+  base_config_.number_threads = 1;
+  base_config_.exec_mode = Mode::Custom;
+  base_config_.number_operations = num_chains;
+  base_config_.custom_operations = CustomOp::all_from_string("r_64,w_*_none");
+  base_config_.access_size_distribution = SizeDistribution::Uniform;
+  base_config_.min_access_size = 1;
+  base_config_.max_access_size = 512;
+  base_executions_.reserve(1);
+  base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+  base_results_.reserve(1);
+  base_results_.push_back(std::make_unique<BenchmarkResult>(base_config_));
+  SingleBenchmark bm{bm_name_, base_config_, std::move(base_executions_), std::move(base_results_)};
+
+  bm.create_data_files();
+  bm.set_up();
+  bm.run();
+
+  const BenchmarkResult& result = *bm.get_benchmark_results()[0];
+  EXPECT_THAT(result.total_operation_sizes, ElementsAre(num_chains));
+
+  // Each chain performs exactly one variable-sized write.
+  ASSERT_EQ(result.size_bucket_counters.size(), 1);
+  const SizeBucketCounters& counters = result.size_bucket_counters[0];
+  EXPECT_EQ(counters.total_operations(), num_chains);
+
+  const nlohmann::json result_json = result.get_result_as_json();
+  EXPECT_EQ(result_json["results"]["accessed_bytes"], (num_chains * 64) + counters.total_bytes());
+  EXPECT_GT(result_json["results"]["bandwidth"], 0);
+}
+
+TEST_F(BenchmarkTest, RunSingleThreadCustomStreamPrefetchFence) {
+  const size_t num_chains = 4096;
+  base_config_.number_threads = 1;
+  base_config_.exec_mode = Mode::Custom;
+  base_config_.number_operations = num_chains;
+  base_config_.custom_operations = CustomOp::all_from_string("r_128_stream,p_128_nta_128,w_64_cache,w_64_cache_64,f");
+  base_executions_.reserve(1);
+  base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+  base_results_.reserve(1);
+  base_results_.push_back(std::make_unique<BenchmarkResult>(base_config_));
+  SingleBenchmark bm{bm_name_, base_config_, std::move(base_executions_), std::move(base_results_)};
+
+  bm.create_data_files();
+  bm.set_up();
+  bm.run();
+
+  const BenchmarkResult& result = *bm.get_benchmark_results()[0];
+  EXPECT_THAT(result.total_operation_sizes, ElementsAre(num_chains));
+}
+
+TEST_F(BenchmarkTest, RunSingleThreadCustomChecksums) {
+  const size_t num_chains = 4096;
+  base_config_.number_threads = 1;
+  base_config_.exec_mode = Mode::Custom;
+  base_config_.number_operations = num_chains;
+  base_config_.custom_operations = CustomOp::all_from_string("r_64,r_4096_xxhash,w_4096_nocache_crc32c");
+  base_executions_.reserve(1);
+  base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+  base_results_.reserve(1);
+  base_results_.push_back(std::make_unique<BenchmarkResult>(base_config_));
+  SingleBenchmark bm{bm_name_, base_config_, std::move(base_executions_), std::move(base_results_)};
+
+  bm.create_data_files();
+  bm.set_up();
+  bm.run();
+
+  const BenchmarkResult& result = *bm.get_benchmark_results()[0];
+  EXPECT_THAT(result.total_operation_sizes, ElementsAre(num_chains));
+}
+
+TEST_F(BenchmarkTest, RunSingleThreadCustomSequentialRelativeReads) {
+  const size_t num_chains = 4096;
+  base_config_.number_threads = 1;
+  base_config_.exec_mode = Mode::Custom;
+  base_config_.number_operations = num_chains;
+  base_config_.custom_operations = CustomOp::all_from_string("rs_256,r_64,r_64_64,r_64_-64,w_64_cache_64");
+  base_executions_.reserve(1);
+  base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+  base_results_.reserve(1);
+  base_results_.push_back(std::make_unique<BenchmarkResult>(base_config_));
+  SingleBenchmark bm{bm_name_, base_config_, std::move(base_executions_), std::move(base_results_)};
+
+  bm.create_data_files();
+  bm.set_up();
+  bm.run();
+
+  const BenchmarkResult& result = *bm.get_benchmark_results()[0];
+  EXPECT_THAT(result.total_operation_sizes, ElementsAre(num_chains));
+}
+
+TEST_F(BenchmarkTest, RunMultiThreadCustomRegions) {
+  const size_t num_chains = 8192;
+  const size_t num_threads = 2;
+  base_config_.number_threads = num_threads;
+  base_config_.number_partitions = 0;
+  base_config_.exec_mode = Mode::Custom;
+  base_config_.number_operations = num_chains;
+  base_config_.custom_regions = {
+      CustomRegion{.name = "idx", .size = 64 * 1024, .is_pmem = false, .distribution = RandomDistribution::Zipf},
+      CustomRegion{.name = "log", .size = TEST_FILE_SIZE}};
+  base_config_.custom_operations = CustomOp::all_from_string("r(idx)_256,r_64,rs(log)_64,w(log)_64_cache_64");
+  base_executions_.reserve(1);
+  base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+  base_results_.reserve(1);
+  base_results_.push_back(std::make_unique<BenchmarkResult>(base_config_));
+  SingleBenchmark bm{bm_name_, base_config_, std::move(base_executions_), std::move(base_results_)};
+
+  bm.create_data_files();
+  ASSERT_EQ(bm.get_custom_region_data().size(), 1);
+  const std::vector<char*>& region_data = bm.get_custom_region_data()[0];
+  ASSERT_EQ(region_data.size(), 2);
+  EXPECT_NE(region_data[0], nullptr);
+  EXPECT_NE(region_data[1], nullptr);
+
+  bm.set_up();
+  const std::vector<ThreadRunConfig>& thread_configs = bm.get_thread_configs()[0];
+  ASSERT_EQ(thread_configs.size(), num_threads);
+  const ThreadRunConfig& thread_config1 = thread_configs[1];
+  ASSERT_EQ(thread_config1.custom_region_partitions.size(), 2);
+  EXPECT_EQ(thread_config1.custom_region_partitions[0].start_addr, region_data[0] + (32 * 1024));
+  EXPECT_EQ(thread_config1.custom_region_partitions[0].size, 32 * 1024);
+  EXPECT_EQ(thread_config1.custom_region_partitions[1].start_addr, region_data[1] + (TEST_FILE_SIZE / 2));
+  EXPECT_EQ(thread_config1.custom_region_partitions[1].size, TEST_FILE_SIZE / 2);
+
+  bm.run();
+
+  const BenchmarkResult& result = *bm.get_benchmark_results()[0];
+  uint64_t total_num_chains = 0;
+  for (const uint64_t thread_num_chains : result.total_operation_sizes) {
+    total_num_chains += thread_num_chains;
+  }
+  EXPECT_GE(total_num_chains, num_chains);
+}
+
+TEST_F(BenchmarkTest, RunMultiThreadCustomChainMixture) {
+  const size_t num_chains = 8192;
+  const size_t num_threads = 2;
+  base_config_.number_threads = num_threads;
+  base_config_.exec_mode = Mode::Custom;
+  base_config_.number_operations = num_chains;
+  base_config_.latency_sample_frequency = 16;
+  base_config_.custom_chain_mixture = WeightedCustomChain::all_from_string("0.9: r_512 | 0.1: r_512,w_64_cache_64");
+  base_executions_.reserve(1);
+  base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+  base_results_.reserve(1);
+  base_results_.push_back(std::make_unique<BenchmarkResult>(base_config_));
+  SingleBenchmark bm{bm_name_, base_config_, std::move(base_executions_), std::move(base_results_)};
+
+  bm.create_data_files();
+  bm.set_up();
+  bm.run();
+
+  const BenchmarkResult& result = *bm.get_benchmark_results()[0];
+  ASSERT_EQ(result.custom_chain_operations.size(), num_threads * 2);
+  const uint64_t num_lookups = result.custom_chain_operations[0] + result.custom_chain_operations[2];
+  const uint64_t num_updates = result.custom_chain_operations[1] + result.custom_chain_operations[3];
+  EXPECT_EQ(num_lookups + num_updates, result.total_operation_sizes[0] + result.total_operation_sizes[1]);
+  EXPECT_GT(num_lookups, num_updates);
+  EXPECT_GT(num_updates, 0);
+
+  const nlohmann::json json = result.get_result_as_json();
+  const nlohmann::json& chain_results = json["results"]["chains"];
+  ASSERT_EQ(chain_results.size(), 2);
+  EXPECT_EQ(chain_results[0]["num_operations"], num_lookups);
+  EXPECT_EQ(chain_results[1]["num_operations"], num_updates);
+  EXPECT_EQ(chain_results[1]["custom_operations"], "rp_512,wp_64_cache_64");
+  EXPECT_TRUE(chain_results[0].contains("latency"));
+}
+
+TEST_F(BenchmarkTest, RunSingleThreadCustomCompute) {
+  const size_t num_chains = 4096;
+  base_config_.number_threads = 1;
+  base_config_.exec_mode = Mode::Custom;
+  base_config_.number_operations = num_chains;
+  base_config_.custom_operations = CustomOp::all_from_string("r_64,h_4,r_256,c_200,w_64_cache");
+  base_executions_.reserve(1);
+  base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+  base_results_.reserve(1);
+  base_results_.push_back(std::make_unique<BenchmarkResult>(base_config_));
+  SingleBenchmark bm{bm_name_, base_config_, std::move(base_executions_), std::move(base_results_)};
+
+  bm.create_data_files();
+  bm.set_up();
+  ASSERT_NE(bm.get_thread_configs()[0][0].compute_overlaps, nullptr);
+  bm.run();
+
+  const BenchmarkResult& result = *bm.get_benchmark_results()[0];
+  EXPECT_THAT(result.total_operation_sizes, ElementsAre(num_chains));
+  ASSERT_EQ(result.custom_compute_overlaps.size(), 1);
+  const ComputeOverlap& overlap = result.custom_compute_overlaps[0];
+  EXPECT_GT(overlap.memory_only_ns, 0);
+  EXPECT_GT(overlap.compute_only_ns, 0);
+  EXPECT_GT(overlap.combined_ns, 0);
+
+  const nlohmann::json json = result.get_result_as_json();
+  const nlohmann::json& overlap_json = json["results"]["compute_overlap"];
+  EXPECT_GE(overlap_json["overlap_ns"], 0);
+  EXPECT_GE(overlap_json["overlapped_memory_ratio"], 0);
+  EXPECT_LE(overlap_json["overlapped_memory_ratio"], 1);
+}
+
+TEST_F(BenchmarkTest, RunSingleThreadCustomInterleavedChains) {
+  const size_t num_chains = 4096;
+  base_config_.number_threads = 1;
+  base_config_.exec_mode = Mode::Custom;
+  base_config_.number_operations = num_chains;
+  base_config_.custom_operations = CustomOp::all_from_string("r_512,r_512,w_64_cache,p_64_t0_64,r_256");
+  base_config_.mlp_width = 4;
+  base_executions_.reserve(1);
+  base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+  base_results_.reserve(1);
+  base_results_.push_back(std::make_unique<BenchmarkResult>(base_config_));
+  SingleBenchmark bm{bm_name_, base_config_, std::move(base_executions_), std::move(base_results_)};
+
+  bm.create_data_files();
+  bm.set_up();
+  bm.run();
+
+  const BenchmarkResult& result = *bm.get_benchmark_results()[0];
+  EXPECT_THAT(result.total_operation_sizes, ElementsAre(num_chains));
+}
+
 TEST_F(BenchmarkTest, RunSingleThreadWriteDRAM) {
   const size_t num_ops = TEST_FILE_SIZE / 64;
   const size_t total_size = 64 * num_ops;
@@ -501,14 +1120,14 @@ TEST_F(BenchmarkTest, RunSingleThreadWriteDRAM) {
 }
 
 // TODO(#167): Change "mixed" to DRAM/PMem
-TEST_F(BenchmarkTest, DISABLED_RunSingeThreadMixed) {
-  const size_t ops_per_chunk = TEST_FILE_SIZE / 256;
+TEST_F(BenchmarkTest, RunSingleThreadMixed) {
+  const size_t ops_per_chunk = TEST_CHUNK_SIZE / 256;
   const size_t num_chunks = 8;
   const size_t num_ops = num_chunks * ops_per_chunk;
   base_config_.number_threads = 1;
   base_config_.access_size = 256;
-  // TODO: change
-  //  base_config_.write_ratio = 0.5;
+  base_config_.read_ratio = 0.75;
+  base_config_.persist_instruction = PersistInstruction::NoCache;
   base_config_.number_operations = num_ops;
   base_config_.exec_mode = Mode::Random;
   base_config_.memory_range = 256 * num_ops;
@@ -524,8 +1143,6 @@ TEST_F(BenchmarkTest, DISABLED_RunSingeThreadMixed) {
   bm.set_up();
   bm.run();
 
-  const BenchmarkResult& result = *bm.get_benchmark_results()[0];
-
   const std::vector<ExecutionDuration>& op_durations = bm.get_benchmark_results()[0]->total_operation_durations;
   ASSERT_EQ(op_durations.size(), 1);
   EXPECT_GT(op_durations[0].begin, start_test_ts);
@@ -533,8 +1150,11 @@ TEST_F(BenchmarkTest, DISABLED_RunSingeThreadMixed) {
   EXPECT_LT(op_durations[0].begin, op_durations[0].end);
 
   const std::vector<uint64_t>& op_sizes = bm.get_benchmark_results()[0]->total_operation_sizes;
-  uint64_t dummy_value_to_fail = 12346;
-  EXPECT_THAT(op_sizes, ElementsAre(dummy_value_to_fail));
+  EXPECT_THAT(op_sizes, ElementsAre(num_ops * 256));
+
+  // The interleaved pattern (RRRW) results in exactly 75% reads.
+  const std::vector<uint64_t>& read_sizes = bm.get_benchmark_results()[0]->read_operation_sizes;
+  EXPECT_THAT(read_sizes, ElementsAre((num_ops * 256 / 4) * 3));
 }
 
 TEST_F(BenchmarkTest, RunMultiThreadRead) {
@@ -733,43 +1353,35 @@ TEST_F(BenchmarkTest, ResultsSingleThreadWrite) {
 }
 
 // TODO(#167): Change "mixed" to DRAM/PMem
-TEST_F(BenchmarkTest, DISABLED_ResultsSingleThreadMixed) {
-  const size_t ops_per_chunk = TEST_FILE_SIZE / 512;
-  const size_t num_chunks = 8;
-  const size_t num_ops = num_chunks * ops_per_chunk;
-  const size_t total_size = 512 * num_ops;
+TEST_F(BenchmarkTest, ResultsSingleThreadMixed) {
+  const size_t num_ops = TEST_FILE_SIZE / 512;
   base_config_.number_operations = num_ops;
   base_config_.number_threads = 1;
   base_config_.access_size = 512;
-  // TODO: change
-  //   base_config_.write_ratio = 0.5;
-  base_config_.memory_range = total_size;
+  base_config_.read_ratio = 0.75;
+  base_config_.memory_range = TEST_FILE_SIZE;
   base_config_.exec_mode = Mode::Random;
 
   BenchmarkResult bm_result{base_config_};
-  //  std::vector<Latency> latencies{};
-  //  latencies.reserve(num_ops);
-  //  for (size_t i = 0; i < num_ops; ++i) {
-  //    if (i % 2 == 0) {
-  //      latencies.emplace_back(200 * ops_per_chunk, Operation::Write);
-  //    } else {
-  //      latencies.emplace_back(100 * ops_per_chunk, Operation::Read);
-  //    }
-  //  }
-  //  bm_result.latencies.emplace_back(latencies);
+  const uint64_t total_op_duration = 1000000;
+  const auto start = std::chrono::steady_clock::now();
+  const auto end = start + std::chrono::nanoseconds(total_op_duration);
+  bm_result.total_operation_durations.push_back({start, end});
+  bm_result.total_operation_sizes.emplace_back(TEST_FILE_SIZE);
+  bm_result.read_operation_sizes.emplace_back((TEST_FILE_SIZE / 4) * 3);
 
   const nlohmann::json& result_json = bm_result.get_result_as_json();
-  ASSERT_JSON_EQ(result_json, size(), 1);
-  ASSERT_JSON_TRUE(result_json, contains("bandwidth"));
-
-  const nlohmann::json& bandwidth_json = result_json["bandwidth"];
-  ASSERT_JSON_EQ(bandwidth_json, size(), 2);
-  ASSERT_JSON_TRUE(bandwidth_json, contains("read"));
-  ASSERT_JSON_TRUE(bandwidth_json, contains("write"));
-  ASSERT_JSON_TRUE(bandwidth_json, at("read").is_number());
-  ASSERT_JSON_TRUE(bandwidth_json, at("write").is_number());
-  EXPECT_NEAR(bandwidth_json.at("read").get<double>(), 2.384185, 0.1);
-  EXPECT_NEAR(bandwidth_json.at("write").get<double>(), 1.192095, 0.1);
+  ASSERT_JSON_TRUE(result_json, contains("results"));
+  const nlohmann::json& results_json = result_json["results"];
+  EXPECT_NEAR(results_json.at("bandwidth").get<double>(), 0.9765625, 0.001);
+  EXPECT_NEAR(results_json.at("read_bandwidth").get<double>(), 0.732421875, 0.001);
+  EXPECT_NEAR(results_json.at("write_bandwidth").get<double>(), 0.244140625, 0.001);
+  EXPECT_EQ(results_json.at("read_accessed_bytes").get<uint64_t>(), (TEST_FILE_SIZE / 4) * 3);
+  EXPECT_EQ(results_json.at("write_accessed_bytes").get<uint64_t>(), TEST_FILE_SIZE / 4);
+
+  ASSERT_JSON_EQ(results_json, at("threads").size(), 1);
+  EXPECT_NEAR(results_json["threads"][0].at("read_bandwidth").get<double>(), 0.732421875, 0.001);
+  EXPECT_NEAR(results_json["threads"][0].at("write_bandwidth").get<double>(), 0.244140625, 0.001);
 }
 
 TEST_F(BenchmarkTest, ResultsMultiThreadRead) {
@@ -817,46 +1429,33 @@ TEST_F(BenchmarkTest, ResultsMultiThreadWrite) {
 }
 
 // TODO(#167): Change "mixed" to DRAM/PMem
-TEST_F(BenchmarkTest, DISABLED_ResultsMultiThreadMixed) {
-  const size_t ops_per_chunk = TEST_FILE_SIZE / 512;
-  const size_t num_chunks = 64;
-  const size_t num_ops = num_chunks * ops_per_chunk;
+TEST_F(BenchmarkTest, ResultsMultiThreadMixed) {
   const size_t num_threads = 16;
-  const size_t num_ops_per_thread = num_ops / num_threads;
-  const size_t total_size = 512 * num_ops;
+  const size_t num_ops = TEST_FILE_SIZE / 512;
   base_config_.number_threads = num_threads;
   base_config_.number_operations = num_ops;
   base_config_.access_size = 512;
-  // TODO: change
-  //   base_config_.write_ratio = 0.5;
-  base_config_.memory_range = total_size;
+  base_config_.read_ratio = 0.75;
+  base_config_.memory_range = TEST_FILE_SIZE;
   base_config_.exec_mode = Mode::Random;
 
   BenchmarkResult bm_result{base_config_};
-  //  for (size_t thread = 0; thread < num_threads; ++thread) {
-  //    std::vector<Latency> latencies{};
-  //    for (size_t i = 0; i < num_ops_per_thread; ++i) {
-  //      if (i % 2 == 0) {
-  //        latencies.emplace_back(500 * ops_per_chunk, Operation::Write);
-  //      } else {
-  //        latencies.emplace_back(400 * ops_per_chunk, Operation::Read);
-  //      }
-  //    }
-  //    bm_result.latencies.emplace_back(latencies);
-  //  }
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t thread = 0; thread < num_threads; ++thread) {
+    const uint64_t thread_dur = (250000 + (10000 * thread));
+    const auto end = start + std::chrono::nanoseconds(thread_dur);
+    bm_result.total_operation_durations.push_back({start, end});
+    bm_result.total_operation_sizes.emplace_back(TEST_FILE_SIZE / num_threads);
+    bm_result.read_operation_sizes.emplace_back((TEST_FILE_SIZE / num_threads / 4) * 3);
+  }
 
   const nlohmann::json& result_json = bm_result.get_result_as_json();
-  ASSERT_JSON_EQ(result_json, size(), 1);
-  ASSERT_JSON_TRUE(result_json, contains("bandwidth"));
-
-  const nlohmann::json& bandwidth_json = result_json["bandwidth"];
-  ASSERT_JSON_EQ(bandwidth_json, size(), 2);
-  ASSERT_JSON_TRUE(bandwidth_json, contains("read"));
-  ASSERT_JSON_TRUE(bandwidth_json, contains("write"));
-  ASSERT_JSON_TRUE(bandwidth_json, at("read").is_number());
-  ASSERT_JSON_TRUE(bandwidth_json, at("write").is_number());
-  EXPECT_NEAR(bandwidth_json.at("read").get<double>(), 9.535, 0.1);
-  EXPECT_NEAR(bandwidth_json.at("write").get<double>(), 7.625, 0.1);
+  ASSERT_JSON_TRUE(result_json, contains("results"));
+  const nlohmann::json& results_json = result_json["results"];
+  EXPECT_NEAR(results_json.at("bandwidth").get<double>(), 2.44140625, 0.001);
+  EXPECT_NEAR(results_json.at("read_bandwidth").get<double>(), 1.8310546875, 0.001);
+  EXPECT_NEAR(results_json.at("write_bandwidth").get<double>(), 0.6103515625, 0.001);
+  ASSERT_JSON_EQ(results_json, at("threads").size(), num_threads);
 }
 
 TEST_F(BenchmarkTest, RunParallelSingleThreadRead) {
@@ -909,6 +1508,519 @@ TEST_F(BenchmarkTest, RunParallelSingleThreadRead) {
   EXPECT_EQ(all_sizes_two[0] % TEST_CHUNK_SIZE, 0);
 }
 
+TEST_F(BenchmarkTest, RunParallelThreeSubBenchmarks) {
+  base_config_.number_threads = 1;
+  base_config_.run_time = 1;
+  BenchmarkConfig writer_config = base_config_;
+  writer_config.operation = Operation::Write;
+  BenchmarkConfig reader_config = base_config_;
+  reader_config.operation = Operation::Read;
+  BenchmarkConfig random_config = base_config_;
+  random_config.exec_mode = Mode::Random;
+  random_config.operation = Operation::Read;
+  random_config.number_operations = TEST_FILE_SIZE / random_config.access_size;
+  const std::vector<BenchmarkConfig> configs{writer_config, reader_config, random_config};
+
+  for (const BenchmarkConfig& config : configs) {
+    base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+    base_results_.push_back(std::make_unique<BenchmarkResult>(config));
+  }
+
+  const std::filesystem::path reused_pmem_file = utils::generate_random_file_name(temp_dir_);
+  ParallelBenchmark bm{bm_name_,
+                       {"writer", "reader", "random_reader"},
+                       configs,
+                       std::move(base_executions_),
+                       std::move(base_results_),
+                       {{}, reused_pmem_file, {}}};
+  EXPECT_TRUE(bm.owns_pmem_file(0));
+  EXPECT_FALSE(bm.owns_pmem_file(1));
+  EXPECT_EQ(bm.get_pmem_file(1), reused_pmem_file);
+  EXPECT_TRUE(bm.owns_pmem_file(2));
+
+  bm.create_data_files();
+  bm.set_up();
+  ASSERT_EQ(bm.get_pmem_data().size(), 3);
+  ASSERT_EQ(bm.get_thread_configs().size(), 3);
+  ASSERT_TRUE(bm.run());
+
+  const nlohmann::json result_json = bm.get_result_as_json();
+  for (const char* sub_bm_name : {"writer", "reader", "random_reader"}) {
+    ASSERT_TRUE(result_json["config"].contains(sub_bm_name));
+    EXPECT_GT(result_json["results"][sub_bm_name]["results"]["bandwidth"].get<double>(), 0);
+  }
+  EXPECT_EQ(result_json["config"]["random_reader"]["exec_mode"], "random");
+  bm.tear_down(/*force=*/true);
+}
+
+TEST_F(BenchmarkTest, RunParallelOverlapWindow) {
+  base_config_.number_threads = 2;
+  base_config_.run_time = 1;
+  BenchmarkConfig reader_config = base_config_;
+  reader_config.operation = Operation::Read;
+  BenchmarkConfig writer_config = base_config_;
+  writer_config.operation = Operation::Write;
+  const std::vector<BenchmarkConfig> configs{reader_config, writer_config};
+
+  for (const BenchmarkConfig& config : configs) {
+    base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+    base_results_.push_back(std::make_unique<BenchmarkResult>(config));
+  }
+
+  ParallelBenchmark bm{bm_name_, {"reader", "writer"}, configs, std::move(base_executions_), std::move(base_results_),
+                       std::vector<std::filesystem::path>(2)};
+  bm.create_data_files();
+  bm.set_up();
+  ASSERT_TRUE(bm.run());
+
+  // All threads of both sub-benchmarks start their measurement at the same time.
+  std::vector<std::chrono::steady_clock::time_point> begins;
+  for (const std::unique_ptr<BenchmarkResult>& bm_result : bm.get_benchmark_results()) {
+    ASSERT_EQ(bm_result->overlap_operation_sizes.size(), 2);
+    for (const ExecutionDuration& thread_duration : bm_result->total_operation_durations) {
+      begins.push_back(thread_duration.begin);
+    }
+  }
+  const auto [first_begin, last_begin] = std::minmax_element(begins.begin(), begins.end());
+  EXPECT_LT(*last_begin - *first_begin, std::chrono::milliseconds{200});
+
+  const nlohmann::json result_json = bm.get_result_as_json();
+  for (const char* sub_bm_name : {"reader", "writer"}) {
+    const nlohmann::json& sub_bm_results = result_json["results"][sub_bm_name]["results"];
+    ASSERT_TRUE(sub_bm_results.contains("overlap"));
+    ASSERT_TRUE(sub_bm_results.contains("solo_tail"));
+    EXPECT_EQ(sub_bm_results["overlap"]["accessed_bytes"].get<uint64_t>() +
+                  sub_bm_results["solo_tail"]["accessed_bytes"].get<uint64_t>(),
+              sub_bm_results["accessed_bytes"].get<uint64_t>());
+    EXPECT_GT(sub_bm_results["overlap"]["bandwidth"].get<double>(), 0);
+    EXPECT_LE(sub_bm_results["overlap"]["execution_time"].get<double>(),
+              sub_bm_results["execution_time"].get<double>());
+  }
+
+  // Both sub-benchmarks run for the same time, so they overlap for nearly all of it.
+  EXPECT_GT(result_json["results"]["reader"]["results"]["overlap"]["execution_time"].get<double>(), 0.5);
+  bm.tear_down(/*force=*/true);
+}
+
+TEST_F(BenchmarkTest, RunParallelSharedRegion) {
+  base_config_.number_threads = 1;
+  BenchmarkConfig writer_config = base_config_;
+  writer_config.operation = Operation::Write;
+  BenchmarkConfig reader_config = base_config_;
+  reader_config.operation = Operation::Read;
+  reader_config.memory_range = TEST_FILE_SIZE / 2;
+  reader_config.region_offset = TEST_FILE_SIZE / 2;
+  const std::vector<BenchmarkConfig> configs{writer_config, reader_config};
+
+  for (const BenchmarkConfig& config : configs) {
+    base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+    base_results_.push_back(std::make_unique<BenchmarkResult>(config));
+  }
+
+  ParallelBenchmark bm{bm_name_,
+                       {"writer", "reader"},
+                       configs,
+                       std::move(base_executions_),
+                       std::move(base_results_),
+                       std::vector<std::filesystem::path>(2),
+                       /*shared_region=*/true};
+  EXPECT_EQ(bm.get_pmem_file(1), bm.get_pmem_file(0));
+  EXPECT_EQ(ParallelBenchmark::get_shared_region_size(configs), TEST_FILE_SIZE);
+
+  bm.create_data_files();
+  // The reader only accesses the second half of the writer's range.
+  ASSERT_EQ(bm.get_pmem_data().size(), 2);
+  EXPECT_EQ(bm.get_pmem_data()[1], bm.get_pmem_data()[0] + (TEST_FILE_SIZE / 2));
+  EXPECT_EQ(std::filesystem::file_size(bm.get_pmem_file(0)), TEST_FILE_SIZE);
+
+  bm.set_up();
+  ASSERT_TRUE(bm.run());
+
+  const nlohmann::json result_json = bm.get_result_as_json();
+  for (const char* sub_bm_name : {"writer", "reader"}) {
+    const nlohmann::json& sub_bm_results = result_json["results"][sub_bm_name]["results"];
+    EXPECT_GT(sub_bm_results["bandwidth"].get<double>(), 0);
+    // Without HITM perf events, e.g., in a VM, the hits are not counted.
+    ASSERT_TRUE(sub_bm_results.contains("dirty_line_hits"));
+    EXPECT_TRUE(sub_bm_results["dirty_line_hits"].is_null() || sub_bm_results["dirty_line_hits"].is_number());
+  }
+  EXPECT_EQ(result_json["results"]["reader"]["results"]["accessed_bytes"], TEST_FILE_SIZE / 2);
+
+  const std::filesystem::path shared_file = bm.get_pmem_file(0);
+  bm.tear_down(/*force=*/false);
+  EXPECT_TRUE(bm.get_pmem_data().empty() || bm.get_pmem_data()[1] == nullptr);
+  EXPECT_FALSE(std::filesystem::exists(shared_file));
+}
+
+TEST_F(BenchmarkTest, RunLoadedLatencySteps) {
+  const size_t num_chains = 8192;
+  BenchmarkConfig latency_config = base_config_;
+  latency_config.number_threads = 1;
+  latency_config.exec_mode = Mode::Custom;
+  latency_config.number_operations = num_chains;
+  latency_config.custom_operations = CustomOp::all_from_string("r_64");
+  latency_config.latency_sample_frequency = 16;
+
+  BenchmarkConfig bandwidth_config = base_config_;
+  bandwidth_config.number_threads = 2;
+  bandwidth_config.exec_mode = Mode::Random;
+  bandwidth_config.access_size = 256;
+  bandwidth_config.number_operations = TEST_FILE_SIZE / 256;
+  std::vector<BenchmarkConfig> bandwidth_step_configs{bandwidth_config, bandwidth_config};
+  bandwidth_step_configs[0].target_bandwidth = 64 * BYTES_IN_MEGABYTE;
+
+  for (const BenchmarkConfig& step_config : bandwidth_step_configs) {
+    base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+    base_executions_.push_back(std::make_unique<BenchmarkExecution>());
+    base_results_.push_back(std::make_unique<BenchmarkResult>(latency_config));
+    base_results_.push_back(std::make_unique<BenchmarkResult>(step_config));
+  }
+
+  LoadedLatencyBenchmark bm{bm_name_,
+                            "latency",
+                            "bandwidth",
+                            latency_config,
+                            bandwidth_step_configs,
+                            std::move(base_executions_),
+                            std::move(base_results_)};
+  bm.create_data_files();
+  bm.set_up();
+  ASSERT_TRUE(bm.run());
+
+  // The bandwidth threads run until the latency threads are done, so they overlap the whole latency measurement.
+  const std::vector<std::unique_ptr<BenchmarkResult>>& results = bm.get_benchmark_results();
+  ASSERT_EQ(results.size(), 4);
+  for (size_t step = 0; step < 2; ++step) {
+    const BenchmarkResult& latency_result = *results[2 * step];
+    const BenchmarkResult& bandwidth_result = *results[(2 * step) + 1];
+    EXPECT_THAT(latency_result.total_operation_sizes, ElementsAre(num_chains));
+    // The rate-limited background load has no bound on its number of accesses, so it does not record their latencies.
+    EXPECT_TRUE(bandwidth_result.operation_latencies.empty());
+    for (const ExecutionDuration& bandwidth_duration : bandwidth_result.total_operation_durations) {
+      EXPECT_LE(bandwidth_duration.begin, latency_result.total_operation_durations[0].begin);
+      EXPECT_GE(bandwidth_duration.end, latency_result.total_operation_durations[0].end);
+    }
+  }
+
+  const nlohmann::json result_json = bm.get_result_as_json();
+  ASSERT_JSON_TRUE(result_json, contains("config"));
+  EXPECT_EQ(result_json["config"]["bandwidth"]["injection_rates"], nlohmann::json::array({64 * BYTES_IN_MEGABYTE, 0}));
+  EXPECT_FALSE(result_json["config"]["bandwidth"].contains("target_bandwidth"));
+
+  const nlohmann::json& steps = result_json["results"]["steps"];
+  ASSERT_EQ(steps.size(), 2);
+  EXPECT_EQ(steps[0]["injection_rate"], 64 * BYTES_IN_MEGABYTE);
+  EXPECT_EQ(steps[1]["injection_rate"], 0);
+  for (const nlohmann::json& step : steps) {
+    EXPECT_GT(step["bandwidth"].get<double>(), 0);
+    EXPECT_TRUE(step["latency"].contains("median"));
+    EXPECT_TRUE(step["results"]["latency"].contains("ops_per_second"));
+    EXPECT_TRUE(step["results"]["bandwidth"].contains("threads"));
+  }
+}
+
+TEST_F(BenchmarkTest, RunSloSearchThreadsMeetsSlo) {
+  base_config_.exec_mode = Mode::Custom;
+  base_config_.number_operations = 8192;
+  base_config_.custom_operations = CustomOp::all_from_string("r_64");
+  base_config_.latency_sample_frequency = 16;
+
+  SloSearchConfig search_config{};
+  search_config.parameter = SloSearchParameter::NumberThreads;
+  search_config.min = 1;
+  search_config.max = 4;
+  search_config.max_latency_ns = 100 * NANOSECONDS_IN_SECONDS;
+
+  SloSearchBenchmark bm{bm_name_, base_config_, search_config};
+  bm.create_data_files();
+  bm.set_up();
+  ASSERT_TRUE(bm.run());
+
+  // The upper end already meets the SLO, so there is nothing to search.
+  const std::vector<SloProbe>& probes = bm.get_probes();
+  ASSERT_EQ(probes.size(), 2);
+  EXPECT_EQ(probes[0].value, 1);
+  EXPECT_EQ(probes[1].value, 4);
+  EXPECT_TRUE(probes[1].meets_slo);
+  EXPECT_GT(probes[1].ops_per_second, 0);
+  ASSERT_NE(bm.get_operating_point(), nullptr);
+  EXPECT_EQ(bm.get_operating_point()->value, 4);
+  EXPECT_FALSE(std::filesystem::exists(bm.get_pmem_file(0)));
+
+  const nlohmann::json result_json = bm.get_result_as_json();
+  EXPECT_FALSE(result_json["config"].contains("number_threads"));
+  EXPECT_EQ(result_json["config"]["slo_search"]["parameter"], "number_threads");
+  ASSERT_EQ(result_json["results"]["probes"].size(), 2);
+  EXPECT_EQ(result_json["results"]["probes"][1]["number_threads"], 4);
+  EXPECT_TRUE(result_json["results"]["probes"][1]["results"].contains("latency"));
+  EXPECT_EQ(result_json["results"]["operating_point"]["number_threads"], 4);
+}
+
+TEST_F(BenchmarkTest, RunSloSearchRateMissesSlo) {
+  base_config_.exec_mode = Mode::Custom;
+  base_config_.number_operations = 8192;
+  base_config_.custom_operations = CustomOp::all_from_string("r_64");
+
+  SloSearchConfig search_config{};
+  search_config.min = 100000;
+  search_config.max = 1000000;
+  search_config.max_latency_ns = 1;
+
+  SloSearchBenchmark bm{bm_name_, base_config_, search_config};
+  bm.create_data_files();
+  bm.set_up();
+  ASSERT_TRUE(bm.run());
+
+  // No access takes less than a nanosecond, so already the lower end misses the SLO.
+  const std::vector<SloProbe>& probes = bm.get_probes();
+  ASSERT_EQ(probes.size(), 1);
+  EXPECT_EQ(probes[0].value, 100000);
+  EXPECT_FALSE(probes[0].meets_slo);
+  EXPECT_GT(probes[0].latency, 1);
+  EXPECT_EQ(bm.get_operating_point(), nullptr);
+  EXPECT_TRUE(bm.get_result_as_json()["results"]["operating_point"].is_null());
+}
+
+// Meets the SLO exactly up to a fixed value without running anything, so that the search path is deterministic.
+class ThresholdSloSearchBenchmark : public SloSearchBenchmark {
+ public:
+  ThresholdSloSearchBenchmark(const std::string& benchmark_name, const BenchmarkConfig& config,
+                              const SloSearchConfig& search_config, const double threshold)
+      : SloSearchBenchmark{benchmark_name, config, search_config}, threshold_{threshold} {}
+
+ protected:
+  bool run_probe(const double value) override {
+    const bool meets_slo = value <= threshold_;
+    probes_.push_back(SloProbe{value, value, meets_slo ? 1u : 2u, meets_slo, nlohmann::json::object()});
+    return true;
+  }
+
+ private:
+  const double threshold_;
+};
+
+TEST_F(BenchmarkTest, RunSloSearchThreadsBisects) {
+  SloSearchConfig search_config{};
+  search_config.parameter = SloSearchParameter::NumberThreads;
+  search_config.min = 1;
+  search_config.max = 64;
+  search_config.max_probes = 20;
+
+  ThresholdSloSearchBenchmark bm{bm_name_, base_config_, search_config, 37};
+  ASSERT_TRUE(bm.run());
+
+  // After both ends, the search bisects 32, 48, 40, 36, 38, and 37 until the range [37, 38] cannot be split further.
+  const std::vector<SloProbe>& probes = bm.get_probes();
+  std::vector<double> values{};
+  for (const SloProbe& probe : probes) {
+    values.push_back(probe.value);
+  }
+  EXPECT_THAT(values, ElementsAre(1, 64, 32, 48, 40, 36, 38, 37));
+  ASSERT_NE(bm.get_operating_point(), nullptr);
+  EXPECT_EQ(bm.get_operating_point()->value, 37);
+  EXPECT_EQ(bm.get_result_as_json()["results"]["operating_point"]["number_threads"], 37);
+}
+
+TEST_F(BenchmarkTest, RunSloSearchRateConverges) {
+  SloSearchConfig search_config{};
+  search_config.min = 1000;
+  search_config.max = 2000;
+  search_config.max_probes = 20;
+
+  ThresholdSloSearchBenchmark bm{bm_name_, base_config_, search_config, 1234};
+  ASSERT_TRUE(bm.run());
+
+  // The search stops with fewer probes than allowed, once the lowest miss is within 1% of the highest pass.
+  const std::vector<SloProbe>& probes = bm.get_probes();
+  EXPECT_GT(probes.size(), 2);
+  EXPECT_LT(probes.size(), search_config.max_probes);
+  double highest_pass = 0;
+  double lowest_miss = search_config.max;
+  for (const SloProbe& probe : probes) {
+    EXPECT_EQ(probe.meets_slo, probe.value <= 1234);
+    if (probe.meets_slo) {
+      highest_pass = std::max(highest_pass, probe.value);
+    } else {
+      lowest_miss = std::min(lowest_miss, probe.value);
+    }
+  }
+  EXPECT_LE(lowest_miss - highest_pass, highest_pass * 0.01);
+
+  const SloProbe* operating_point = bm.get_operating_point();
+  ASSERT_NE(operating_point, nullptr);
+  EXPECT_EQ(operating_point->value, highest_pass);
+  EXPECT_LE(operating_point->value, 1234);
+  EXPECT_GT(operating_point->value, 1234 * 0.99);
+}
+
+TEST_F(BenchmarkTest, LatinHypercubeSampleCoversAllValues) {
+  const std::vector<MatrixDimension> dimensions{{"number_threads", 4}, {"access_size", 8}};
+  const std::vector<size_t> config_indices = MatrixSearchBenchmark::latin_hypercube_sample(dimensions, 8, 1);
+
+  // With as many samples as values, each access size is sampled once and each thread count twice.
+  ASSERT_EQ(config_indices.size(), 8);
+  std::vector<size_t> thread_counts(4, 0);
+  std::vector<size_t> access_size_counts(8, 0);
+  for (const size_t config_idx : config_indices) {
+    thread_counts[config_idx / 8]++;
+    access_size_counts[config_idx % 8]++;
+  }
+  EXPECT_THAT(thread_counts, ElementsAre(2, 2, 2, 2));
+  EXPECT_THAT(access_size_counts, ElementsAre(1, 1, 1, 1, 1, 1, 1, 1));
+  EXPECT_TRUE(std::is_sorted(config_indices.begin(), config_indices.end()));
+}
+
+TEST_F(BenchmarkTest, RunMatrixSearchAdaptive) {
+  base_config_.exec_mode = Mode::Sequential;
+  base_config_.operation = Operation::Read;
+  std::vector<BenchmarkConfig> matrix{};
+  for (const uint32_t access_size : {64, 128, 256, 512, 1024}) {
+    matrix.push_back(base_config_);
+    matrix.back().access_size = access_size;
+    matrix.back().matrix_args = {"access_size"};
+  }
+
+  // A threshold of 1 never refines, as the relative change is at most 1.
+  MatrixSearchConfig search_config{};
+  search_config.refine_threshold = 1;
+  MatrixSearchBenchmark coarse_bm{bm_name_, matrix, {{"access_size", 5}}, search_config};
+  coarse_bm.create_data_files();
+  coarse_bm.set_up();
+  ASSERT_TRUE(coarse_bm.run());
+  ASSERT_EQ(coarse_bm.get_points().size(), 3);
+  EXPECT_EQ(coarse_bm.get_points()[0].config_idx, 0);
+  EXPECT_EQ(coarse_bm.get_points()[1].config_idx, 2);
+  EXPECT_EQ(coarse_bm.get_points()[2].config_idx, 4);
+  EXPECT_FALSE(std::filesystem::exists(coarse_bm.get_pmem_file(0)));
+
+  // A threshold of 0 refines between all points with different bandwidth, until the whole matrix ran.
+  search_config.refine_threshold = 0;
+  MatrixSearchBenchmark refined_bm{bm_name_, matrix, {{"access_size", 5}}, search_config};
+  refined_bm.create_data_files();
+  refined_bm.set_up();
+  ASSERT_TRUE(refined_bm.run());
+  EXPECT_EQ(refined_bm.get_points().size(), 5);
+
+  const nlohmann::json result_json = refined_bm.get_result_as_json();
+  EXPECT_EQ(result_json["config"]["matrix_search"]["strategy"], "adaptive");
+  EXPECT_EQ(result_json["results"]["matrix_size"], 5);
+  EXPECT_EQ(result_json["results"]["num_runs"], 5);
+  const nlohmann::json& points = result_json["results"]["points"];
+  ASSERT_EQ(points.size(), 5);
+  EXPECT_EQ(points[0]["access_size"], 64);
+  EXPECT_EQ(points[4]["access_size"], 1024);
+  EXPECT_GT(points[1]["throughput"].get<double>(), 0);
+  EXPECT_TRUE(points[1]["results"].contains("bandwidth"));
+}
+
+TEST_F(BenchmarkTest, RunMatrixSearchLatinHypercubeMaxRuns) {
+  base_config_.exec_mode = Mode::Sequential;
+  base_config_.operation = Operation::Read;
+  std::vector<BenchmarkConfig> matrix{};
+  for (const uint16_t number_threads : {1, 2}) {
+    for (const uint32_t access_size : {64, 128, 256, 512}) {
+      matrix.push_back(base_config_);
+      matrix.back().number_threads = number_threads;
+      matrix.back().access_size = access_size;
+    }
+  }
+
+  MatrixSearchConfig search_config{};
+  search_config.strategy = MatrixSearchStrategy::LatinHypercube;
+  search_config.samples = 4;
+  search_config.max_runs = 3;
+  MatrixSearchBenchmark bm{bm_name_, matrix, {{"number_threads", 2}, {"access_size", 4}}, search_config};
+  bm.create_data_files();
+  bm.set_up();
+  ASSERT_TRUE(bm.run());
+  EXPECT_EQ(bm.get_points().size(), 3);
+  EXPECT_EQ(bm.get_result_as_json()["results"]["num_runs"], 3);
+}
+
+TEST_F(BenchmarkTest, RunThreadRampDoubling) {
+  base_config_.exec_mode = Mode::Sequential;
+  base_config_.operation = Operation::Read;
+  base_config_.run_time = 1;
+  ThreadRampConfig ramp_config{};
+  ramp_config.max_threads = 2;
+
+  std::vector<BenchmarkConfig> step_configs{};
+  std::vector<std::unique_ptr<BenchmarkExecution>> executions{};
+  std::vector<std::unique_ptr<BenchmarkResult>> results{};
+  for (const uint16_t number_threads : ramp_config.get_step_threads()) {
+    step_configs.push_back(base_config_);
+    step_configs.back().number_threads = number_threads;
+    executions.push_back(std::make_unique<BenchmarkExecution>());
+    results.push_back(std::make_unique<BenchmarkResult>(step_configs.back()));
+  }
+
+  ThreadRampBenchmark bm{bm_name_, step_configs, ramp_config, std::move(executions), std::move(results)};
+  bm.create_data_files();
+  bm.set_up();
+  ASSERT_EQ(bm.get_thread_configs().size(), 2);
+  // All steps access the same data.
+  EXPECT_EQ(bm.get_pmem_data().size(), 1);
+  EXPECT_EQ(bm.get_thread_configs()[1][1].partition_start_addr, bm.get_pmem_data()[0]);
+  ASSERT_TRUE(bm.run());
+
+  const nlohmann::json result_json = bm.get_result_as_json();
+  EXPECT_FALSE(result_json["config"].contains("number_threads"));
+  EXPECT_EQ(result_json["config"]["thread_ramp"]["mode"], "doubling");
+  EXPECT_EQ(result_json["config"]["thread_ramp"]["max_threads"], 2);
+  const nlohmann::json& steps = result_json["results"]["steps"];
+  ASSERT_EQ(steps.size(), 2);
+  EXPECT_EQ(steps[0]["number_threads"], 1);
+  EXPECT_EQ(steps[1]["number_threads"], 2);
+  EXPECT_GT(steps[0]["bandwidth"].get<double>(), 0);
+  EXPECT_GT(steps[1]["bandwidth"].get<double>(), 0);
+  EXPECT_TRUE(steps[1]["results"].contains("threads"));
+
+  const nlohmann::json& peak = result_json["results"]["peak"];
+  const size_t peak_step = peak["number_threads"].get<uint16_t>() - 1;
+  EXPECT_EQ(peak["bandwidth"], steps[peak_step]["bandwidth"]);
+}
+
+TEST_F(BenchmarkTest, RunPhasesOnSharedData) {
+  base_config_.exec_mode = Mode::Sequential;
+  base_config_.number_threads = 2;
+  base_config_.run_time = 1;
+  BenchmarkConfig load_config = base_config_;
+  load_config.operation = Operation::Write;
+  BenchmarkConfig scan_config = base_config_;
+  scan_config.operation = Operation::Read;
+  scan_config.number_threads = 1;
+
+  std::vector<std::unique_ptr<BenchmarkExecution>> executions{};
+  std::vector<std::unique_ptr<BenchmarkResult>> results{};
+  for (const BenchmarkConfig& config : {load_config, scan_config}) {
+    executions.push_back(std::make_unique<BenchmarkExecution>());
+    results.push_back(std::make_unique<BenchmarkResult>(config));
+  }
+
+  PhasedBenchmark bm{bm_name_, {"load", "scan"}, {load_config, scan_config}, std::move(executions),
+                     std::move(results)};
+  bm.create_data_files();
+  bm.set_up();
+  // Both phases access the same data, which is not re-created between them.
+  ASSERT_EQ(bm.get_pmem_data().size(), 1);
+  ASSERT_EQ(bm.get_thread_configs().size(), 2);
+  EXPECT_EQ(bm.get_thread_configs()[0][0].partition_start_addr, bm.get_pmem_data()[0]);
+  EXPECT_EQ(bm.get_thread_configs()[1][0].partition_start_addr, bm.get_pmem_data()[0]);
+  ASSERT_TRUE(bm.run());
+  EXPECT_TRUE(std::filesystem::exists(bm.get_pmem_file(0)));
+
+  const nlohmann::json result_json = bm.get_result_as_json();
+  EXPECT_EQ(result_json["config"]["phases"], nlohmann::json({"load", "scan"}));
+  const nlohmann::json& phases = result_json["results"]["phases"];
+  ASSERT_EQ(phases.size(), 2);
+  EXPECT_EQ(phases[0]["name"], "load");
+  EXPECT_EQ(phases[0]["config"]["operation"], "write");
+  EXPECT_GT(phases[0]["results"]["bandwidth"].get<double>(), 0);
+  EXPECT_EQ(phases[1]["name"], "scan");
+  EXPECT_EQ(phases[1]["config"]["number_threads"], 1);
+  EXPECT_GT(phases[1]["results"]["bandwidth"].get<double>(), 0);
+}
+
 TEST_F(BenchmarkTest, ResultsParallelSingleThreadMixed) {
   const size_t num_ops = TEST_FILE_SIZE / 256;
   base_config_.number_threads = 1;
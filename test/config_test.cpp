@@ -16,6 +16,15 @@ constexpr auto TEST_SINGLE_CONFIG_FILE_RANDOM = "test_random.yaml";
 constexpr auto TEST_PAR_CONFIG_FILE_SEQ_RANDOM = "test_parallel_seq_random.yaml";
 constexpr auto TEST_PAR_CONFIG_FILE_MATRIX = "test_parallel_matrix.yaml";
 constexpr auto TEST_CUSTOM_OPS_MATRIX = "test_custom_ops.yaml";
+constexpr auto TEST_CUSTOM_REGIONS = "test_custom_regions.yaml";
+constexpr auto TEST_LOADED_LATENCY = "test_loaded_latency.yaml";
+constexpr auto TEST_SLO_SEARCH = "test_slo_search.yaml";
+constexpr auto TEST_MATRIX_SEARCH = "test_matrix_search.yaml";
+constexpr auto TEST_MATRIX_CONSTRAINTS = "test_matrix_constraints.yaml";
+constexpr auto TEST_THREAD_RAMP = "test_thread_ramp.yaml";
+constexpr auto TEST_PHASES = "test_phases.yaml";
+constexpr auto TEST_PARALLEL_NWAY = "test_parallel_nway.yaml";
+constexpr auto TEST_PARALLEL_SHARED_REGION = "test_parallel_shared_region.yaml";
 
 class ConfigTest : public ::testing::Test {
  protected:
@@ -35,6 +44,15 @@ class ConfigTest : public ::testing::Test {
     config_par_file_seq_random = BenchmarkFactory::get_config_files(test_config_path / TEST_PAR_CONFIG_FILE_SEQ_RANDOM);
     config_par_file_matrix = BenchmarkFactory::get_config_files(test_config_path / TEST_PAR_CONFIG_FILE_MATRIX);
     config_custom_ops_matrix = BenchmarkFactory::get_config_files(test_config_path / TEST_CUSTOM_OPS_MATRIX);
+    config_custom_regions = BenchmarkFactory::get_config_files(test_config_path / TEST_CUSTOM_REGIONS);
+    config_loaded_latency = BenchmarkFactory::get_config_files(test_config_path / TEST_LOADED_LATENCY);
+    config_slo_search = BenchmarkFactory::get_config_files(test_config_path / TEST_SLO_SEARCH);
+    config_matrix_search = BenchmarkFactory::get_config_files(test_config_path / TEST_MATRIX_SEARCH);
+    config_matrix_constraints = BenchmarkFactory::get_config_files(test_config_path / TEST_MATRIX_CONSTRAINTS);
+    config_thread_ramp = BenchmarkFactory::get_config_files(test_config_path / TEST_THREAD_RAMP);
+    config_phases = BenchmarkFactory::get_config_files(test_config_path / TEST_PHASES);
+    config_par_nway = BenchmarkFactory::get_config_files(test_config_path / TEST_PARALLEL_NWAY);
+    config_par_shared_region = BenchmarkFactory::get_config_files(test_config_path / TEST_PARALLEL_SHARED_REGION);
   }
 
   void TearDown() override { std::ofstream empty_log(test_logger_path, std::ostream::trunc); }
@@ -63,6 +81,15 @@ class ConfigTest : public ::testing::Test {
   std::vector<YAML::Node> config_par_file_seq_random;
   std::vector<YAML::Node> config_par_file_matrix;
   std::vector<YAML::Node> config_custom_ops_matrix;
+  std::vector<YAML::Node> config_custom_regions;
+  std::vector<YAML::Node> config_loaded_latency;
+  std::vector<YAML::Node> config_slo_search;
+  std::vector<YAML::Node> config_matrix_search;
+  std::vector<YAML::Node> config_matrix_constraints;
+  std::vector<YAML::Node> config_thread_ramp;
+  std::vector<YAML::Node> config_phases;
+  std::vector<YAML::Node> config_par_nway;
+  std::vector<YAML::Node> config_par_shared_region;
   BenchmarkConfig bm_config;
   static std::filesystem::path test_logger_path;
 };
@@ -289,6 +316,353 @@ TEST_F(ConfigTest, DecodeCustomOperationsMatrix) {
   }
 }
 
+TEST_F(ConfigTest, DecodeCustomRegions) {
+  std::vector<SingleBenchmark> benchmarks =
+      BenchmarkFactory::create_single_benchmarks("/tmp/foo", config_custom_regions, true);
+  ASSERT_EQ(benchmarks.size(), 1);
+  bm_config = benchmarks.at(0).get_benchmark_configs()[0];
+
+  ASSERT_EQ(bm_config.custom_regions.size(), 3);
+  const CustomRegion& idx = bm_config.custom_regions[0];
+  EXPECT_EQ(idx.name, "idx");
+  EXPECT_EQ(idx.size, 64 * BYTES_IN_MEGABYTE);
+  EXPECT_FALSE(idx.is_pmem);
+  EXPECT_EQ(idx.numa_node, 0);
+  EXPECT_EQ(idx.distribution, RandomDistribution::Zipf);
+
+  const CustomRegion& heap = bm_config.custom_regions[1];
+  EXPECT_EQ(heap.name, "heap");
+  EXPECT_EQ(heap.size, BYTES_IN_GIGABYTE);
+  EXPECT_TRUE(heap.is_pmem);
+  EXPECT_EQ(heap.numa_node, -1);
+  EXPECT_EQ(heap.distribution, RandomDistribution::Uniform);
+
+  EXPECT_EQ(bm_config.custom_regions[2].name, "log");
+  EXPECT_EQ(bm_config.get_custom_region_index("log"), 2);
+  EXPECT_EQ(bm_config.get_custom_region_index("foo"), -1);
+
+  ASSERT_EQ(bm_config.custom_operations.size(), 4);
+  EXPECT_EQ(bm_config.custom_operations[0].region, "idx");
+  EXPECT_EQ(bm_config.custom_operations[3].region, "log");
+  EXPECT_FALSE(bm_config.contains_dram_op());
+
+  const nlohmann::json config_json = bm_config.as_json();
+  EXPECT_EQ(config_json["custom_regions"]["idx"]["memory"], "dram");
+  EXPECT_EQ(config_json["custom_regions"]["idx"]["distribution"], "zipf");
+  EXPECT_EQ(config_json["custom_regions"]["heap"]["size"], BYTES_IN_GIGABYTE);
+}
+
+TEST_F(ConfigTest, DecodeLoadedLatency) {
+  std::vector<SingleBenchmark> benchmarks =
+      BenchmarkFactory::create_single_benchmarks("/tmp/foo", config_loaded_latency, true);
+  std::vector<ParallelBenchmark> par_benchmarks =
+      BenchmarkFactory::create_parallel_benchmarks("/tmp/foo", config_loaded_latency, true);
+  std::vector<LoadedLatencyBenchmark> loaded_latency_benchmarks =
+      BenchmarkFactory::create_loaded_latency_benchmarks("/tmp/foo", config_loaded_latency, true);
+  ASSERT_EQ(benchmarks.size(), 0);
+  ASSERT_EQ(par_benchmarks.size(), 0);
+  ASSERT_EQ(loaded_latency_benchmarks.size(), 1);
+
+  const LoadedLatencyBenchmark& bm = loaded_latency_benchmarks[0];
+  EXPECT_EQ(bm.benchmark_name(), "loaded_latency_test");
+  EXPECT_EQ(bm.benchmark_type_as_str(), "loaded_latency");
+  EXPECT_EQ(bm.get_latency_benchmark_name(), "pointer_chase");
+  EXPECT_EQ(bm.get_bandwidth_benchmark_name(), "read_load");
+  ASSERT_EQ(bm.num_steps(), 3);
+
+  // The configs alternate between the latency and the bandwidth benchmark of each step.
+  const std::vector<BenchmarkConfig>& configs = bm.get_benchmark_configs();
+  ASSERT_EQ(configs.size(), 6);
+  EXPECT_EQ(configs[0].exec_mode, Mode::Custom);
+  EXPECT_EQ(configs[0].latency_sample_frequency, 10);
+  EXPECT_EQ(configs[2].custom_operations, configs[0].custom_operations);
+  EXPECT_EQ(configs[1].exec_mode, Mode::Random);
+  EXPECT_EQ(configs[1].number_threads, 8);
+  EXPECT_EQ(configs[1].target_bandwidth, BYTES_IN_GIGABYTE);
+  EXPECT_EQ(configs[3].target_bandwidth, 4 * BYTES_IN_GIGABYTE);
+  EXPECT_EQ(configs[5].target_bandwidth, 0);
+  EXPECT_FALSE(configs[5].is_rate_limited());
+}
+
+TEST_F(ConfigTest, DecodeSloSearch) {
+  std::vector<SingleBenchmark> benchmarks =
+      BenchmarkFactory::create_single_benchmarks("/tmp/foo", config_slo_search, true);
+  std::vector<SloSearchBenchmark> slo_searches =
+      BenchmarkFactory::create_slo_search_benchmarks("/tmp/foo", config_slo_search, true);
+  ASSERT_EQ(benchmarks.size(), 0);
+  ASSERT_EQ(slo_searches.size(), 2);
+
+  const SloSearchBenchmark& rate_search = slo_searches[0];
+  EXPECT_EQ(rate_search.benchmark_name(), "lookup_capacity");
+  EXPECT_EQ(rate_search.benchmark_type_as_str(), "slo_search");
+  const SloSearchConfig& rate_search_config = rate_search.get_search_config();
+  EXPECT_EQ(rate_search_config.parameter, SloSearchParameter::TargetOpsPerSecond);
+  EXPECT_EQ(rate_search_config.min, 1000000);
+  EXPECT_EQ(rate_search_config.max, 64000000);
+  EXPECT_EQ(rate_search_config.latency_percentile, 99.9);
+  EXPECT_EQ(rate_search_config.max_latency_ns, 2000);
+  EXPECT_EQ(rate_search_config.max_probes, 8);
+  // The config of the search is the config of its first probe.
+  const BenchmarkConfig& rate_config = rate_search.get_benchmark_configs()[0];
+  EXPECT_EQ(rate_config.number_threads, 8);
+  EXPECT_EQ(rate_config.target_ops_per_second, 1000000);
+  EXPECT_TRUE(rate_config.is_rate_limited());
+
+  const SloSearchBenchmark& thread_search = slo_searches[1];
+  EXPECT_EQ(thread_search.benchmark_name(), "pointer_chase_threads");
+  const SloSearchConfig& thread_search_config = thread_search.get_search_config();
+  EXPECT_EQ(thread_search_config.parameter, SloSearchParameter::NumberThreads);
+  EXPECT_EQ(thread_search_config.latency_percentile, 99.0);
+  EXPECT_EQ(thread_search_config.max_probes, 10);
+  const BenchmarkConfig& thread_config = thread_search.get_benchmark_configs()[0];
+  EXPECT_EQ(thread_config.number_threads, 1);
+  EXPECT_FALSE(thread_config.is_rate_limited());
+
+  const nlohmann::json search_json = thread_search.get_search_config().as_json();
+  EXPECT_EQ(search_json["parameter"], "number_threads");
+  EXPECT_EQ(search_json["max"], 32);
+}
+
+TEST_F(ConfigTest, DecodeMatrixSearch) {
+  std::vector<SingleBenchmark> benchmarks =
+      BenchmarkFactory::create_single_benchmarks("/tmp/foo", config_matrix_search, true);
+  std::vector<MatrixSearchBenchmark> matrix_searches =
+      BenchmarkFactory::create_matrix_search_benchmarks("/tmp/foo", config_matrix_search, true);
+  ASSERT_EQ(benchmarks.size(), 0);
+  ASSERT_EQ(matrix_searches.size(), 2);
+
+  const MatrixSearchBenchmark& adaptive_search = matrix_searches[0];
+  EXPECT_EQ(adaptive_search.benchmark_name(), "thread_knee");
+  EXPECT_EQ(adaptive_search.benchmark_type_as_str(), "matrix_search");
+  EXPECT_EQ(adaptive_search.get_search_config().strategy, MatrixSearchStrategy::Adaptive);
+  EXPECT_EQ(adaptive_search.get_search_config().refine_threshold, 0.05);
+  EXPECT_EQ(adaptive_search.get_search_config().max_runs, 6);
+  ASSERT_EQ(adaptive_search.get_benchmark_configs().size(), 8);
+  EXPECT_EQ(adaptive_search.get_benchmark_configs()[7].number_threads, 128);
+  ASSERT_EQ(adaptive_search.get_dimensions().size(), 1);
+  EXPECT_EQ(adaptive_search.get_dimensions()[0].name, "number_threads");
+  EXPECT_EQ(adaptive_search.get_dimensions()[0].num_values, 8);
+
+  const MatrixSearchBenchmark& sampled_search = matrix_searches[1];
+  EXPECT_EQ(sampled_search.get_search_config().strategy, MatrixSearchStrategy::LatinHypercube);
+  EXPECT_EQ(sampled_search.get_search_config().samples, 8);
+  EXPECT_EQ(sampled_search.get_search_config().max_runs, 32);
+  ASSERT_EQ(sampled_search.get_benchmark_configs().size(), 20);
+  // The matrix iterates the last dimension first.
+  const std::vector<BenchmarkConfig>& sampled_configs = sampled_search.get_benchmark_configs();
+  EXPECT_EQ(sampled_configs[1].number_threads, 1);
+  EXPECT_EQ(sampled_configs[1].access_size, 128);
+  EXPECT_EQ(sampled_configs[5].number_threads, 4);
+  EXPECT_EQ(sampled_configs[5].access_size, 64);
+  ASSERT_EQ(sampled_search.get_dimensions().size(), 2);
+  EXPECT_EQ(sampled_search.get_dimensions()[1].name, "access_size");
+  EXPECT_EQ(sampled_search.get_dimensions()[1].num_values, 5);
+
+  YAML::Node parallel_search = YAML::Load(
+      "bm: {matrix_search: {strategy: adaptive}, parallel_benchmark: {writer: {args: {operation: write}, "
+      "matrix: {number_threads: [1, 2]}}, reader: {args: {exec_mode: sequential}}}}");
+  std::vector<YAML::Node> parallel_search_configs{parallel_search};
+  EXPECT_THROW(BenchmarkFactory::create_matrix_search_benchmarks("/tmp/foo", parallel_search_configs, true),
+               std::invalid_argument);
+  EXPECT_THROW(BenchmarkFactory::create_parallel_benchmarks("/tmp/foo", parallel_search_configs, true),
+               std::invalid_argument);
+}
+
+TEST_F(ConfigTest, DecodeThreadRamp) {
+  std::vector<SingleBenchmark> benchmarks =
+      BenchmarkFactory::create_single_benchmarks("/tmp/foo", config_thread_ramp, true);
+  std::vector<ThreadRampBenchmark> thread_ramps =
+      BenchmarkFactory::create_thread_ramp_benchmarks("/tmp/foo", config_thread_ramp, true);
+  ASSERT_EQ(benchmarks.size(), 0);
+  ASSERT_EQ(thread_ramps.size(), 2);
+
+  const ThreadRampBenchmark& doubling_ramp = thread_ramps[0];
+  EXPECT_EQ(doubling_ramp.benchmark_name(), "doubling_seq_reads");
+  EXPECT_EQ(doubling_ramp.benchmark_type_as_str(), "thread_ramp");
+  EXPECT_EQ(doubling_ramp.get_ramp_config().mode, ThreadRampMode::Doubling);
+  // The last step runs the maximum number of threads, even if it is not a power of two.
+  ASSERT_EQ(doubling_ramp.num_steps(), 5);
+  const std::vector<uint16_t> doubling_threads{1, 2, 4, 8, 12};
+  for (size_t step = 0; step < doubling_ramp.num_steps(); ++step) {
+    const BenchmarkConfig& step_config = doubling_ramp.get_benchmark_configs()[step];
+    EXPECT_EQ(step_config.number_threads, doubling_threads[step]);
+    EXPECT_EQ(step_config.exec_mode, Mode::Sequential);
+    EXPECT_EQ(step_config.run_time, 5);
+  }
+
+  const ThreadRampBenchmark& linear_ramp = thread_ramps[1];
+  EXPECT_EQ(linear_ramp.get_ramp_config().mode, ThreadRampMode::Linear);
+  EXPECT_EQ(linear_ramp.get_ramp_config().step_threads, 4);
+  EXPECT_EQ(linear_ramp.get_ramp_config().get_step_threads(), std::vector<uint16_t>({1, 4, 8, 12, 16}));
+  EXPECT_EQ(linear_ramp.get_benchmark_configs()[4].operation, Operation::Write);
+
+  YAML::Node no_run_time = YAML::Load("bm: {thread_ramp: {max_threads: 4}, args: {exec_mode: sequential}}");
+  std::vector<YAML::Node> no_run_time_configs{no_run_time};
+  EXPECT_THROW(BenchmarkFactory::create_thread_ramp_benchmarks("/tmp/foo", no_run_time_configs, true),
+               std::invalid_argument);
+}
+
+TEST_F(ConfigTest, DecodePhases) {
+  std::vector<SingleBenchmark> benchmarks = BenchmarkFactory::create_single_benchmarks("/tmp/foo", config_phases, true);
+  std::vector<PhasedBenchmark> phased_benchmarks =
+      BenchmarkFactory::create_phased_benchmarks("/tmp/foo", config_phases, true);
+  ASSERT_EQ(benchmarks.size(), 0);
+  ASSERT_EQ(phased_benchmarks.size(), 1);
+
+  const PhasedBenchmark& bm = phased_benchmarks[0];
+  EXPECT_EQ(bm.benchmark_name(), "aging_heap");
+  EXPECT_EQ(bm.benchmark_type_as_str(), "phased");
+  EXPECT_EQ(bm.get_phase_names(), std::vector<std::string>({"load", "steady", "phase_3"}));
+  ASSERT_EQ(bm.num_phases(), 3);
+
+  const std::vector<BenchmarkConfig>& phase_configs = bm.get_benchmark_configs();
+  EXPECT_EQ(phase_configs[0].exec_mode, Mode::Sequential);
+  EXPECT_EQ(phase_configs[0].operation, Operation::Write);
+  EXPECT_EQ(phase_configs[0].access_size, 4096);
+  EXPECT_EQ(phase_configs[1].exec_mode, Mode::Random);
+  EXPECT_EQ(phase_configs[1].read_ratio, 0.9);
+  EXPECT_EQ(phase_configs[2].operation, Operation::Read);
+  // The shared args apply to all phases, unless a phase overrides them.
+  for (const BenchmarkConfig& phase_config : phase_configs) {
+    EXPECT_EQ(phase_config.memory_range, 2 * BYTES_IN_GIGABYTE);
+  }
+  EXPECT_EQ(phase_configs[0].number_threads, 4);
+  EXPECT_EQ(phase_configs[1].number_threads, 8);
+  EXPECT_EQ(phase_configs[2].number_threads, 4);
+
+  YAML::Node different_ranges = YAML::Load(
+      "bm: {phases: [{args: {exec_mode: sequential, memory_range: 1G}}, {args: {exec_mode: sequential}}]}");
+  std::vector<YAML::Node> different_ranges_configs{different_ranges};
+  EXPECT_THROW(BenchmarkFactory::create_phased_benchmarks("/tmp/foo", different_ranges_configs, true),
+               std::invalid_argument);
+}
+
+TEST_F(ConfigTest, ParallelDecodeNWay) {
+  std::vector<SingleBenchmark> benchmarks =
+      BenchmarkFactory::create_single_benchmarks("/tmp/foo", config_par_nway, true);
+  std::vector<ParallelBenchmark> par_benchmarks =
+      BenchmarkFactory::create_parallel_benchmarks("/tmp/foo", config_par_nway, true);
+  ASSERT_EQ(benchmarks.size(), 0);
+  // More than two sub-benchmarks are zipped by default. Sub-benchmarks without a matrix run in each benchmark.
+  ASSERT_EQ(par_benchmarks.size(), 2);
+
+  for (size_t i = 0; i < par_benchmarks.size(); ++i) {
+    const ParallelBenchmark& bm = par_benchmarks[i];
+    ASSERT_EQ(bm.num_sub_benchmarks(), 4);
+    // The read-only scanner comes first and reuses its data file in both benchmarks.
+    EXPECT_EQ(bm.get_sub_benchmark_names(),
+              std::vector<std::string>({"scanner", "log_writer", "index_updater", "checkpointer"}));
+    EXPECT_FALSE(bm.owns_pmem_file(0));
+    EXPECT_EQ(bm.get_pmem_file(0), par_benchmarks[0].get_pmem_file(0));
+    EXPECT_TRUE(bm.owns_pmem_file(1));
+    EXPECT_TRUE(bm.owns_pmem_file(3));
+
+    const std::vector<BenchmarkConfig>& configs = bm.get_benchmark_configs();
+    EXPECT_EQ(configs[0].memory_range, 10 * BYTES_IN_GIGABYTE);
+    EXPECT_EQ(configs[3].access_size, 16 * 1024);
+  }
+
+  EXPECT_EQ(par_benchmarks[0].get_benchmark_configs()[1].access_size, 256);
+  EXPECT_EQ(par_benchmarks[0].get_benchmark_configs()[2].number_threads, 4);
+  EXPECT_EQ(par_benchmarks[1].get_benchmark_configs()[1].access_size, 4096);
+  EXPECT_EQ(par_benchmarks[1].get_benchmark_configs()[2].number_threads, 8);
+
+  // Without zipping, all combinations run. Decoding marks the nodes as visited, so we decode a fresh copy.
+  std::vector<YAML::Node> crossed_configs = BenchmarkFactory::get_config_files(
+      std::filesystem::current_path() / "resources" / "configs" / TEST_PARALLEL_NWAY);
+  crossed_configs[0]["database_mix"]["zip_matrices"] = false;
+  EXPECT_EQ(BenchmarkFactory::create_parallel_benchmarks("/tmp/foo", crossed_configs, true).size(), 4);
+}
+
+TEST_F(ConfigTest, ParallelDecodeSharedRegion) {
+  std::vector<ParallelBenchmark> par_benchmarks =
+      BenchmarkFactory::create_parallel_benchmarks("/tmp/foo", config_par_shared_region, true);
+  ASSERT_EQ(par_benchmarks.size(), 2);
+
+  for (const ParallelBenchmark& bm : par_benchmarks) {
+    ASSERT_TRUE(bm.has_shared_region());
+    EXPECT_EQ(bm.get_sub_benchmark_names(), std::vector<std::string>({"reader", "writer"}));
+    // The first sub-benchmark owns the shared file, even though it only reads.
+    EXPECT_TRUE(bm.owns_pmem_file(0));
+    EXPECT_FALSE(bm.owns_pmem_file(1));
+    EXPECT_EQ(bm.get_pmem_file(1), bm.get_pmem_file(0));
+  }
+  EXPECT_NE(par_benchmarks[0].get_pmem_file(0), par_benchmarks[1].get_pmem_file(0));
+
+  // The reader either shares the writer's full range or only its second half.
+  const std::vector<BenchmarkConfig>& full_configs = par_benchmarks[0].get_benchmark_configs();
+  EXPECT_EQ(full_configs[0].region_offset, 0);
+  EXPECT_EQ(ParallelBenchmark::get_shared_region_size(full_configs), BYTES_IN_GIGABYTE);
+  const std::vector<BenchmarkConfig>& partial_configs = par_benchmarks[1].get_benchmark_configs();
+  EXPECT_EQ(partial_configs[0].region_offset, 512 * BYTES_IN_MEGABYTE);
+  EXPECT_EQ(partial_configs[0].as_json()["region_offset"], 512 * BYTES_IN_MEGABYTE);
+  EXPECT_EQ(ParallelBenchmark::get_shared_region_size(partial_configs), BYTES_IN_GIGABYTE + 512 * BYTES_IN_MEGABYTE);
+
+  YAML::Node offset_without_sharing = YAML::Load(
+      "bm: {parallel_benchmark: {writer: {args: {exec_mode: sequential, operation: write}}, "
+      "reader: {args: {exec_mode: sequential, region_offset: 4K}}}}");
+  std::vector<YAML::Node> offset_without_sharing_configs{offset_without_sharing};
+  EXPECT_THROW(BenchmarkFactory::create_parallel_benchmarks("/tmp/foo", offset_without_sharing_configs, true),
+               std::invalid_argument);
+}
+
+TEST_F(ConfigTest, DecodeMatrixZipExcludeWhere) {
+  std::vector<SingleBenchmark> benchmarks =
+      BenchmarkFactory::create_single_benchmarks("/tmp/foo", config_matrix_constraints, true);
+  // Out of 3 access sizes x 3 zipped thread counts, 'where' skips the three configs with 64 threads, which would not
+  // have enough memory per thread, and 'exclude' skips the one with 4096 Byte and 8 threads.
+  ASSERT_EQ(benchmarks.size(), 5);
+
+  const std::vector<std::pair<uint32_t, uint16_t>> expected_configs{{64, 1}, {64, 8}, {256, 1}, {256, 8}, {4096, 1}};
+  for (size_t i = 0; i < benchmarks.size(); ++i) {
+    const BenchmarkConfig& config = benchmarks[i].get_benchmark_configs()[0];
+    EXPECT_EQ(config.access_size, expected_configs[i].first);
+    EXPECT_EQ(config.number_threads, expected_configs[i].second);
+    // The zipped args advance together.
+    EXPECT_EQ(config.number_partitions, config.number_threads == 1 ? 1 : 2);
+    EXPECT_EQ(config.matrix_args,
+              std::vector<std::string>({"access_size", "number_partitions", "number_threads"}));
+  }
+}
+
+TEST_F(ConfigTest, ParallelDecodeZipMatrices) {
+  std::vector<ParallelBenchmark> par_benchmarks =
+      BenchmarkFactory::create_parallel_benchmarks("/tmp/foo", config_matrix_constraints, true);
+  // The configs of both matrices are paired instead of crossed.
+  ASSERT_EQ(par_benchmarks.size(), 3);
+  for (const ParallelBenchmark& bm : par_benchmarks) {
+    const std::vector<BenchmarkConfig>& configs = bm.get_benchmark_configs();
+    EXPECT_EQ(configs[0].access_size, configs[1].access_size);
+  }
+  EXPECT_EQ(par_benchmarks[2].get_benchmark_configs()[0].access_size, 16384);
+}
+
+TEST_F(ConfigTest, InvalidMatrixConstraints) {
+  YAML::Node invalid_zip = YAML::Load(
+      "bm: {matrix: {zip: {number_threads: [1, 2], number_partitions: [1]}}, args: {exec_mode: sequential}}");
+  std::vector<YAML::Node> invalid_zip_configs{invalid_zip};
+  EXPECT_THROW(BenchmarkFactory::create_single_benchmarks("/tmp/foo", invalid_zip_configs, true),
+               std::invalid_argument);
+
+  YAML::Node invalid_exclude =
+      YAML::Load("bm: {matrix: {number_threads: [1, 2], exclude: [{access_size: 64}]}, args: {exec_mode: sequential}}");
+  std::vector<YAML::Node> invalid_exclude_configs{invalid_exclude};
+  EXPECT_THROW(BenchmarkFactory::create_single_benchmarks("/tmp/foo", invalid_exclude_configs, true),
+               std::invalid_argument);
+
+  YAML::Node invalid_where =
+      YAML::Load("bm: {matrix: {number_threads: [1, 2], where: 'number_threads <'}, args: {exec_mode: sequential}}");
+  std::vector<YAML::Node> invalid_where_configs{invalid_where};
+  EXPECT_THROW(BenchmarkFactory::create_single_benchmarks("/tmp/foo", invalid_where_configs, true),
+               std::invalid_argument);
+
+  YAML::Node unknown_where_arg =
+      YAML::Load("bm: {matrix: {number_threads: [1, 2], where: 'threads < 2'}, args: {exec_mode: sequential}}");
+  std::vector<YAML::Node> unknown_where_arg_configs{unknown_where_arg};
+  EXPECT_THROW(BenchmarkFactory::create_single_benchmarks("/tmp/foo", unknown_where_arg_configs, true),
+               std::invalid_argument);
+}
+
 TEST_F(ConfigTest, ParallelDecodeMatrix) {
   const uint8_t num_bms = 4;
   std::vector<SingleBenchmark> benchmarks =
@@ -363,10 +737,221 @@ TEST_F(ConfigTest, InvalidSmallAccessSize) {
   check_log_for_critical("at least 64-byte");
 }
 
-TEST_F(ConfigTest, InvalidPowerAccessSize) {
+TEST_F(ConfigTest, NonPowerOfTwoAccessSize) {
   bm_config.access_size = 100;
+  EXPECT_NO_THROW(bm_config.validate());
+}
+
+TEST_F(ConfigTest, InvalidAlignmentOffset) {
+  bm_config.alignment_offset = 4096;
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("Alignment offset must be smaller");
+}
+
+TEST_F(ConfigTest, InvalidReadRatio) {
+  bm_config.read_ratio = 1.5;
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("Read ratio must be between 0 and 1");
+}
+
+TEST_F(ConfigTest, InvalidReadRatioCustomMode) {
+  bm_config.exec_mode = Mode::Custom;
+  bm_config.custom_operations = {CustomOp{.type = Operation::Read, .size = 64}};
+  bm_config.read_ratio = 0.5;
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("Read ratio only supported in sequential and random");
+}
+
+TEST_F(ConfigTest, InvalidFenceEvery) {
+  bm_config.fence_every = 0;
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("Fence every must be at least 1");
+}
+
+TEST_F(ConfigTest, InvalidFenceBatchingRead) {
+  bm_config.operation = Operation::Read;
+  bm_config.fence_every = 8;
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("Fence batching (fence_every > 1) only supported");
+}
+
+TEST_F(ConfigTest, InvalidFenceBatchingNoPersist) {
+  bm_config.operation = Operation::Write;
+  bm_config.persist_instruction = PersistInstruction::None;
+  bm_config.fence_every = 8;
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("Fence batching (fence_every > 1) only supported");
+}
+
+TEST_F(ConfigTest, InvalidStreamReadWrite) {
+  bm_config.operation = Operation::Write;
+  bm_config.read_instruction = ReadInstruction::Stream;
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("Streaming loads (read_instruction: stream) only supported");
+}
+
+TEST_F(ConfigTest, InvalidChecksumCustomMode) {
+  bm_config.exec_mode = Mode::Custom;
+  bm_config.custom_operations = {CustomOp{.type = Operation::Read, .size = 64}};
+  bm_config.checksum = Checksum::Crc32c;
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("Checksums only supported for sequential and random execution");
+}
+
+TEST_F(ConfigTest, InvalidChecksumStreamRead) {
+  bm_config.read_instruction = ReadInstruction::Stream;
+  bm_config.checksum = Checksum::XxHash;
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("Checksums cannot be combined with streaming loads");
+}
+
+TEST_F(ConfigTest, InvalidDataPatternMissingFile) {
+  bm_config.operation = Operation::Write;
+  bm_config.data_pattern = DataPattern::File;
+  bm_config.data_pattern_file = "/does/not/exist";
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("File data pattern requires an existing, non-empty data_pattern_file");
+}
+
+TEST_F(ConfigTest, InvalidTargetRateBoth) {
+  bm_config.target_ops_per_second = 1000000;
+  bm_config.target_bandwidth = BYTES_IN_GIGABYTE;
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("Only one of target_ops_per_second and target_bandwidth can be set");
+}
+
+TEST_F(ConfigTest, InvalidTargetRateLatencySampling) {
+  bm_config.exec_mode = Mode::Custom;
+  bm_config.custom_operations = {CustomOp{.type = Operation::Read, .size = 64}};
+  bm_config.target_ops_per_second = 1000000;
+  bm_config.latency_sample_frequency = 100;
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("Latency sampling not supported with rate-limited execution");
+}
+
+TEST_F(ConfigTest, InvalidPrefetchDistanceCustomMode) {
+  bm_config.exec_mode = Mode::Custom;
+  bm_config.custom_operations = {CustomOp{.type = Operation::Read, .size = 64}};
+  bm_config.prefetch_distance = 8;
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("Prefetch distance only supported for sequential and random reads");
+}
+
+TEST_F(ConfigTest, InvalidMlpWidth) {
+  bm_config.exec_mode = Mode::Custom;
+  bm_config.custom_operations = {CustomOp{.type = Operation::Read, .size = 64}};
+  bm_config.mlp_width = 0;
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("MLP width must be at least 1");
+}
+
+TEST_F(ConfigTest, InvalidMlpWidthMode) {
+  bm_config.mlp_width = 4;
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("MLP width (mlp_width > 1) only supported in custom execution");
+}
+
+TEST_F(ConfigTest, InvalidMlpWidthLatencySampling) {
+  bm_config.exec_mode = Mode::Custom;
+  bm_config.custom_operations = {CustomOp{.type = Operation::Read, .size = 64}};
+  bm_config.mlp_width = 4;
+  bm_config.latency_sample_frequency = 100;
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("Latency sampling not supported with mlp_width > 1");
+}
+
+TEST_F(ConfigTest, InvalidCustomChainWeight) {
+  bm_config.exec_mode = Mode::Custom;
+  bm_config.custom_chain_mixture = WeightedCustomChain::all_from_string("0.9: r_64 | 0: r_64,w_64_cache");
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("Weights of custom operation chains must be greater than 0");
+}
+
+TEST_F(ConfigTest, InvalidCustomChainMixtureMlpWidth) {
+  bm_config.exec_mode = Mode::Custom;
+  bm_config.custom_chain_mixture = WeightedCustomChain::all_from_string("0.9: r_64 | 0.1: r_64,w_64_cache");
+  bm_config.mlp_width = 4;
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("MLP width (mlp_width > 1) not supported for mixtures");
+}
+
+TEST_F(ConfigTest, CustomChainMixtureContainsOps) {
+  bm_config.exec_mode = Mode::Custom;
+  bm_config.custom_chain_mixture = WeightedCustomChain::all_from_string("0.9: r_64 | 0.1: rd_64,wd_64_cache");
+  bm_config.dram_memory_range = 1 * BYTES_IN_GIGABYTE;
+  EXPECT_NO_THROW(bm_config.validate());
+  EXPECT_TRUE(bm_config.contains_write_op());
+  EXPECT_TRUE(bm_config.contains_dram_op());
+  EXPECT_EQ(bm_config.get_custom_chains().size(), 2);
+}
+
+TEST_F(ConfigTest, InvalidCustomRegionMode) {
+  bm_config.custom_regions = {CustomRegion{.name = "idx", .size = BYTES_IN_MEGABYTE}};
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("Custom regions only supported in custom execution");
+}
+
+TEST_F(ConfigTest, InvalidCustomRegionName) {
+  bm_config.exec_mode = Mode::Custom;
+  bm_config.custom_operations = CustomOp::all_from_string("r(idx)_64");
+  bm_config.custom_regions = {CustomRegion{.name = "idx", .size = BYTES_IN_MEGABYTE},
+                              CustomRegion{.name = "idx", .size = BYTES_IN_MEGABYTE}};
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("Custom region names must be unique");
+}
+
+TEST_F(ConfigTest, InvalidCustomRegionPmemNumaNode) {
+  bm_config.exec_mode = Mode::Custom;
+  bm_config.custom_operations = CustomOp::all_from_string("r(idx)_64");
+  bm_config.custom_regions = {CustomRegion{.name = "idx", .size = BYTES_IN_MEGABYTE, .numa_node = 0}};
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("NUMA node can only be set for DRAM regions");
+}
+
+TEST_F(ConfigTest, InvalidCustomRegionUnknownRegion) {
+  bm_config.exec_mode = Mode::Custom;
+  bm_config.custom_operations = CustomOp::all_from_string("r(heap)_64");
+  bm_config.custom_regions = {CustomRegion{.name = "idx", .size = BYTES_IN_MEGABYTE}};
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("Custom operations must access defined custom_regions");
+}
+
+TEST_F(ConfigTest, InvalidCustomRegionTooSmall) {
+  bm_config.exec_mode = Mode::Custom;
+  bm_config.custom_operations = CustomOp::all_from_string("r(idx)_4096");
+  bm_config.custom_regions = {CustomRegion{.name = "idx", .size = 4096}};
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("Custom operations must access defined custom_regions that are large enough");
+}
+
+TEST_F(ConfigTest, InvalidSizeDistributionMode) {
+  bm_config.access_size_distribution = SizeDistribution::Uniform;
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("Access size distribution only supported in random execution");
+}
+
+TEST_F(ConfigTest, InvalidSizeDistributionRange) {
+  bm_config.exec_mode = Mode::Random;
+  bm_config.access_size_distribution = SizeDistribution::Uniform;
+  bm_config.min_access_size = 1024;
+  bm_config.max_access_size = 512;
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("Min access size must be greater than 0");
+}
+
+TEST_F(ConfigTest, MissingSizeDistributionHistogramFile) {
+  bm_config.exec_mode = Mode::Random;
+  bm_config.access_size_distribution = SizeDistribution::Histogram;
+  bm_config.access_size_histogram_file = "/tmp/does/not/exist";
+  EXPECT_THROW(bm_config.validate(), PermaException);
+  check_log_for_critical("requires an existing access_size_histogram_file");
+}
+
+TEST_F(ConfigTest, VariableSizeCustomOpWithoutDistribution) {
+  bm_config.exec_mode = Mode::Custom;
+  bm_config.custom_operations = {CustomOp{.type = Operation::Read, .size = 0, .has_variable_size = true}};
   EXPECT_THROW(bm_config.validate(), PermaException);
-  check_log_for_critical("power of 2");
+  check_log_for_critical("Variable-sized (*) custom operations require");
 }
 
 TEST_F(ConfigTest, InvalidMemoryRangeAccessSizeMultiple) {
@@ -1,9 +1,44 @@
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include "compiled_chain.hpp"
+#include "fast_random.hpp"
 #include "gtest/gtest.h"
 #include "io_operation.hpp"
+#include "utils.hpp"
 
 namespace perma {
 
-class CustomOperationTest : public ::testing::Test {};
+class CustomOperationTest : public ::testing::Test {
+ protected:
+  static constexpr size_t CHAIN_RANGE_SIZE = 1 * BYTES_IN_MEGABYTE;
+  static constexpr size_t MAX_CHAIN_ACCESS_SIZE = 4096;
+
+  void SetUp() override {
+    addr_ = static_cast<char*>(mmap(nullptr, CHAIN_RANGE_SIZE + MAX_CHAIN_ACCESS_SIZE, PROT_READ | PROT_WRITE,
+                                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    ASSERT_NE(addr_, MAP_FAILED);
+    utils::generate_read_data(addr_, CHAIN_RANGE_SIZE + MAX_CHAIN_ACCESS_SIZE);
+  }
+
+  void TearDown() override { munmap(addr_, CHAIN_RANGE_SIZE + MAX_CHAIN_ACCESS_SIZE); }
+
+  std::vector<ChainedOperation> create_chain(const std::vector<CustomOp>& ops) {
+    std::vector<ChainedOperation> chain;
+    chain.reserve(ops.size());
+    for (size_t i = 0; i < ops.size(); ++i) {
+      chain.emplace_back(ops[i], addr_, CHAIN_RANGE_SIZE);
+      if (i > 0) {
+        chain[i - 1].set_next(&chain[i]);
+      }
+    }
+    return chain;
+  }
+
+  char* addr_ = nullptr;
+};
 
 // Read Operations
 TEST_F(CustomOperationTest, ParseCustomRead64) {
@@ -26,7 +61,17 @@ TEST_F(CustomOperationTest, ParseCustomReadDram256) {
   EXPECT_EQ(op, (CustomOp{.type = Operation::Read, .is_pmem = false, .size = 256}));
 }
 
-TEST_F(CustomOperationTest, ParseBadRead333) { EXPECT_THROW(CustomOp::from_string("r_333"), PermaException); }
+TEST_F(CustomOperationTest, ParseCustomRead333) {
+  CustomOp op = CustomOp::from_string("r_333");
+  EXPECT_EQ(op, (CustomOp{.type = Operation::Read, .is_pmem = true, .size = 333}));
+}
+
+TEST_F(CustomOperationTest, ParseBadReadZeroSize) { EXPECT_THROW(CustomOp::from_string("r_0"), PermaException); }
+
+TEST_F(CustomOperationTest, ParseCustomReadVariableSize) {
+  CustomOp op = CustomOp::from_string("r_*");
+  EXPECT_EQ(op, (CustomOp{.type = Operation::Read, .is_pmem = true, .size = 0, .has_variable_size = true}));
+}
 
 TEST_F(CustomOperationTest, ParseBadReadTooShort) { EXPECT_THROW(CustomOp::from_string("r"), PermaException); }
 
@@ -110,7 +155,109 @@ TEST_F(CustomOperationTest, ParseBadWriteOffset) {
   EXPECT_THROW(CustomOp::from_string("w_128_none_333"), PermaException);
 }
 
-TEST_F(CustomOperationTest, ParseBadWrite333) { EXPECT_THROW(CustomOp::from_string("w_333_none"), PermaException); }
+TEST_F(CustomOperationTest, ParseCustomWrite333None) {
+  CustomOp op = CustomOp::from_string("w_333_none");
+  EXPECT_EQ(op,
+            (CustomOp{.type = Operation::Write, .is_pmem = true, .size = 333, .persist = PersistInstruction::None}));
+}
+
+TEST_F(CustomOperationTest, ParseCustomWriteVariableSizeNoCache) {
+  CustomOp op = CustomOp::from_string("w_*_nocache");
+  EXPECT_EQ(op, (CustomOp{.type = Operation::Write,
+                          .is_pmem = true,
+                          .size = 0,
+                          .persist = PersistInstruction::NoCache,
+                          .has_variable_size = true}));
+}
+
+TEST_F(CustomOperationTest, ParseCustomReadStream) {
+  CustomOp op = CustomOp::from_string("r_256_stream");
+  EXPECT_EQ(op, (CustomOp{.type = Operation::Read,
+                          .is_pmem = true,
+                          .size = 256,
+                          .read_instruction = ReadInstruction::Stream}));
+}
+
+TEST_F(CustomOperationTest, ParseCustomReadChecksum) {
+  CustomOp op = CustomOp::from_string("r_4096_crc32c");
+  EXPECT_EQ(op, (CustomOp{.type = Operation::Read, .is_pmem = true, .size = 4096, .checksum = Checksum::Crc32c}));
+  CustomOp relative_op = CustomOp::from_string("rd_256_xxhash_-256");
+  EXPECT_EQ(relative_op, (CustomOp{.type = Operation::Read,
+                                   .is_pmem = false,
+                                   .size = 256,
+                                   .offset = -256,
+                                   .read_pattern = ReadPattern::Relative,
+                                   .checksum = Checksum::XxHash}));
+}
+
+TEST_F(CustomOperationTest, ParseCustomWriteChecksum) {
+  CustomOp op = CustomOp::from_string("w_4096_nocache_xxhash");
+  EXPECT_EQ(op, (CustomOp{.type = Operation::Write,
+                          .is_pmem = true,
+                          .size = 4096,
+                          .persist = PersistInstruction::NoCache,
+                          .checksum = Checksum::XxHash}));
+  CustomOp offset_op = CustomOp::from_string("wd_64_cache_crc32c_-64");
+  EXPECT_EQ(offset_op, (CustomOp{.type = Operation::Write,
+                                 .is_pmem = false,
+                                 .size = 64,
+                                 .persist = PersistInstruction::Cache,
+                                 .offset = -64,
+                                 .checksum = Checksum::Crc32c}));
+}
+
+TEST_F(CustomOperationTest, ParseBadChecksum) {
+  EXPECT_THROW(CustomOp::from_string("r_256_stream_crc32c"), PermaException);
+  EXPECT_THROW(CustomOp::from_string("w_64_cache_md5"), PermaException);
+  EXPECT_THROW(CustomOp::from_string("w_64_cache_crc32c_64_64"), PermaException);
+  EXPECT_THROW(CustomOp::from_string("p_64_t0_crc32c"), PermaException);
+}
+
+TEST_F(CustomOperationTest, CustomChecksumString) {
+  EXPECT_EQ(CustomOp::from_string("rd_4096_crc32c").to_string(), "rd_4096_crc32c");
+  EXPECT_EQ(CustomOp::from_string("r(heap)_256_xxhash_256").to_string(), "r(heap)_256_xxhash_256");
+  EXPECT_EQ(CustomOp::from_string("w_4096_nocache_xxhash_-64").to_string(), "wp_4096_nocache_xxhash_-64");
+}
+
+TEST_F(CustomOperationTest, ParseBadReadInstruction) {
+  EXPECT_THROW(CustomOp::from_string("r_256_nocache"), PermaException);
+}
+
+TEST_F(CustomOperationTest, ParseCustomPrefetchNta) {
+  CustomOp op = CustomOp::from_string("p_512_nta");
+  EXPECT_EQ(op,
+            (CustomOp{.type = Operation::Prefetch, .is_pmem = true, .size = 512, .prefetch_hint = PrefetchHint::NTA}));
+}
+
+TEST_F(CustomOperationTest, ParseCustomDramPrefetchOffset) {
+  CustomOp op = CustomOp::from_string("pd_256_t0_1024");
+  EXPECT_EQ(op, (CustomOp{.type = Operation::Prefetch,
+                          .is_pmem = false,
+                          .size = 256,
+                          .offset = 1024,
+                          .prefetch_hint = PrefetchHint::T0}));
+}
+
+TEST_F(CustomOperationTest, ParseBadPrefetchMissingHint) {
+  EXPECT_THROW(CustomOp::from_string("p_256"), PermaException);
+}
+
+TEST_F(CustomOperationTest, ParseBadPrefetchVariableSize) {
+  EXPECT_THROW(CustomOp::from_string("p_*_t0"), PermaException);
+}
+
+TEST_F(CustomOperationTest, ParseCustomWriteFence) {
+  CustomOp op = CustomOp::from_string("w_64_fence");
+  EXPECT_EQ(op,
+            (CustomOp{.type = Operation::Write, .is_pmem = true, .size = 64, .persist = PersistInstruction::Fence}));
+}
+
+TEST_F(CustomOperationTest, ParseFence) {
+  CustomOp op = CustomOp::from_string("f");
+  EXPECT_EQ(op, (CustomOp{.type = Operation::Fence, .size = 0}));
+}
+
+TEST_F(CustomOperationTest, ParseBadFenceWithSize) { EXPECT_THROW(CustomOp::from_string("f_64"), PermaException); }
 
 TEST_F(CustomOperationTest, ParseBadWriteTooShort) { EXPECT_THROW(CustomOp::from_string("w"), PermaException); }
 
@@ -159,6 +306,38 @@ TEST_F(CustomOperationTest, CustomWrite128OffsetString) {
   EXPECT_EQ(op.to_string(), "wd_128_cache_128");
 }
 
+TEST_F(CustomOperationTest, CustomWriteVariableSizeString) {
+  CustomOp op{.type = Operation::Write,
+              .is_pmem = true,
+              .size = 0,
+              .persist = PersistInstruction::None,
+              .has_variable_size = true};
+  EXPECT_EQ(op.to_string(), "wp_*_none");
+}
+
+TEST_F(CustomOperationTest, CustomReadStreamString) {
+  CustomOp op{.type = Operation::Read, .is_pmem = false, .size = 128, .read_instruction = ReadInstruction::Stream};
+  EXPECT_EQ(op.to_string(), "rd_128_stream");
+}
+
+TEST_F(CustomOperationTest, CustomPrefetchString) {
+  CustomOp op{
+      .type = Operation::Prefetch, .is_pmem = false, .size = 256, .offset = -512, .prefetch_hint = PrefetchHint::NTA};
+  EXPECT_EQ(op.to_string(), "pd_256_nta_-512");
+}
+
+TEST_F(CustomOperationTest, CustomFenceString) {
+  CustomOp op{.type = Operation::Fence, .size = 0};
+  EXPECT_EQ(op.to_string(), "f");
+}
+
+TEST_F(CustomOperationTest, CustomChainWithFenceString) {
+  const std::vector<CustomOp> ops = CustomOp::all_from_string("r_64,w_64_cache,w_64_cache_64,f");
+  ASSERT_EQ(ops.size(), 4);
+  EXPECT_EQ(ops[3].type, Operation::Fence);
+  EXPECT_EQ(CustomOp::all_to_string(ops), "rp_64,wp_64_cache,wp_64_cache_64,f");
+}
+
 TEST_F(CustomOperationTest, CustomWrite128NegativeOffsetString) {
   CustomOp op{
       .type = Operation::Write, .is_pmem = false, .size = 128, .persist = PersistInstruction::Cache, .offset = -64};
@@ -166,25 +345,440 @@ TEST_F(CustomOperationTest, CustomWrite128NegativeOffsetString) {
 }
 
 TEST_F(CustomOperationTest, ValidChainDramPmemReadWrite) {
-  std::vector<CustomOp> ops = {CustomOp{.type = Operation::Read, .is_pmem = true},
-                               CustomOp{.type = Operation::Write, .is_pmem = true},
-                               CustomOp{.type = Operation::Write, .is_pmem = true},
-                               CustomOp{.type = Operation::Read, .is_pmem = true},
-                               CustomOp{.type = Operation::Read, .is_pmem = false},
-                               CustomOp{.type = Operation::Write, .is_pmem = false},
+  std::vector<CustomOp> ops = {CustomOp{.type = Operation::Read, .is_pmem = true, .size = 64},
+                               CustomOp{.type = Operation::Write, .is_pmem = true, .size = 64},
+                               CustomOp{.type = Operation::Write, .is_pmem = true, .size = 64},
+                               CustomOp{.type = Operation::Read, .is_pmem = true, .size = 64},
+                               CustomOp{.type = Operation::Read, .is_pmem = false, .size = 64},
+                               CustomOp{.type = Operation::Write, .is_pmem = false, .size = 64},
   };
   EXPECT_TRUE(CustomOp::validate(ops));
 }
 
+TEST_F(CustomOperationTest, ValidChainDramWriteAfterFence) {
+  std::vector<CustomOp> ops = {CustomOp{.type = Operation::Read, .is_pmem = false, .size = 64},
+                               CustomOp{.type = Operation::Fence, .size = 0},
+                               CustomOp{.type = Operation::Write, .is_pmem = false, .size = 64}};
+  EXPECT_TRUE(CustomOp::validate(ops));
+}
+
+TEST_F(CustomOperationTest, BadChainWithDramPrefetchAfterPmemRead) {
+  std::vector<CustomOp> ops = {CustomOp{.type = Operation::Read, .is_pmem = true, .size = 64},
+                               CustomOp{.type = Operation::Prefetch, .is_pmem = false, .size = 64}};
+  EXPECT_FALSE(CustomOp::validate(ops));
+}
+
+TEST_F(CustomOperationTest, BadChainStartsWithFence) {
+  std::vector<CustomOp> ops = {CustomOp{.type = Operation::Fence, .size = 0},
+                               CustomOp{.type = Operation::Read, .size = 64}};
+  EXPECT_FALSE(CustomOp::validate(ops));
+}
+
 TEST_F(CustomOperationTest, BadChainStartsWithWrite) {
-  std::vector<CustomOp> ops = {CustomOp{.type = Operation::Write}, CustomOp{.type = Operation::Read}};
+  std::vector<CustomOp> ops = {CustomOp{.type = Operation::Write, .size = 64},
+                               CustomOp{.type = Operation::Read, .size = 64}};
   EXPECT_FALSE(CustomOp::validate(ops));
 }
 
 TEST_F(CustomOperationTest, BadChainWithDramWriteAftrPmemRead) {
-  std::vector<CustomOp> ops = {CustomOp{.type = Operation::Read, .is_pmem = true},
-                               CustomOp{.type = Operation::Write, .is_pmem = false}};
+  std::vector<CustomOp> ops = {CustomOp{.type = Operation::Read, .is_pmem = true, .size = 64},
+                               CustomOp{.type = Operation::Write, .is_pmem = false, .size = 64}};
+  EXPECT_FALSE(CustomOp::validate(ops));
+}
+
+// Relative and Sequential Reads
+TEST_F(CustomOperationTest, ParseCustomRelativeRead) {
+  CustomOp op = CustomOp::from_string("r_64_128");
+  EXPECT_EQ(op, (CustomOp{.type = Operation::Read,
+                          .is_pmem = true,
+                          .size = 64,
+                          .offset = 128,
+                          .read_pattern = ReadPattern::Relative}));
+}
+
+TEST_F(CustomOperationTest, ParseCustomRelativeStreamRead) {
+  CustomOp op = CustomOp::from_string("rd_256_stream_-256");
+  EXPECT_EQ(op, (CustomOp{.type = Operation::Read,
+                          .is_pmem = false,
+                          .size = 256,
+                          .offset = -256,
+                          .read_instruction = ReadInstruction::Stream,
+                          .read_pattern = ReadPattern::Relative}));
+}
+
+TEST_F(CustomOperationTest, ParseCustomSequentialRead) {
+  CustomOp op = CustomOp::from_string("rs_256");
+  EXPECT_EQ(op, (CustomOp{.type = Operation::Read, .is_pmem = true, .size = 256,
+                          .read_pattern = ReadPattern::Sequential}));
+}
+
+TEST_F(CustomOperationTest, ParseCustomSequentialDramStreamRead) {
+  CustomOp op = CustomOp::from_string("rsd_512_stream");
+  EXPECT_EQ(op, (CustomOp{.type = Operation::Read,
+                          .is_pmem = false,
+                          .size = 512,
+                          .read_instruction = ReadInstruction::Stream,
+                          .read_pattern = ReadPattern::Sequential}));
+}
+
+TEST_F(CustomOperationTest, ParseBadRelativeReadOffset) {
+  EXPECT_THROW(CustomOp::from_string("r_64_100"), PermaException);
+}
+
+TEST_F(CustomOperationTest, ParseBadRelativeReadTooLong) {
+  EXPECT_THROW(CustomOp::from_string("r_64_stream_64_64"), PermaException);
+}
+
+TEST_F(CustomOperationTest, ParseBadSequentialReadOffset) {
+  EXPECT_THROW(CustomOp::from_string("rs_64_64"), PermaException);
+}
+
+TEST_F(CustomOperationTest, ParseBadSequentialReadVariableSize) {
+  EXPECT_THROW(CustomOp::from_string("rs_*"), PermaException);
+}
+
+TEST_F(CustomOperationTest, ParseBadSequentialWrite) {
+  EXPECT_THROW(CustomOp::from_string("ws_64_none"), PermaException);
+}
+
+TEST_F(CustomOperationTest, CustomRelativeReadString) {
+  CustomOp op{.type = Operation::Read, .is_pmem = false, .size = 64, .offset = -64,
+              .read_pattern = ReadPattern::Relative};
+  EXPECT_EQ(op.to_string(), "rd_64_-64");
+}
+
+TEST_F(CustomOperationTest, CustomSequentialReadString) {
+  CustomOp op{.type = Operation::Read, .is_pmem = true, .size = 256, .read_pattern = ReadPattern::Sequential};
+  EXPECT_EQ(op.to_string(), "rsp_256");
+}
+
+TEST_F(CustomOperationTest, ValidChainSequentialRelativeReads) {
+  std::vector<CustomOp> ops = CustomOp::all_from_string("rs_256,r_256_256,r_64,r_64_64,w_64_cache_-64");
+  ASSERT_EQ(ops.size(), 5);
+  EXPECT_TRUE(CustomOp::validate(ops));
+}
+
+TEST_F(CustomOperationTest, BadChainStartsWithRelativeRead) {
+  std::vector<CustomOp> ops = {
+      CustomOp{.type = Operation::Read, .size = 64, .offset = 64, .read_pattern = ReadPattern::Relative}};
+  EXPECT_FALSE(CustomOp::validate(ops));
+}
+
+TEST_F(CustomOperationTest, BadChainWithDramRelativeReadAfterPmemRead) {
+  std::vector<CustomOp> ops = {
+      CustomOp{.type = Operation::Read, .is_pmem = true, .size = 64},
+      CustomOp{.type = Operation::Read, .is_pmem = false, .size = 64, .read_pattern = ReadPattern::Relative}};
   EXPECT_FALSE(CustomOp::validate(ops));
 }
 
+TEST_F(CustomOperationTest, RelativeReadAddress) {
+  ChainedOperation op{CustomOp::from_string("r_64_-128"), addr_, CHAIN_RANGE_SIZE};
+  char* current_addr = addr_ + 4096;
+  EXPECT_EQ(op.get_target_address(current_addr, addr_), addr_ + 4096 - 128);
+}
+
+TEST_F(CustomOperationTest, SequentialReadAddressWrapsAround) {
+  constexpr size_t access_size = 256 * 1024;
+  ChainedOperation op{CustomOp::from_string("rs_262144"), addr_, CHAIN_RANGE_SIZE};
+  for (size_t i = 0; i < CHAIN_RANGE_SIZE / access_size; ++i) {
+    EXPECT_EQ(op.get_target_address(nullptr, nullptr), addr_ + (i * access_size));
+  }
+  EXPECT_EQ(op.get_target_address(nullptr, nullptr), addr_);
+}
+
+// Named Regions
+TEST_F(CustomOperationTest, ParseCustomRegionRead) {
+  CustomOp op = CustomOp::from_string("r(idx)_256");
+  EXPECT_EQ(op, (CustomOp{.type = Operation::Read, .size = 256, .region = "idx"}));
+}
+
+TEST_F(CustomOperationTest, ParseCustomRegionSequentialRead) {
+  CustomOp op = CustomOp::from_string("rs(log)_64");
+  EXPECT_EQ(op, (CustomOp{.type = Operation::Read, .size = 64, .read_pattern = ReadPattern::Sequential,
+                          .region = "log"}));
+}
+
+TEST_F(CustomOperationTest, ParseCustomRegionWrite) {
+  CustomOp op = CustomOp::from_string("w(log)_64_cache_64");
+  EXPECT_EQ(op, (CustomOp{.type = Operation::Write, .size = 64, .persist = PersistInstruction::Cache, .offset = 64,
+                          .region = "log"}));
+}
+
+TEST_F(CustomOperationTest, ParseBadRegionWithLocation) {
+  EXPECT_THROW(CustomOp::from_string("rd(idx)_64"), PermaException);
+}
+
+TEST_F(CustomOperationTest, ParseBadRegionMissingParenthesis) {
+  EXPECT_THROW(CustomOp::from_string("r(idx_64"), PermaException);
+  EXPECT_THROW(CustomOp::from_string("r()_64"), PermaException);
+}
+
+TEST_F(CustomOperationTest, CustomRegionString) {
+  EXPECT_EQ(CustomOp::from_string("r(idx)_256").to_string(), "r(idx)_256");
+  EXPECT_EQ(CustomOp::from_string("rs(log)_64_stream").to_string(), "rs(log)_64_stream");
+  EXPECT_EQ(CustomOp::from_string("w(log)_64_cache").to_string(), "w(log)_64_cache");
+  EXPECT_EQ(CustomOp::from_string("p(heap)_128_t0_64").to_string(), "p(heap)_128_t0_64");
+}
+
+TEST_F(CustomOperationTest, ValidChainRegionReadWrite) {
+  std::vector<CustomOp> ops = CustomOp::all_from_string("r(idx)_256,r_64,rs(log)_64,w(log)_64_cache");
+  ASSERT_EQ(ops.size(), 4);
+  EXPECT_TRUE(CustomOp::validate(ops));
+}
+
+TEST_F(CustomOperationTest, BadChainWithRegionWriteAfterOtherRegionRead) {
+  std::vector<CustomOp> ops = {CustomOp{.type = Operation::Read, .size = 64, .region = "idx"},
+                               CustomOp{.type = Operation::Write, .size = 64, .region = "log"}};
+  EXPECT_FALSE(CustomOp::validate(ops));
+}
+
+TEST_F(CustomOperationTest, BadChainWithPmemWriteAfterRegionRead) {
+  std::vector<CustomOp> ops = {CustomOp{.type = Operation::Read, .size = 64, .region = "idx"},
+                               CustomOp{.type = Operation::Write, .size = 64}};
+  EXPECT_FALSE(CustomOp::validate(ops));
+}
+
+TEST_F(CustomOperationTest, ZipfReadAddress) {
+  constexpr size_t access_size = 256;
+  constexpr size_t num_slots = CHAIN_RANGE_SIZE / access_size;
+  const utils::ZipfGenerator zipf_generator{0.99, num_slots};
+  ChainedOperation op{CustomOp::from_string("r_256"), addr_, CHAIN_RANGE_SIZE, nullptr, nullptr, false,
+                      &zipf_generator};
+
+  lehmer64_seed(42);
+  std::vector<uint64_t> slot_counts(num_slots, 0);
+  for (size_t i = 0; i < 100'000; ++i) {
+    char* addr = op.get_target_address(nullptr, addr_ + (i * 64));
+    ASSERT_GE(addr, addr_);
+    ASSERT_LT(addr, addr_ + CHAIN_RANGE_SIZE);
+    ASSERT_EQ((addr - addr_) % access_size, 0);
+    slot_counts[(addr - addr_) / access_size]++;
+  }
+
+  // The first slot is the most frequent one and the frequency decreases with the rank.
+  EXPECT_EQ(std::max_element(slot_counts.begin(), slot_counts.end()) - slot_counts.begin(), 0);
+  EXPECT_GT(slot_counts[0], slot_counts[10]);
+  EXPECT_GT(slot_counts[10], slot_counts[1000]);
+}
+
+// Compute Operations
+TEST_F(CustomOperationTest, ParseCustomCompute) {
+  CustomOp op = CustomOp::from_string("c_500");
+  EXPECT_EQ(op.type, Operation::Compute);
+  EXPECT_EQ(op.size, 500);
+  EXPECT_TRUE(op.is_compute());
+}
+
+TEST_F(CustomOperationTest, ParseCustomHash) {
+  CustomOp op = CustomOp::from_string("h_4");
+  EXPECT_EQ(op.type, Operation::Hash);
+  EXPECT_EQ(op.size, 4);
+  EXPECT_TRUE(op.is_compute());
+}
+
+TEST_F(CustomOperationTest, ParseBadCompute) {
+  EXPECT_THROW(CustomOp::from_string("c"), PermaException);
+  EXPECT_THROW(CustomOp::from_string("c_0"), PermaException);
+  EXPECT_THROW(CustomOp::from_string("c_10ns"), PermaException);
+  EXPECT_THROW(CustomOp::from_string("h_2_64"), PermaException);
+}
+
+TEST_F(CustomOperationTest, CustomComputeString) {
+  EXPECT_EQ(CustomOp::from_string("c_500").to_string(), "c_500");
+  EXPECT_EQ(CustomOp::from_string("h_4").to_string(), "h_4");
+}
+
+TEST_F(CustomOperationTest, ValidChainWithCompute) {
+  std::vector<CustomOp> ops = CustomOp::all_from_string("r_64,h_2,c_100,r_256,c_50,w_64_cache");
+  ASSERT_EQ(ops.size(), 6);
+  EXPECT_TRUE(CustomOp::validate(ops));
+}
+
+TEST_F(CustomOperationTest, BadChainStartsWithCompute) {
+  std::vector<CustomOp> ops = {CustomOp{.type = Operation::Compute, .size = 100},
+                               CustomOp{.type = Operation::Read, .size = 64}};
+  EXPECT_FALSE(CustomOp::validate(ops));
+}
+
+TEST_F(CustomOperationTest, ComputeKeepsCurrentAddress) {
+  ChainedOperation op{CustomOp::from_string("c_10"), addr_, CHAIN_RANGE_SIZE};
+  char* current_addr = addr_ + 4096;
+  EXPECT_EQ(op.get_target_address(current_addr, addr_), current_addr);
+  EXPECT_FALSE(op.moves_current_address());
+  EXPECT_EQ(op.run_step(current_addr, addr_), addr_);
+}
+
+TEST_F(CustomOperationTest, HashChangesDependentAddress) {
+  ChainedOperation op{CustomOp::from_string("h_3"), addr_, CHAIN_RANGE_SIZE};
+  const uint64_t loaded_value = 42;
+  char* hashed_addr = op.run_step(addr_, (char*)loaded_value);
+  EXPECT_EQ((uint64_t)hashed_addr, utils::hash_rounds(loaded_value, 3));
+  EXPECT_NE((uint64_t)hashed_addr, loaded_value);
+}
+
+TEST_F(CustomOperationTest, CompileChainWithChecksums) {
+  const std::vector<CustomOp> ops = CustomOp::all_from_string("r_128,r_512_crc32c,w_64_cache_xxhash");
+  std::vector<ChainedOperation> chain = create_chain(ops);
+  const CompiledChain compiled_chain{chain, ops, false};
+  EXPECT_FALSE(compiled_chain.is_unrolled());
+  // Only the first read is specialized, as the checksum ops run the generic step.
+  EXPECT_EQ(compiled_chain.num_specialized_steps(), 1);
+}
+
+TEST_F(CustomOperationTest, CompileChainWithCompute) {
+  const std::vector<CustomOp> ops = CustomOp::all_from_string("r_128,h_2,r_512,c_20");
+  std::vector<ChainedOperation> chain = create_chain(ops);
+  const CompiledChain compiled_chain{chain, ops, false};
+  EXPECT_FALSE(compiled_chain.is_unrolled());
+  EXPECT_EQ(compiled_chain.num_specialized_steps(), 2);
+}
+
+// Weighted Chain Mixtures
+TEST_F(CustomOperationTest, ParseWeightedChains) {
+  std::vector<WeightedCustomChain> chains = WeightedCustomChain::all_from_string("0.9: r_512 | 0.1: r_512, w_64_cache");
+  ASSERT_EQ(chains.size(), 2);
+  EXPECT_DOUBLE_EQ(chains[0].weight, 0.9);
+  EXPECT_EQ(chains[0].operations, CustomOp::all_from_string("r_512"));
+  EXPECT_DOUBLE_EQ(chains[1].weight, 0.1);
+  EXPECT_EQ(chains[1].operations, CustomOp::all_from_string("r_512,w_64_cache"));
+}
+
+TEST_F(CustomOperationTest, ParseBadWeightedChainMissingWeight) {
+  EXPECT_THROW(WeightedCustomChain::all_from_string("0.9: r_512 | r_512,w_64_cache"), PermaException);
+}
+
+TEST_F(CustomOperationTest, ParseBadWeightedChainWeight) {
+  EXPECT_THROW(WeightedCustomChain::all_from_string("0.9x: r_512"), PermaException);
+}
+
+TEST_F(CustomOperationTest, WeightedChainsString) {
+  std::vector<WeightedCustomChain> chains = WeightedCustomChain::all_from_string("3:r_64|1:rd_128,wd_64_none");
+  EXPECT_EQ(WeightedCustomChain::all_to_string(chains), "3: rp_64 | 1: rd_128,wd_64_none");
+}
+
+TEST_F(CustomOperationTest, ChainSamplerWeights) {
+  const std::vector<WeightedCustomChain> chains = WeightedCustomChain::all_from_string("0.9: r_64 | 0.1: r_128");
+  const ChainSampler sampler{chains};
+  lehmer64_seed(42);
+
+  constexpr size_t num_samples = 100000;
+  std::vector<size_t> counts(chains.size(), 0);
+  for (size_t i = 0; i < num_samples; ++i) {
+    counts[sampler.sample()]++;
+  }
+  EXPECT_NEAR(static_cast<double>(counts[0]) / num_samples, 0.9, 0.01);
+  EXPECT_NEAR(static_cast<double>(counts[1]) / num_samples, 0.1, 0.01);
+}
+
+TEST_F(CustomOperationTest, ChainSamplerTinyWeight) {
+  const std::vector<WeightedCustomChain> chains = WeightedCustomChain::all_from_string("1: r_64 | 0.00001: r_128");
+  const ChainSampler sampler{chains};
+  lehmer64_seed(42);
+
+  bool sampled_tiny_chain = false;
+  for (size_t i = 0; i < 1000000 && !sampled_tiny_chain; ++i) {
+    sampled_tiny_chain = sampler.sample() == 1;
+  }
+  EXPECT_TRUE(sampled_tiny_chain);
+}
+
+// Compiled Chains
+TEST_F(CustomOperationTest, CompileBundledShape) {
+  const std::vector<CustomOp> ops = CustomOp::all_from_string("r_512,r_512,r_512");
+  std::vector<ChainedOperation> chain = create_chain(ops);
+  const CompiledChain compiled_chain{chain, ops, false};
+  EXPECT_TRUE(compiled_chain.is_unrolled());
+  EXPECT_EQ(compiled_chain.num_specialized_steps(), 3);
+}
+
+TEST_F(CustomOperationTest, CompileDramAndPmemShape) {
+  const std::vector<CustomOp> ops = CustomOp::all_from_string("rd_512,rd_512,rd_512,rp_256");
+  std::vector<ChainedOperation> chain = create_chain(ops);
+  const CompiledChain compiled_chain{chain, ops, false};
+  EXPECT_TRUE(compiled_chain.is_unrolled());
+}
+
+// Each chain in workloads/operations runs unrolled.
+TEST_F(CustomOperationTest, CompileAllBundledShapes) {
+  const std::vector<std::string> bundled_chains{
+      // hash_index.yaml
+      "r_128,w_64_cache_64,w_64_cache_-64", "r_512,w_64_cache_128,w_64_cache_-128",
+      "r_1024,w_64_cache_256,w_64_cache_-256", "r_128", "r_512", "r_1024",
+      // tree_index.yaml
+      "r_512,r_512,r_512", "r_256,r_256,r_256", "r_1024,r_1024,r_1024",
+      "r_512,r_512,r_512,w_64_cache_320,w_64_cache_-64,w_64_cache_-64,w_64_cache_-64",
+      "r_256,r_256,r_256,w_64_cache_128,w_64_cache_-64",
+      "r_1024,r_1024,r_1024,w_64_cache_576,w_64_cache_-64,w_64_cache_-64,w_64_cache_-64,w_64_cache_-64,w_64_cache_-64,"
+      "w_64_cache_-64,w_64_cache_-64",
+      "r_512,r_512,r_512,r_512,r_512,r_512,r_512", "r_256,r_256,r_256,r_256,r_256,r_256,r_256,r_256,r_256,r_256,r_256",
+      "r_1024,r_1024,r_1024,r_1024,r_1024",
+      // aggregation.yaml
+      "r_128,w_64_none", "r_512,w_64_none_128,w_64_none_-128", "r_1024,w_64_none_256,w_64_none_-256",
+      // hybrid_tree_index.yaml
+      "rd_2048,rd_2048,rp_1024", "rd_1024,rd_1024,rd_1024,rp_512", "rd_512,rd_512,rd_512,rp_256",
+      "rd_2048,rd_2048,rp_1024,wp_64_cache_512,wp_64_cache_-512,wp_64_cache",
+      "rd_1024,rd_1024,rd_1024,rp_512,wp_64_cache_256,wp_64_cache_-256,wp_64_cache",
+      "rd_512,rd_512,rd_512,rp_256,wp_64_cache_128,wp_64_cache_-128,wp_64_cache"};
+
+  for (const std::string& chain_str : bundled_chains) {
+    const std::vector<CustomOp> ops = CustomOp::all_from_string(chain_str);
+    std::vector<ChainedOperation> chain = create_chain(ops);
+    const CompiledChain compiled_chain{chain, ops, false};
+    EXPECT_TRUE(compiled_chain.is_unrolled()) << chain_str;
+  }
+}
+
+TEST_F(CustomOperationTest, CompileFlatChain) {
+  const std::vector<CustomOp> ops = CustomOp::all_from_string("r_333,w_64_cache,r_128_stream");
+  std::vector<ChainedOperation> chain = create_chain(ops);
+  const CompiledChain compiled_chain{chain, ops, false};
+  EXPECT_FALSE(compiled_chain.is_unrolled());
+  EXPECT_EQ(compiled_chain.num_specialized_steps(), 1);
+}
+
+TEST_F(CustomOperationTest, CompileChainWithExplicitFences) {
+  const std::vector<CustomOp> ops = CustomOp::all_from_string("r_128,w_64_cache,w_64_cache_-64,f");
+  std::vector<ChainedOperation> chain = create_chain(ops);
+  const CompiledChain compiled_chain{chain, ops, true};
+  EXPECT_FALSE(compiled_chain.is_unrolled());
+  // Only the read is specialized, as the writes must leave the fencing to the explicit fence.
+  EXPECT_EQ(compiled_chain.num_specialized_steps(), 1);
+}
+
+// Compares the harness overhead of the recursive chain and the compiled chain on a cache-resident range. Both must
+// perform the same operations, which we check via the number of random numbers they draw.
+TEST_F(CustomOperationTest, CompiledChainHarnessOverhead) {
+  constexpr uint64_t num_chains = 200000;
+  constexpr uint64_t seed = 1234;
+
+  for (const char* chain_str : {"r_64,w_64_none", "r_64,r_64,w_64_none_64", "r_512,r_512,r_512"}) {
+    const std::vector<CustomOp> ops = CustomOp::all_from_string(chain_str);
+    std::vector<ChainedOperation> chain = create_chain(ops);
+    const CompiledChain compiled_chain{chain, ops, false};
+    char* start_addr = addr_;
+
+    lehmer64_seed(seed);
+    const auto recursive_start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < num_chains; ++i) {
+      chain[0].run(start_addr, start_addr);
+    }
+    const auto recursive_end = std::chrono::steady_clock::now();
+    const uint64_t recursive_next_random = lehmer64();
+
+    lehmer64_seed(seed);
+    const auto compiled_start = std::chrono::steady_clock::now();
+    compiled_chain.run(num_chains, start_addr);
+    const auto compiled_end = std::chrono::steady_clock::now();
+    const uint64_t compiled_next_random = lehmer64();
+
+    EXPECT_EQ(recursive_next_random, compiled_next_random) << chain_str;
+
+    const double recursive_ns = std::chrono::duration<double, std::nano>(recursive_end - recursive_start).count();
+    const double compiled_ns = std::chrono::duration<double, std::nano>(compiled_end - compiled_start).count();
+    std::cout << "[ CHAIN    ] " << chain_str << (compiled_chain.is_unrolled() ? " (unrolled)" : " (flat)")
+              << ": recursive " << recursive_ns / num_chains << " ns/chain, compiled " << compiled_ns / num_chains
+              << " ns/chain" << std::endl;
+  }
+}
+
 }  // namespace perma
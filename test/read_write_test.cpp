@@ -57,6 +57,44 @@ class ReadWriteTest : public ::testing::Test {
     check_file_written(temp_file_, TMP_FILE_SIZE, access_size);
   }
 
+  using UnalignedWriteFn = void(char*, size_t);
+  void run_unaligned_write_test(UnalignedWriteFn write_fn, const size_t offset, const size_t access_size) {
+    write_fn(addr + offset, access_size);
+    ASSERT_EQ(msync(addr, TMP_FILE_SIZE, MS_SYNC), 0);
+    check_range_written(temp_file_, offset, access_size);
+  }
+
+  // Fills the file with data, runs the read-modify-write, and checks that exactly the accessed words were modified.
+  template <typename RmwFn>
+  void run_rmw_test(RmwFn rmw_fn, const size_t offset, const size_t access_size) {
+    rw_ops::write_data(addr, addr + TMP_FILE_SIZE);
+    const std::vector<char> original_data{addr, addr + TMP_FILE_SIZE};
+
+    rmw_fn(addr + offset, access_size);
+    ASSERT_EQ(msync(addr, TMP_FILE_SIZE, MS_SYNC), 0);
+
+    for (size_t byte = 0; byte < TMP_FILE_SIZE; byte += sizeof(uint64_t)) {
+      uint64_t original_word;
+      uint64_t word;
+      std::memcpy(&original_word, original_data.data() + byte, sizeof(uint64_t));
+      std::memcpy(&word, addr + byte, sizeof(uint64_t));
+      const bool is_accessed = byte >= offset && byte + sizeof(uint64_t) <= offset + access_size;
+      ASSERT_EQ(word, is_accessed ? original_word + 1 : original_word) << "Wrong value at byte " << byte;
+    }
+  }
+
+  using MultiRmwFn = void(const std::vector<char*>&);
+  void run_multi_rmw_test(MultiRmwFn rmw_fn, const size_t access_size) {
+    auto multi_rmw_fn = [&](char* start_addr, const size_t size) {
+      std::vector<char*> op_addresses{};
+      for (char* op_addr = start_addr; op_addr < start_addr + size; op_addr += access_size) {
+        op_addresses.emplace_back(op_addr);
+      }
+      rmw_fn(op_addresses);
+    };
+    run_rmw_test(multi_rmw_fn, 0, TMP_FILE_SIZE);
+  }
+
   std::filesystem::path temp_file_;
   char* addr;
   int64_t fd;
@@ -106,6 +144,175 @@ TEST_F(ReadWriteTest, MultiSIMDNonTemporalWrite_64) { run_multi_write_test(rw_op
 TEST_F(ReadWriteTest, MultiSIMDNonTemporalWrite_128) { run_multi_write_test(rw_ops::simd_write_nt_128, 128); }
 TEST_F(ReadWriteTest, MultiSIMDNonTemporalWrite_256) { run_multi_write_test(rw_ops::simd_write_nt_256, 256); }
 TEST_F(ReadWriteTest, MultiSIMDNonTemporalWrite_512) { run_multi_write_test(rw_ops::simd_write_nt_512, 512); }
+
+TEST_F(ReadWriteTest, SingleSIMDFenceWrite_64) { run_single_write_test(rw_ops::simd_write_fence_64, 64); }
+TEST_F(ReadWriteTest, SingleSIMDFenceWrite_512) { run_single_write_test(rw_ops::simd_write_fence_512, 512); }
+TEST_F(ReadWriteTest, MultiSIMDFenceWrite_128) { run_multi_write_test(rw_ops::simd_write_fence_128, 128); }
+TEST_F(ReadWriteTest, MultiSIMDFenceWrite_256) { run_multi_write_test(rw_ops::simd_write_fence_256, 256); }
+
+TEST_F(ReadWriteTest, UnalignedSIMDNoneWrite_100) {
+  run_unaligned_write_test(rw_ops::simd_write_none_unaligned, 32, 100);
+}
+TEST_F(ReadWriteTest, UnalignedSIMDNoneWrite_1536) {
+  run_unaligned_write_test(rw_ops::simd_write_none_unaligned, 200, 1536);
+}
+TEST_F(ReadWriteTest, UnalignedSIMDNonTemporalWrite_100) {
+  run_unaligned_write_test(rw_ops::simd_write_nt_unaligned, 32, 100);
+}
+TEST_F(ReadWriteTest, UnalignedSIMDNonTemporalWrite_320) {
+  run_unaligned_write_test(rw_ops::simd_write_nt_unaligned, 0, 320);
+}
+TEST_F(ReadWriteTest, UnalignedSIMDFenceWrite_100) {
+  run_unaligned_write_test(rw_ops::simd_write_fence_unaligned, 32, 100);
+}
+TEST_F(ReadWriteTest, UnalignedSIMDNonTemporalWrite_Small) {
+  run_unaligned_write_test(rw_ops::simd_write_nt_unaligned, 40, 16);
+}
+#ifdef HAS_CLWB
+TEST_F(ReadWriteTest, UnalignedSIMDClwbWrite_100) {
+  run_unaligned_write_test(rw_ops::simd_write_clwb_unaligned, 32, 100);
+}
+#endif
+#ifdef HAS_CLFLUSHOPT
+TEST_F(ReadWriteTest, UnalignedSIMDClflushOptWrite_100) {
+  run_unaligned_write_test(rw_ops::simd_write_clflushopt_unaligned, 32, 100);
+}
+#endif
+
+TEST_F(ReadWriteTest, SIMDStreamRead) {
+  rw_ops::write_data(addr, addr + TMP_FILE_SIZE);
+  // All cache lines contain the same data, so all reads of the same size must return the same value.
+  const __m512i expected_64 = rw_ops::simd_read_64(addr);
+  EXPECT_EQ(_mm512_cmpneq_epi64_mask(rw_ops::simd_read_nt_64(addr + 64), expected_64), 0);
+  const __m512i expected_256 = rw_ops::simd_read_256(addr);
+  EXPECT_EQ(_mm512_cmpneq_epi64_mask(rw_ops::simd_read_nt_256(addr + 256), expected_256), 0);
+  const __m512i expected_2048 = rw_ops::simd_read(addr, 2048);
+  EXPECT_EQ(_mm512_cmpneq_epi64_mask(rw_ops::simd_read_nt(addr + 2048, 2048), expected_2048), 0);
+}
+
+TEST_F(ReadWriteTest, SingleSIMDNoneRMW_64) {
+  run_rmw_test([](char* rmw_addr, size_t) { rw_ops::simd_rmw_none_64(rmw_addr); }, 0, 64);
+}
+TEST_F(ReadWriteTest, SingleSIMDNoneRMW_512) {
+  run_rmw_test([](char* rmw_addr, size_t) { rw_ops::simd_rmw_none_512(rmw_addr); }, 512, 512);
+}
+TEST_F(ReadWriteTest, SingleSIMDNoneRMW_4096) {
+  run_rmw_test([](char* rmw_addr, size_t size) { rw_ops::simd_rmw_none(rmw_addr, size); }, 4096, 4096);
+}
+TEST_F(ReadWriteTest, SingleSIMDNonTemporalRMW_128) {
+  run_rmw_test([](char* rmw_addr, size_t) { rw_ops::simd_rmw_nt_128(rmw_addr); }, 128, 128);
+}
+TEST_F(ReadWriteTest, SingleSIMDNonTemporalRMW_256) {
+  run_rmw_test([](char* rmw_addr, size_t) { rw_ops::simd_rmw_nt_256(rmw_addr); }, 0, 256);
+}
+
+TEST_F(ReadWriteTest, SingleSIMDFenceRMW_256) {
+  run_rmw_test([](char* rmw_addr, size_t) { rw_ops::simd_rmw_fence_256(rmw_addr); }, 256, 256);
+}
+
+TEST_F(ReadWriteTest, MultiSIMDNoneRMW_128) { run_multi_rmw_test(rw_ops::simd_rmw_none_128, 128); }
+TEST_F(ReadWriteTest, MultiSIMDNonTemporalRMW_512) { run_multi_rmw_test(rw_ops::simd_rmw_nt_512, 512); }
+#ifdef HAS_CLWB
+TEST_F(ReadWriteTest, MultiSIMDClwbRMW_256) { run_multi_rmw_test(rw_ops::simd_rmw_clwb_256, 256); }
+#endif
+#ifdef HAS_CLFLUSHOPT
+TEST_F(ReadWriteTest, MultiSIMDClflushOptRMW_64) { run_multi_rmw_test(rw_ops::simd_rmw_clflushopt_64, 64); }
+#endif
+
+TEST_F(ReadWriteTest, UnalignedSIMDNoneRMW_104) {
+  run_rmw_test([](char* rmw_addr, size_t size) { rw_ops::simd_rmw_none_unaligned(rmw_addr, size); }, 32, 104);
+}
+TEST_F(ReadWriteTest, UnalignedSIMDNonTemporalRMW_320) {
+  run_rmw_test([](char* rmw_addr, size_t size) { rw_ops::simd_rmw_nt_unaligned(rmw_addr, size); }, 40, 320);
+}
+
+TEST_F(ReadWriteTest, UnalignedSIMDRead_100) {
+  rw_ops::simd_write_none_unaligned(addr + 32, 100);
+  const __m512i read_value = rw_ops::simd_read_unaligned(addr + 32, 100);
+  const __m512i expected_value = rw_ops::simd_read_unaligned(const_cast<char*>(rw_ops::WRITE_DATA), 64) +
+                                 rw_ops::simd_read_unaligned(const_cast<char*>(rw_ops::WRITE_DATA), 36);
+  EXPECT_EQ(_mm512_cmpneq_epi64_mask(read_value, expected_value), 0);
+}
+
+TEST_F(ReadWriteTest, Crc32cCheckValue) {
+  // The standard check value of CRC32C is the checksum of "123456789" with an inverted seed and result.
+  char check_data[] = "123456789";
+  const uint64_t crc = rw_ops::simd_read_crc32c(check_data, 9);
+  EXPECT_EQ(~crc & 0xFFFFFFFF, 0xE3069283);
+}
+
+TEST_F(ReadWriteTest, ChecksumReadMatchesWriteData) {
+  for (const size_t access_size : {64ul, 100ul, 4096ul}) {
+    rw_ops::simd_write_none_unaligned(addr + 32, access_size);
+    EXPECT_EQ(rw_ops::simd_read_crc32c(addr + 32, access_size), rw_ops::crc32c_write_data(access_size)) << access_size;
+    EXPECT_EQ(rw_ops::simd_read_xxhash(addr + 32, access_size), rw_ops::xxhash_write_data(access_size)) << access_size;
+  }
+}
+
+TEST_F(ReadWriteTest, WriteLinesStoresConsecutiveLines) {
+  alignas(64) char data[4 * rw_ops::CACHE_LINE_SIZE];
+  for (size_t byte = 0; byte < sizeof(data); ++byte) {
+    data[byte] = static_cast<char>(byte / rw_ops::CACHE_LINE_SIZE + 1);
+  }
+
+  // Unaligned writes with a partial tail and non-temporal writes with a partial head and tail store the same lines.
+  rw_ops::simd_write_lines(addr + 32, 200, data, rw_ops::CACHE_LINE_SIZE, rw_ops::no_flush, rw_ops::no_barrier);
+  rw_ops::simd_write_nt_lines(addr + 4096 + 32, 200, data, rw_ops::CACHE_LINE_SIZE, rw_ops::sfence_barrier);
+  EXPECT_EQ(std::memcmp(addr + 32, data, 200), 0);
+  EXPECT_EQ(std::memcmp(addr + 4096 + 32, data, 32), 0);
+  EXPECT_EQ(std::memcmp(addr + 4096 + 64, data + rw_ops::CACHE_LINE_SIZE, 168), 0);
+  EXPECT_EQ(addr[32 + 200], 0);
+  EXPECT_EQ(addr[4096 + 31], 0);
+
+  // A stride of 0 stores the first line everywhere.
+  rw_ops::simd_write_lines(addr + 8192, 256, data, 0, rw_ops::no_flush, rw_ops::no_barrier);
+  for (size_t offset = 0; offset < 256; offset += rw_ops::CACHE_LINE_SIZE) {
+    EXPECT_EQ(std::memcmp(addr + 8192 + offset, data, rw_ops::CACHE_LINE_SIZE), 0) << offset;
+  }
+}
+
+TEST_F(ReadWriteTest, ChecksumReadMatchesPatternData) {
+  alignas(64) char data[2 * rw_ops::CACHE_LINE_SIZE];
+  for (size_t byte = 0; byte < sizeof(data); ++byte) {
+    data[byte] = static_cast<char>(byte * 7);
+  }
+
+  rw_ops::simd_write_lines(addr, 100, data, rw_ops::CACHE_LINE_SIZE, rw_ops::no_flush, rw_ops::no_barrier);
+  EXPECT_EQ(rw_ops::simd_read_crc32c(addr, 100), rw_ops::crc32c_write_data(100, data, rw_ops::CACHE_LINE_SIZE));
+  EXPECT_EQ(rw_ops::simd_read_xxhash(addr, 100), rw_ops::xxhash_write_data(100, data, rw_ops::CACHE_LINE_SIZE));
+}
+
+TEST_F(ReadWriteTest, ChecksumDetectsChangedData) {
+  rw_ops::simd_write_none_512(addr);
+  const uint64_t crc = rw_ops::simd_read_crc32c(addr, 512);
+  const uint64_t hash = rw_ops::simd_read_xxhash(addr, 512);
+  addr[300] ^= 1;
+  EXPECT_NE(rw_ops::simd_read_crc32c(addr, 512), crc);
+  EXPECT_NE(rw_ops::simd_read_xxhash(addr, 512), hash);
+}
+
+TEST_F(ReadWriteTest, ChecksumRMWCoversLoadedAndModifiedData) {
+  // The read-modify-write checksum combines the checksums of the data before and after the access.
+  uint64_t crc = 0;
+  uint64_t loaded_crc = 0;
+  run_rmw_test(
+      [&](char* rmw_addr, size_t size) {
+        loaded_crc = rw_ops::simd_read_crc32c(rmw_addr, size);
+        crc = rw_ops::simd_rmw_crc32c(rmw_addr, size, /*non_temporal=*/true, rw_ops::no_flush, rw_ops::sfence_barrier);
+      },
+      40, 320);
+  EXPECT_EQ(crc, loaded_crc ^ rw_ops::simd_read_crc32c(addr + 40, 320));
+
+  uint64_t hash = 0;
+  uint64_t loaded_hash = 0;
+  run_rmw_test(
+      [&](char* rmw_addr, size_t size) {
+        loaded_hash = rw_ops::simd_read_xxhash(rmw_addr, size);
+        hash = rw_ops::simd_rmw_xxhash(rmw_addr, size, /*non_temporal=*/false, rw_ops::no_flush, rw_ops::no_barrier);
+      },
+      32, 104);
+  EXPECT_EQ(hash, loaded_hash ^ rw_ops::simd_read_xxhash(addr + 32, 104));
+}
 #endif
 
 }  // namespace perma
@@ -35,6 +35,24 @@ void check_file_written(const std::filesystem::path& pmem_file, const size_t tot
   check_file_written(pmem_file, total_size, total_size);
 }
 
+void check_range_written(const std::filesystem::path& pmem_file, const size_t range_offset, const size_t size_written) {
+  std::ifstream pmem_stream{pmem_file};
+  const std::string data{std::istreambuf_iterator<char>(pmem_stream), std::istreambuf_iterator<char>()};
+  ASSERT_LE(range_offset + size_written, data.size());
+
+  for (size_t offset = range_offset; offset < range_offset + size_written; ++offset) {
+    ASSERT_NE(data[offset], '\0') << "Failed at position " << std::to_string(offset);
+  }
+
+  // Check that we did not write before or after the range
+  if (range_offset > 0) {
+    ASSERT_EQ(data[range_offset - 1], '\0') << "Wrote before offset " << std::to_string(range_offset);
+  }
+  if (range_offset + size_written < data.size()) {
+    ASSERT_EQ(data[range_offset + size_written], '\0') << "Wrote beyond access size " << std::to_string(size_written);
+  }
+}
+
 void check_json_result(const nlohmann::json& result_json, uint64_t total_bytes, double expected_bandwidth,
                        uint64_t num_threads, double expected_per_thread_bandwidth, double expected_per_thread_stddev) {
   ASSERT_JSON_EQ(result_json, size(), 1);
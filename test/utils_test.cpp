@@ -5,9 +5,12 @@
 #include <filesystem>
 #include <fstream>
 
+#include "data_pattern.hpp"
+#include "fast_random.hpp"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "json.hpp"
+#include "size_distribution.hpp"
 
 namespace perma::utils {
 
@@ -55,6 +58,154 @@ TEST_F(UtilsTest, ZipfBound) {
   }
 }
 
+/**
+ * Verifies whether the values of the table-free Zipf generator are in between the given boundaries, also for ranges
+ * that are too large for a table of all probabilities.
+ */
+TEST_F(UtilsTest, ZipfGeneratorBound) {
+  const ZipfGenerator small_zipf{0.99, 1000};
+  const ZipfGenerator large_zipf{1.2, 1ul << 40};
+  lehmer64_seed(42);
+  for (uint32_t i = 0; i < 100'000; i++) {
+    EXPECT_LT(small_zipf.sample(lehmer64()), 1000);
+    EXPECT_LT(large_zipf.sample(lehmer64()), 1ul << 40);
+  }
+}
+
+TEST_F(UtilsTest, SpinIterationsScaleWithDuration) {
+  EXPECT_GE(spin_iterations_for(1), 1);
+  EXPECT_GT(spin_iterations_for(100'000), spin_iterations_for(1'000));
+}
+
+/**
+ * Verifies whether the sampled access sizes are within the configured bounds.
+ */
+TEST_F(UtilsTest, UniformSizeDistributionBound) {
+  BenchmarkConfig config{};
+  config.access_size_distribution = SizeDistribution::Uniform;
+  config.min_access_size = 100;
+  config.max_access_size = 2000;
+  AccessSizeSampler sampler{config};
+  EXPECT_LE(sampler.max_size(), 2000);
+  EXPECT_GT(sampler.average_size(), 100);
+  for (uint32_t i = 0; i < 100'000; i++) {
+    const uint32_t size = sampler.sample();
+    EXPECT_GE(size, 100);
+    EXPECT_LE(size, 2000);
+  }
+}
+
+TEST_F(UtilsTest, LogNormalSizeDistributionBound) {
+  BenchmarkConfig config{};
+  config.access_size_distribution = SizeDistribution::LogNormal;
+  config.min_access_size = 64;
+  config.max_access_size = 16 * 1024;
+  config.lognormal_mu = 7.0;
+  config.lognormal_sigma = 1.5;
+  AccessSizeSampler sampler{config};
+  EXPECT_LE(sampler.max_size(), 16 * 1024);
+  for (uint32_t i = 0; i < 100'000; i++) {
+    const uint32_t size = sampler.sample();
+    EXPECT_GE(size, 64);
+    EXPECT_LE(size, 16 * 1024);
+  }
+}
+
+TEST_F(UtilsTest, HistogramSizeDistribution) {
+  std::ofstream histogram{tmp_file_name_create};
+  histogram << "# size weight" << std::endl << "100 1" << std::endl << "1500 3" << std::endl << "4096 0" << std::endl;
+  histogram.close();
+
+  BenchmarkConfig config{};
+  config.access_size_distribution = SizeDistribution::Histogram;
+  config.access_size_histogram_file = tmp_file_name_create;
+  AccessSizeSampler sampler{config};
+  EXPECT_EQ(sampler.max_size(), 1500);
+  for (uint32_t i = 0; i < 100'000; i++) {
+    const uint32_t size = sampler.sample();
+    EXPECT_TRUE(size == 100 || size == 1500);
+  }
+}
+
+TEST_F(UtilsTest, WriteDataBufferRandomLines) {
+  BenchmarkConfig config{};
+  config.data_pattern = DataPattern::RandomLine;
+  WriteDataBuffer buffer{config, 0, 256};
+  EXPECT_EQ(buffer.line_stride(), rw_ops::CACHE_LINE_SIZE);
+
+  // Each access continues with the lines after the previous access.
+  const char* first_data = buffer.next(256);
+  const char* second_data = buffer.next(100);
+  EXPECT_EQ(second_data, first_data + 256);
+  EXPECT_EQ(buffer.next(64), second_data + 128);
+  EXPECT_NE(std::memcmp(first_data, first_data + rw_ops::CACHE_LINE_SIZE, rw_ops::CACHE_LINE_SIZE), 0);
+
+  // Accesses at the end of the buffer wrap around in the extra lines.
+  for (size_t line = 4 + 2 + 1; line < WriteDataBuffer::NUM_DATA_LINES - 1; ++line) {
+    buffer.next(64);
+  }
+  const char* last_data = buffer.next(256);
+  EXPECT_EQ(buffer.next(64), first_data + 192);
+  EXPECT_EQ(std::memcmp(last_data + rw_ops::CACHE_LINE_SIZE, first_data, 192), 0);
+}
+
+TEST_F(UtilsTest, WriteDataBufferRandomOps) {
+  BenchmarkConfig config{};
+  config.data_pattern = DataPattern::RandomOp;
+  WriteDataBuffer buffer{config, 0, 4096};
+  EXPECT_EQ(buffer.line_stride(), 0);
+
+  const char* first_data = buffer.next(4096);
+  const char* second_data = buffer.next(4096);
+  EXPECT_EQ(second_data, first_data + rw_ops::CACHE_LINE_SIZE);
+  EXPECT_NE(std::memcmp(first_data, second_data, rw_ops::CACHE_LINE_SIZE), 0);
+
+  // Different seeds result in different data.
+  WriteDataBuffer other_buffer{config, 1, 4096};
+  EXPECT_NE(std::memcmp(first_data, other_buffer.next(4096), rw_ops::CACHE_LINE_SIZE), 0);
+}
+
+TEST_F(UtilsTest, WriteDataBufferFileSample) {
+  std::ofstream data_file{tmp_file_name_create, std::ios::binary};
+  data_file << "0123456789";
+  data_file.close();
+
+  // Small files are repeated to fill the buffer.
+  const std::vector<char> sample = WriteDataBuffer::read_file_sample(tmp_file_name_create);
+  ASSERT_EQ(sample.size(), WriteDataBuffer::NUM_DATA_LINES * rw_ops::CACHE_LINE_SIZE);
+  EXPECT_EQ(std::string(sample.data(), 25), "0123456789012345678901234");
+
+  BenchmarkConfig config{};
+  config.data_pattern = DataPattern::File;
+  config.data_pattern_file = tmp_file_name_create;
+  std::vector<char> filled(200);
+  WriteDataBuffer{config, 0, 0}.fill(filled.data(), filled.data() + filled.size());
+  EXPECT_EQ(std::memcmp(filled.data(), sample.data(), filled.size()), 0);
+}
+
+TEST_F(UtilsTest, WriteDataBufferRandomReadData) {
+  BenchmarkConfig config{};
+  config.data_pattern = DataPattern::RandomLine;
+  // Each util thread fills more than the 64 KiB of a buffer.
+  const size_t buffer_size = WriteDataBuffer::NUM_DATA_LINES * rw_ops::CACHE_LINE_SIZE;
+  std::vector<char> data(4 * utils::NUM_UTIL_THREADS * buffer_size);
+  WriteDataBuffer::generate_read_data(data.data(), data.size(), config);
+
+  // The data does not repeat after 64 KiB.
+  for (size_t offset = 0; offset + buffer_size < data.size(); offset += rw_ops::CACHE_LINE_SIZE) {
+    ASSERT_NE(std::memcmp(data.data() + offset, data.data() + offset + buffer_size, rw_ops::CACHE_LINE_SIZE), 0)
+        << "Same line at offset " << offset;
+  }
+}
+
+TEST_F(UtilsTest, WriteDataBufferZero) {
+  BenchmarkConfig config{};
+  config.data_pattern = DataPattern::Zero;
+  std::vector<char> data(1000, 'x');
+  WriteDataBuffer::generate_read_data(data.data(), data.size(), config);
+  EXPECT_TRUE(std::all_of(data.begin(), data.end(), [](const char byte) { return byte == 0; }));
+}
+
 /**
  * Verifies whether the memory mapped file is the same size as the file.
  */